@@ -54,6 +54,9 @@ DBcore::~DBcore()
 	 * are re-using the default database connection pointer when we dont have an
 	 * external configuration setup ex: (content_database)
 	 */
+	// statements have to be closed while their connection is still open
+	m_prepared_stmts.clear();
+
 	if (mysqlOwner) {
 		mysql_close(mysql);
 	}
@@ -243,6 +246,7 @@ bool DBcore::Open(uint32 *errnum, char *errbuf)
 		return true;
 	}
 	if (GetStatus() == Error) {
+		m_prepared_stmts.clear();
 		mysql_close(mysql);
 		mysql_init(mysql);        // Initialize structure again
 	}
@@ -444,3 +448,38 @@ mysql::PreparedStmt DBcore::Prepare(std::string query)
 {
 	return mysql::PreparedStmt(*mysql, std::move(query), m_mutex);
 }
+
+std::shared_ptr<mysql::PreparedStmt> DBcore::GetPreparedStmt(const std::string &query)
+{
+	LockMutex lock(m_mutex);
+
+	// Reconnect if we are not connected before hand.
+	if (pStatus != Connected) {
+		Open();
+	}
+
+	auto e = m_prepared_stmts.find(query);
+	if (e != m_prepared_stmts.end()) {
+		return e->second;
+	}
+
+	auto stmt = std::make_shared<mysql::PreparedStmt>(*mysql, query, m_mutex);
+
+	m_prepared_stmts.emplace(query, stmt);
+
+	return stmt;
+}
+
+void DBcore::EvictPreparedStmt(const std::string &query, std::string error)
+{
+	LockMutex lock(m_mutex);
+
+	LogMySQLError("[{}] query [{}]", Strings::Trim(error), Strings::Replace(query, "\n", ""));
+
+	m_prepared_stmts.erase(query);
+
+	// statements do not survive a reconnect, Open drops the rest of them
+	if (mysql_ping(mysql) != 0) {
+		pStatus = Error;
+	}
+}
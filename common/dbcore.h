@@ -12,7 +12,9 @@
 
 #include <mysql.h>
 #include <string.h>
+#include <memory>
 #include <mutex>
+#include <unordered_map>
 
 #define CR_SERVER_GONE_ERROR    2006
 #define CR_SERVER_LOST          2013
@@ -55,6 +57,14 @@ public:
 	// throws std::runtime_error on failure
 	mysql::PreparedStmt Prepare(std::string query);
 
+	// statements prepared once per connection and reused by query text, same caveats as Prepare
+	// shared so a statement in use outlives a reconnect that clears the cache, it just fails and gets re-prepared
+	// throws std::runtime_error on failure
+	std::shared_ptr<mysql::PreparedStmt> GetPreparedStmt(const std::string &query);
+
+	// logs and drops a statement that failed, and every cached statement if the connection has gone away
+	void EvictPreparedStmt(const std::string &query, std::string error);
+
 protected:
 	bool Open(
 		const char *iHost,
@@ -78,6 +88,8 @@ private:
 
 	std::mutex m_query_lock{};
 
+	std::unordered_map<std::string, std::shared_ptr<mysql::PreparedStmt>> m_prepared_stmts;
+
 	std::string origin_host;
 
 	char   *pHost;
@@ -0,0 +1,62 @@
+#ifndef EQEMU_EQ_BROADCAST_PACKET_H
+#define EQEMU_EQ_BROADCAST_PACKET_H
+
+#include <array>
+#include <memory>
+#include "eq_stream_intf.h"
+
+/**
+ * One application packet headed to many streams
+ *
+ * The first stream of each client version runs that patch's encoder, every other stream on the same version is handed
+ * the already encoded packets instead of encoding its own copy. Streams that do no per-patch encoding fall back to
+ * QueuePacket
+ */
+class EQBroadcastPacket {
+public:
+	EQBroadcastPacket(const EQApplicationPacket *p, bool ack_req = true) : m_packet(p), m_ack_req(ack_req) {}
+
+	inline const EQApplicationPacket *GetPacket() const { return m_packet; }
+	inline bool IsAckRequired() const { return m_ack_req; }
+	inline uint32 GetEncodeCount() const { return m_encode_count; }
+	inline uint32 GetQueueCount() const { return m_queue_count; }
+
+	void QueueTo(const std::shared_ptr<EQStreamInterface> &stream)
+	{
+		if (!stream || !m_packet) {
+			return;
+		}
+
+		m_queue_count++;
+
+		const auto version = static_cast<size_t>(stream->ClientVersion());
+		if (version == 0 || version >= m_encoded.size()) {
+			stream->QueuePacket(m_packet, m_ack_req);
+			return;
+		}
+
+		if (!m_attempted[version]) {
+			m_attempted[version] = true;
+			m_encoded[version]   = stream->EncodePacket(m_packet, m_ack_req);
+			m_encode_count++;
+		}
+
+		if (!m_encoded[version]) {
+			stream->QueuePacket(m_packet, m_ack_req);
+			return;
+		}
+
+		stream->QueueEncodedPacket(*m_encoded[version]);
+	}
+
+private:
+	const EQApplicationPacket *m_packet;
+	bool                      m_ack_req;
+	uint32                    m_encode_count = 0;
+	uint32                    m_queue_count  = 0;
+
+	std::array<std::shared_ptr<const EQEncodedPacketSet>, EQ::versions::ClientVersionCount> m_encoded{};
+	std::array<bool, EQ::versions::ClientVersionCount>                                     m_attempted{};
+};
+
+#endif //EQEMU_EQ_BROADCAST_PACKET_H
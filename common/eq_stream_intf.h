@@ -3,7 +3,9 @@
 
 //this is the only part of an EQStream that is seen by the application.
 
+#include <memory>
 #include <string>
+#include <vector>
 #include "emu_versions.h"
 #include "eq_packet.h"
 #include "net/reliable_stream_connection.h"
@@ -23,10 +25,12 @@ struct EQStreamManagerInterfaceOptions
 {
 	EQStreamManagerInterfaceOptions() {
 		opcode_size = 2;
+		network_thread = false;
 	}
 
 	EQStreamManagerInterfaceOptions(int port, bool encoded, bool compressed) {
 		opcode_size = 2;
+		network_thread = false;
 
 		//World seems to support both compression and xor zone supports one or the others.
 		//Enforce one or the other in the convienence construct
@@ -44,6 +48,7 @@ struct EQStreamManagerInterfaceOptions
 
 	int opcode_size;
 	bool track_opcode_stats;
+	bool network_thread; // run the reliable stream on its own thread and event loop, see EQ::Net::NetworkThread
 	EQ::Net::ReliableStreamConnectionManagerOptions reliable_stream_options;
 };
 
@@ -60,6 +65,17 @@ protected:
 	EQStreamManagerInterfaceOptions m_options;
 };
 
+// the packets a patch encoder produced for a single application packet, shareable by every stream on that client version
+struct EQEncodedPacketSet {
+	struct Entry {
+		std::unique_ptr<EQApplicationPacket> packet;
+		bool                                 ack_req;
+	};
+
+	std::vector<Entry> packets;
+	bool               close = false;
+};
+
 class EQStreamInterface {
 public:
 	virtual ~EQStreamInterface() {}
@@ -105,6 +121,20 @@ public:
 	virtual Stats GetStats() const = 0;
 	virtual void ResetStats() = 0;
 	virtual EQStreamManagerInterface* GetManager() const = 0;
+
+	// runs the patch encoder without sending, nullptr when this stream does no per-patch encoding
+	virtual std::shared_ptr<const EQEncodedPacketSet> EncodePacket(const EQApplicationPacket *p, bool ack_req) const { return nullptr; }
+	// sends the output of EncodePacket from any stream on the same client version
+	virtual void QueueEncodedPacket(const EQEncodedPacketSet &set)
+	{
+		for (const auto &e : set.packets) {
+			QueuePacket(e.packet.get(), e.ack_req);
+		}
+
+		if (set.close) {
+			Close();
+		}
+	}
 };
 
 #endif /*EQSTREAMINTF_H_*/
@@ -6,6 +6,53 @@
 #include "opcodemgr.h"
 
 
+namespace {
+	// stands in for the real stream while an encoder runs so its output can be kept and replayed to many streams
+	class EQStreamEncodeCapture : public EQStreamInterface {
+	public:
+		explicit EQStreamEncodeCapture(EQ::versions::ClientVersion client_version)
+			: m_client_version(client_version), m_set(std::make_shared<EQEncodedPacketSet>()) {}
+
+		virtual void QueuePacket(const EQApplicationPacket *p, bool ack_req = true)
+		{
+			if (p) {
+				m_set->packets.push_back({std::unique_ptr<EQApplicationPacket>(p->Copy()), ack_req});
+			}
+		}
+
+		virtual void FastQueuePacket(EQApplicationPacket **p, bool ack_req = true)
+		{
+			if (p && *p) {
+				m_set->packets.push_back({std::unique_ptr<EQApplicationPacket>(*p), ack_req});
+				*p = nullptr;
+			}
+		}
+
+		virtual EQApplicationPacket *PopPacket() { return nullptr; }
+		virtual void Close() { m_set->close = true; }
+		virtual void ReleaseFromUse() { }
+		virtual void RemoveData() { }
+		virtual std::string GetRemoteAddr() const { return ""; }
+		virtual uint32 GetRemoteIP() const { return 0; }
+		virtual uint16 GetRemotePort() const { return 0; }
+		virtual bool CheckState(EQStreamState state) { return state == ESTABLISHED; }
+		virtual std::string Describe() const { return "Encode Capture"; }
+		virtual EQStreamState GetState() { return ESTABLISHED; }
+		virtual void SetOpcodeManager(OpcodeManager **opm) { }
+		virtual OpcodeManager *GetOpcodeManager() const { return nullptr; }
+		virtual const EQ::versions::ClientVersion ClientVersion() const { return m_client_version; }
+		virtual Stats GetStats() const { return Stats{}; }
+		virtual void ResetStats() { }
+		virtual EQStreamManagerInterface *GetManager() const { return nullptr; }
+
+		std::shared_ptr<const EQEncodedPacketSet> TakePackets() { return std::move(m_set); }
+
+	private:
+		EQ::versions::ClientVersion         m_client_version;
+		std::shared_ptr<EQEncodedPacketSet> m_set;
+	};
+}
+
 EQStreamProxy::EQStreamProxy(std::shared_ptr<EQStreamInterface> &stream, const StructStrategy *structs, OpcodeManager **opcodes)
 :	m_stream(stream),
 	m_structs(structs),
@@ -52,6 +99,30 @@ void EQStreamProxy::FastQueuePacket(EQApplicationPacket **p, bool ack_req) {
 	m_structs->Encode(p, m_stream, ack_req);
 }
 
+std::shared_ptr<const EQEncodedPacketSet> EQStreamProxy::EncodePacket(const EQApplicationPacket *p, bool ack_req) const {
+	if (p == nullptr) {
+		return nullptr;
+	}
+
+	auto capture = std::make_shared<EQStreamEncodeCapture>(m_structs->ClientVersion());
+
+	EQApplicationPacket *newp = p->Copy();
+	m_structs->Encode(&newp, capture, ack_req);
+
+	return capture->TakePackets();
+}
+
+void EQStreamProxy::QueueEncodedPacket(const EQEncodedPacketSet &set) {
+	// already run through this patch's encoder, straight to the underlying stream
+	for (const auto &e : set.packets) {
+		m_stream->QueuePacket(e.packet.get(), e.ack_req);
+	}
+
+	if (set.close) {
+		m_stream->Close();
+	}
+}
+
 EQApplicationPacket *EQStreamProxy::PopPacket() {
 	EQApplicationPacket *pack = m_stream->PopPacket();
 	if(pack == nullptr)
@@ -35,6 +35,8 @@ public:
 	virtual void ResetStats();
 	virtual EQStreamManagerInterface* GetManager() const;
 	virtual OpcodeManager* GetOpcodeManager() const;
+	virtual std::shared_ptr<const EQEncodedPacketSet> EncodePacket(const EQApplicationPacket *p, bool ack_req) const;
+	virtual void QueueEncodedPacket(const EQEncodedPacketSet &set);
 
 protected:
 	std::shared_ptr<EQStreamInterface> const m_stream;	//we own this stream object.
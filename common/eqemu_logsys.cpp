@@ -27,7 +27,9 @@
 #include "termcolor/rang.hpp"
 #include "path_manager.h"
 #include "file.h"
+#include "spsc_ring.h"
 
+#include <chrono>
 #include <iostream>
 #include <string>
 #include <time.h>
@@ -52,6 +54,54 @@ std::ofstream process_log;
 
 #endif
 
+/**
+ * A line that has been formatted by Out and is waiting for the async writer
+ */
+struct AsyncLogRecord {
+	uint16                       log_category                 = 0;
+	bool                         to_console                   = false;
+	bool                         to_file                      = false;
+	bool                         print_file_function_and_line = false;
+	const char                   *file                        = "";
+	const char                   *func                        = "";
+	int                          line                         = 0;
+	time_t                       log_time                     = 0;
+	std::string                  message;      // console text
+	std::string                  file_message; // platform and category prefixed text for the file log
+	EQEmuLogSys::OriginationInfo origin;
+};
+
+/**
+ * Ring owned by one logging thread. The owner pushes without locking, the async writer (or whoever holds the drain
+ * lock) pops
+ */
+class AsyncLogRing : public EQ::SPSCRing<AsyncLogRecord> {
+public:
+	AsyncLogRing(const EQEmuLogSys *owner, size_t size) : EQ::SPSCRing<AsyncLogRecord>(size), m_owner(owner) { }
+
+	const EQEmuLogSys *GetOwner() const { return m_owner; }
+
+	std::atomic<uint64> dropped{0};
+	std::atomic_bool    abandoned{false}; // the owning thread has exited
+
+private:
+	const EQEmuLogSys *m_owner;
+};
+
+// marks the thread's ring as abandoned when the thread exits so the writer can drop it once it is empty
+struct AsyncLogRingHandle {
+	std::shared_ptr<AsyncLogRing> ring;
+
+	~AsyncLogRingHandle()
+	{
+		if (ring) {
+			ring->abandoned = true;
+		}
+	}
+};
+
+static thread_local AsyncLogRingHandle t_async_log_ring;
+
 /**
  * EQEmuLogSys Constructor
  */
@@ -64,7 +114,10 @@ EQEmuLogSys::EQEmuLogSys()
 /**
  * EQEmuLogSys Deconstructor
  */
-EQEmuLogSys::~EQEmuLogSys() = default;
+EQEmuLogSys::~EQEmuLogSys()
+{
+	StopAsyncWriter();
+}
 
 EQEmuLogSys *EQEmuLogSys::LoadLogSettingsDefaults()
 {
@@ -164,12 +217,14 @@ EQEmuLogSys *EQEmuLogSys::LoadLogSettingsDefaults()
  */
 void EQEmuLogSys::ProcessLogWrite(
 	uint16 log_category,
-	const std::string &message
+	const std::string &message,
+	time_t log_time,
+	bool flush
 )
 {
 	if (log_category == Logs::Crash) {
 		char time_stamp[80];
-		EQEmuLogSys::SetCurrentTimeStamp(time_stamp);
+		EQEmuLogSys::SetCurrentTimeStamp(time_stamp, log_time);
 		std::ofstream crash_log;
 		EQEmuLogSys::MakeDirectory("logs/crashes");
 		crash_log.open(
@@ -182,8 +237,12 @@ void EQEmuLogSys::ProcessLogWrite(
 
 	if (process_log) {
 		char time_stamp[80];
-		EQEmuLogSys::SetCurrentTimeStamp(time_stamp);
-		process_log << time_stamp << " " << message << std::endl;
+		EQEmuLogSys::SetCurrentTimeStamp(time_stamp, log_time);
+		process_log << time_stamp << " " << message << "\n";
+
+		if (flush) {
+			process_log.flush();
+		}
 	}
 }
 
@@ -223,7 +282,9 @@ void EQEmuLogSys::ProcessConsoleMessage(
 	const std::string &message,
 	const char *file,
 	const char *func,
-	int line
+	int line,
+	bool print_file_function_and_line,
+	const OriginationInfo &origin
 )
 {
 	bool is_error   = (
@@ -257,7 +318,7 @@ void EQEmuLogSys::ProcessConsoleMessage(
 		<< rang::fgB::gray
 		<< " ";
 
-	if (RuleB(Logging, PrintFileFunctionAndLine)) {
+	if (print_file_function_and_line) {
 		(!is_error ? std::cout : std::cerr)
 			<< ""
 			<< rang::fgB::green
@@ -391,7 +452,7 @@ void EQEmuLogSys::ProcessConsoleMessage(
 			<< " ";
 	}
 
-	if (!origination_info.zone_short_name.empty()) {
+	if (!origin.zone_short_name.empty()) {
 		(!is_error ? std::cout : std::cerr)
 			<<
 			rang::fgB::black
@@ -400,15 +461,19 @@ void EQEmuLogSys::ProcessConsoleMessage(
 			<<
 			fmt::format(
 				"[{}] ({}) inst_id [{}]",
-				origination_info.zone_short_name,
-				origination_info.zone_long_name,
-				origination_info.instance_id
+				origin.zone_short_name,
+				origin.zone_long_name,
+				origin.instance_id
 			);
 	}
 
-	(!is_error ? std::cout : std::cerr) << rang::style::reset << std::endl;
-
-	m_on_log_console_hook(log_category, message);
+	// the async writer flushes once per batch instead
+	if (m_async_running && log_category != Logs::Crash) {
+		(!is_error ? std::cout : std::cerr) << rang::style::reset << "\n";
+	}
+	else {
+		(!is_error ? std::cout : std::cerr) << rang::style::reset << std::endl;
+	}
 }
 
 /**
@@ -445,8 +510,10 @@ void EQEmuLogSys::Out(
 		return;
 	}
 
+	const bool print_file_function_and_line = RuleB(Logging, PrintFileFunctionAndLine);
+
 	std::string prefix;
-	if (RuleB(Logging, PrintFileFunctionAndLine)) {
+	if (print_file_function_and_line) {
 		prefix = fmt::format("[{0}::{1}:{2}] ", std::filesystem::path(file).filename().string(), func, line);
 	}
 
@@ -469,24 +536,92 @@ void EQEmuLogSys::Out(
 		va_end(args);
 	}
 
+	// GMSay and Discord only lines never touch the rings or the writer
+	if (l.log_to_console_enabled || l.log_to_file_enabled) {
+		// counted before m_async_running is read, StopAsyncWriter waits for a push that already chose the ring
+		m_async_producers++;
+
+		if (m_async_running && log_category != Logs::Crash) {
+			AsyncLogRecord r;
+			r.log_category                 = log_category;
+			r.to_console                   = l.log_to_console_enabled;
+			r.to_file                      = l.log_to_file_enabled;
+			r.print_file_function_and_line = print_file_function_and_line;
+			r.file                         = file;
+			r.func                         = func;
+			r.line                         = line;
+			r.log_time                     = time(nullptr);
+
+			if (l.log_to_console_enabled) {
+				r.message = output_message;
+				r.origin  = origination_info;
+			}
+
+			if (l.log_to_file_enabled) {
+				r.file_message = fmt::format(
+					"[{}] [{}] {}",
+					GetPlatformName(),
+					Logs::LogCategoryName[log_category],
+					prefix + output_message
+				);
+			}
+
+			auto ring = GetAsyncLogRing();
+			while (!ring->TryPush(r)) {
+				if (!m_async_block_when_full || !m_async_running) {
+					ring->dropped++;
+					break;
+				}
+
+				m_async_wake.notify_one();
+				std::this_thread::yield();
+			}
+
+			if (ring->Size() >= ring->Capacity() / 2) {
+				m_async_wake.notify_one();
+			}
+
+			m_async_producers--;
+		}
+		else {
+			m_async_producers--;
+
+			// crashes are written and flushed before anything else can happen to the process, so a crash line
+			// waits for the batch in progress and goes out after everything queued ahead of it
+			if (log_category == Logs::Crash) {
+				std::unique_lock<std::recursive_timed_mutex> drain_lock(m_async_drain_lock, std::defer_lock);
+				if (m_async_running && drain_lock.try_lock_for(std::chrono::milliseconds(250))) {
+					DrainAsyncLogs(true);
+				}
+			}
+
+			if (l.log_to_console_enabled) {
+				EQEmuLogSys::ProcessConsoleMessage(
+					log_category,
+					output_message,
+					file,
+					func,
+					line,
+					print_file_function_and_line,
+					origination_info
+				);
+			}
+			if (l.log_to_file_enabled) {
+				EQEmuLogSys::ProcessLogWrite(
+					log_category,
+					fmt::format("[{}] [{}] {}", GetPlatformName(), Logs::LogCategoryName[log_category], prefix + output_message),
+					time(nullptr)
+				);
+			}
+		}
+	}
+
 	if (l.log_to_console_enabled) {
-		EQEmuLogSys::ProcessConsoleMessage(
-			log_category,
-			output_message,
-			file,
-			func,
-			line
-		);
+		m_on_log_console_hook(log_category, output_message);
 	}
 	if (l.log_to_gmsay_enabled) {
 		m_on_log_gmsay_hook(log_category, func, output_message);
 	}
-	if (l.log_to_file_enabled) {
-		EQEmuLogSys::ProcessLogWrite(
-			log_category,
-			fmt::format("[{}] [{}] {}", GetPlatformName(), Logs::LogCategoryName[log_category], prefix + output_message)
-		);
-	}
 	if (l.log_to_discord_enabled && m_on_log_discord_hook) {
 		m_on_log_discord_hook(log_category, log_settings[log_category].discord_webhook_id, output_message);
 	}
@@ -497,11 +632,22 @@ void EQEmuLogSys::Out(
  */
 void EQEmuLogSys::SetCurrentTimeStamp(char *time_stamp)
 {
-	time_t    raw_time;
-	struct tm *time_info;
-	time(&raw_time);
-	time_info = localtime(&raw_time);
-	strftime(time_stamp, 80, "[%m-%d-%Y %H:%M:%S]", time_info);
+	SetCurrentTimeStamp(time_stamp, time(nullptr));
+}
+
+/**
+ * @param time_stamp
+ * @param log_time
+ */
+void EQEmuLogSys::SetCurrentTimeStamp(char *time_stamp, time_t log_time)
+{
+	struct tm time_info{};
+#ifdef _WINDOWS
+	localtime_s(&time_info, &log_time);
+#else
+	localtime_r(&log_time, &time_info);
+#endif
+	strftime(time_stamp, 80, "[%m-%d-%Y %H:%M:%S]", &time_info);
 }
 
 /**
@@ -525,6 +671,8 @@ void EQEmuLogSys::MakeDirectory(const std::string &directory_name)
 
 void EQEmuLogSys::CloseFileLogs()
 {
+	StopAsyncWriter();
+
 	if (process_log.is_open()) {
 		process_log.close();
 	}
@@ -536,7 +684,18 @@ void EQEmuLogSys::CloseFileLogs()
 void EQEmuLogSys::StartFileLogs(const std::string &log_name)
 {
 	EQEmuLogSys::CloseFileLogs();
+	EQEmuLogSys::OpenFileLogs(log_name);
 
+	if (RuleB(Logging, AsyncWrites)) {
+		StartAsyncWriter();
+	}
+}
+
+/**
+ * @param log_name
+ */
+void EQEmuLogSys::OpenFileLogs(const std::string &log_name)
+{
 	if (!File::Exists(PathManager::Instance()->GetLogPath())) {
 		LogInfo("Logs directory not found, creating [{}]", PathManager::Instance()->GetLogPath());
 		File::Makedir(PathManager::Instance()->GetLogPath());
@@ -589,6 +748,174 @@ void EQEmuLogSys::StartFileLogs(const std::string &log_name)
 	}
 }
 
+void EQEmuLogSys::StartAsyncWriter()
+{
+	if (m_async_running) {
+		return;
+	}
+
+	m_async_ring_size       = static_cast<size_t>(std::max(RuleI(Logging, AsyncQueueSize), 16));
+	m_async_block_when_full = RuleB(Logging, AsyncBlockWhenFull);
+	m_async_flush_interval  = std::max(RuleI(Logging, AsyncFlushIntervalMS), 1);
+
+	m_async_stop    = false;
+	m_async_running = true;
+	m_async_thread  = std::thread(&EQEmuLogSys::AsyncWriter, this);
+
+	LogInfo(
+		"Async log writer started, queue size [{}] per thread, [{}] when full",
+		m_async_ring_size,
+		m_async_block_when_full ? "blocking" : "dropping"
+	);
+}
+
+void EQEmuLogSys::StopAsyncWriter()
+{
+	if (!m_async_running) {
+		return;
+	}
+
+	// later lines go out synchronously, one that already chose the ring has to land before the final drain
+	m_async_running = false;
+
+	// bounded, a crash can stop a producer mid push
+	const auto wait_until = std::chrono::steady_clock::now() + std::chrono::milliseconds(250);
+	while (m_async_producers > 0 && std::chrono::steady_clock::now() < wait_until) {
+		std::this_thread::yield();
+	}
+
+	m_async_stop = true;
+	m_async_wake.notify_one();
+
+	// the writer itself can end up here when it crashes, it cannot join itself
+	if (m_async_thread.joinable()) {
+		if (m_async_thread.get_id() == std::this_thread::get_id()) {
+			m_async_thread.detach();
+		}
+		else {
+			m_async_thread.join();
+		}
+	}
+
+	FlushAsyncLogs();
+}
+
+void EQEmuLogSys::FlushAsyncLogs()
+{
+	// bounded, a crash inside the writer can leave the lock held
+	std::unique_lock<std::recursive_timed_mutex> lock(m_async_drain_lock, std::defer_lock);
+	if (!lock.try_lock_for(std::chrono::milliseconds(250))) {
+		return;
+	}
+
+	DrainAsyncLogs(true);
+}
+
+AsyncLogRing *EQEmuLogSys::GetAsyncLogRing()
+{
+	auto &ring = t_async_log_ring.ring;
+	if (!ring || ring->GetOwner() != this) {
+		if (ring) {
+			ring->abandoned = true;
+		}
+
+		ring = std::make_shared<AsyncLogRing>(this, m_async_ring_size);
+
+		std::lock_guard<std::mutex> lock(m_async_rings_lock);
+		m_async_rings.emplace_back(ring);
+	}
+
+	return ring.get();
+}
+
+void EQEmuLogSys::AsyncWriter()
+{
+	auto last_flush = std::chrono::steady_clock::now();
+
+	while (!m_async_stop) {
+		{
+			std::unique_lock<std::mutex> lock(m_async_wake_lock);
+			m_async_wake.wait_for(lock, std::chrono::milliseconds(10));
+		}
+
+		const auto now        = std::chrono::steady_clock::now();
+		const bool flush_file = now - last_flush >= std::chrono::milliseconds(m_async_flush_interval);
+		if (flush_file) {
+			last_flush = now;
+		}
+
+		std::lock_guard<std::recursive_timed_mutex> lock(m_async_drain_lock);
+		DrainAsyncLogs(flush_file);
+	}
+}
+
+// caller holds m_async_drain_lock
+void EQEmuLogSys::DrainAsyncLogs(bool flush_file)
+{
+	std::vector<std::shared_ptr<AsyncLogRing>> rings;
+	{
+		std::lock_guard<std::mutex> lock(m_async_rings_lock);
+
+		// rings of exited threads go once everything they queued has been written
+		m_async_rings.erase(
+			std::remove_if(
+				m_async_rings.begin(),
+				m_async_rings.end(),
+				[](const std::shared_ptr<AsyncLogRing> &r) { return r->abandoned && r->Size() == 0 && r->dropped == 0; }
+			),
+			m_async_rings.end()
+		);
+
+		rings = m_async_rings;
+	}
+
+	bool           wrote_console = false;
+	uint64         dropped       = 0;
+	AsyncLogRecord r;
+	for (auto &ring: rings) {
+		dropped += ring->dropped.exchange(0);
+
+		while (ring->Pop(r)) {
+			if (r.to_console) {
+				ProcessConsoleMessage(r.log_category, r.message, r.file, r.func, r.line, r.print_file_function_and_line, r.origin);
+				wrote_console = true;
+			}
+
+			if (r.to_file) {
+				ProcessLogWrite(r.log_category, r.file_message, r.log_time, false);
+			}
+		}
+	}
+
+	if (dropped) {
+		m_async_dropped_total += dropped;
+
+		const auto message = fmt::format(
+			"Async log queue full, dropped [{}] line(s) ([{}] since start)",
+			dropped,
+			m_async_dropped_total.load()
+		);
+
+		ProcessConsoleMessage(Logs::Warning, message, __FILE__, __func__, __LINE__, false, OriginationInfo{});
+		ProcessLogWrite(
+			Logs::Warning,
+			fmt::format("[{}] [{}] {}", GetPlatformName(), Logs::LogCategoryName[Logs::Warning], message),
+			time(nullptr),
+			false
+		);
+		wrote_console = true;
+	}
+
+	if (wrote_console) {
+		std::cout.flush();
+		std::cerr.flush();
+	}
+
+	if (flush_file && process_log) {
+		process_log.flush();
+	}
+}
+
 /**
  * Silence console logging
  */
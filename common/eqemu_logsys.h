@@ -26,6 +26,13 @@
 #include <cstdio>
 #include <functional>
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #ifdef _WIN32
 #ifdef utf16_to_utf8
@@ -270,6 +277,8 @@ class Database;
 
 constexpr uint16 MAX_DISCORD_WEBHOOK_ID = 300;
 
+class AsyncLogRing;
+
 class EQEmuLogSys {
 public:
 	EQEmuLogSys();
@@ -318,6 +327,7 @@ public:
 	 * @param time_stamp
 	 */
 	void SetCurrentTimeStamp(char *time_stamp);
+	void SetCurrentTimeStamp(char *time_stamp, time_t log_time);
 
 	/**
 	 * @param log_name
@@ -414,6 +424,19 @@ public:
 	void DisableMySQLErrorLogs();
 	void EnableMySQLErrorLogs();
 
+	/**
+	 * Async writes (Logging:AsyncWrites)
+	 *
+	 * Out still formats on the calling thread and runs the GMSay, Discord and console hooks there, but the console
+	 * and file output is queued on a per thread ring and written by a background thread that flushes the file every
+	 * Logging:AsyncFlushIntervalMS. Crash logs, CloseFileLogs and shutdown always drain the queues synchronously
+	 */
+	void StartAsyncWriter();
+	void StopAsyncWriter();
+	void FlushAsyncLogs();
+	bool IsAsyncWriterRunning() const { return m_async_running; }
+	uint64 GetAsyncDroppedCount() const { return m_async_dropped_total; }
+
 private:
 
 	// reference to database
@@ -427,14 +450,35 @@ private:
 	std::string                                                                     m_platform_file_name;
 	std::string                                                                     m_log_path;
 
+	// async writer
+	std::thread                                m_async_thread;
+	std::atomic_bool                           m_async_running{false};
+	std::atomic_bool                           m_async_stop{false};
+	std::atomic<int>                           m_async_producers{0}; // Out calls between checking m_async_running and pushing
+	std::atomic<uint64>                        m_async_dropped_total{0};
+	std::mutex                                 m_async_wake_lock;
+	std::condition_variable                    m_async_wake;
+	std::recursive_timed_mutex                 m_async_drain_lock; // held by whoever is writing queued lines
+	std::mutex                                 m_async_rings_lock;
+	std::vector<std::shared_ptr<AsyncLogRing>> m_async_rings;
+	size_t                                     m_async_ring_size       = 8192;
+	bool                                       m_async_block_when_full = false;
+	int                                        m_async_flush_interval  = 1000;
+
 	void ProcessConsoleMessage(
 		uint16 log_category,
 		const std::string &message,
 		const char *file,
 		const char *func,
-		int line
+		int line,
+		bool print_file_function_and_line,
+		const OriginationInfo &origin
 	);
-	void ProcessLogWrite(uint16 log_category, const std::string &message);
+	void ProcessLogWrite(uint16 log_category, const std::string &message, time_t log_time, bool flush = true);
+	void OpenFileLogs(const std::string &log_name);
+	AsyncLogRing *GetAsyncLogRing();
+	void AsyncWriter();
+	void DrainAsyncLogs(bool flush_file);
 	void InjectTablesIfNotExist();
 };
 
@@ -456,6 +456,8 @@ EQ::ItemInstance* EQ::InventoryProfile::PopItem(int16 slot_id)
 {
 	ItemInstance* p = nullptr;
 
+	m_revision++;
+
 	if (slot_id == invslot::slotCursor) {
 		p = m_cursor.pop();
 	} else if (EQ::ValueWithin(slot_id, invslot::EQUIPMENT_BEGIN, invslot::EQUIPMENT_END)) {
@@ -1414,6 +1416,8 @@ int16 EQ::InventoryProfile::_PutItem(int16 slot_id, ItemInstance* inst)
 	int16 result      = INVALID_INDEX;
 	int16 parent_slot = INVALID_INDEX;
 
+	m_revision++;
+
 	inst->SetEvolveEquipped(false);
 
 	if (slot_id == invslot::slotCursor) {
@@ -110,6 +110,9 @@ namespace EQ
 		static void CleanDirty();
 		static void MarkDirty(ItemInstance *inst);
 
+		// bumped whenever an item is put into or popped out of any slot
+		uint32 GetRevision() const { return m_revision; }
+
 		// Retrieve a writeable item at specified slot
 		ItemInstance* GetItem(int16 slot_id) const;
 		ItemInstance* GetItem(int16 slot_id, uint8 bagidx) const;
@@ -251,6 +254,7 @@ namespace EQ
 		versions::MobVersion m_mob_version;
 		bool m_gm_inventory;
 		const inventory::LookupEntry* m_lookup;
+		uint32 m_revision = 0;
 	};
 }
 
@@ -0,0 +1,23 @@
+#include "item_body_cache.h"
+#include "item_data.h"
+
+std::atomic<uint32> EQ::ItemBodyCache::s_generation{0};
+
+const std::string &EQ::ItemBodyCache::Get(const ItemData *item)
+{
+	const uint32 generation = s_generation.load(std::memory_order_relaxed);
+	if (m_generation != generation) {
+		m_bodies.clear();
+		m_generation = generation;
+	}
+
+	auto iter = m_bodies.find(item->ID);
+	if (iter != m_bodies.end()) {
+		return iter->second;
+	}
+
+	OutBuffer ob;
+	m_serialize(ob, item);
+
+	return m_bodies.emplace(item->ID, ob.str()).first->second;
+}
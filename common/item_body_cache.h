@@ -0,0 +1,43 @@
+#pragma once
+
+#include "types.h"
+#include "memory_buffer.h"
+#include <atomic>
+#include <string>
+#include <unordered_map>
+
+namespace EQ
+{
+	struct ItemData;
+
+	/**
+	 * Serialized static item bodies for one client patch, keyed by item id
+	 *
+	 * Most of an item packet depends only on the ItemData, so each patch builds that part once per item and copies
+	 * it in behind the instance header on every later send. Entries built before the item table was reloaded are
+	 * dropped the next time the cache is used
+	 *
+	 * Not thread safe, patches encode on the thread that owns the stream
+	 */
+	class ItemBodyCache
+	{
+	public:
+		typedef void (*SerializeBodyFn)(OutBuffer &ob, const ItemData *item);
+
+		explicit ItemBodyCache(SerializeBodyFn serialize) : m_serialize(serialize) { }
+
+		const std::string &Get(const ItemData *item);
+		size_t Size() const { return m_bodies.size(); }
+		void Clear() { m_bodies.clear(); }
+
+		// called when the shared memory item table is remapped
+		static void Invalidate() { ++s_generation; }
+
+	private:
+		SerializeBodyFn                         m_serialize;
+		std::unordered_map<uint32, std::string> m_bodies;
+		uint32                                  m_generation = 0;
+
+		static std::atomic<uint32> s_generation;
+	};
+}
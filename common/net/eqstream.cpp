@@ -1,11 +1,20 @@
 #include "eqstream.h"
 #include "../eqemu_logsys.h"
 
-EQ::Net::EQStreamManager::EQStreamManager(const EQStreamManagerInterfaceOptions &options) : EQStreamManagerInterface(options), m_reliable_stream(options.reliable_stream_options)
+EQ::Net::EQStreamManager::EQStreamManager(const EQStreamManagerInterfaceOptions &options) : EQStreamManagerInterface(options)
 {
-	m_reliable_stream.OnNewConnection(std::bind(&EQStreamManager::ReliableStreamNewConnection, this, std::placeholders::_1));
-	m_reliable_stream.OnConnectionStateChange(std::bind(&EQStreamManager::ReliableStreamConnectionStateChange, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-	m_reliable_stream.OnPacketRecv(std::bind(&EQStreamManager::ReliableStreamPacketRecv, this, std::placeholders::_1, std::placeholders::_2));
+	if (options.network_thread) {
+		m_network_thread = std::make_unique<NetworkThread>(
+			options.reliable_stream_options,
+			std::bind(&EQStreamManager::HandleNetworkThreadEvent, this, std::placeholders::_1)
+		);
+		return;
+	}
+
+	m_reliable_stream = std::make_unique<ReliableStreamConnectionManager>(options.reliable_stream_options);
+	m_reliable_stream->OnNewConnection(std::bind(&EQStreamManager::ReliableStreamNewConnection, this, std::placeholders::_1));
+	m_reliable_stream->OnConnectionStateChange(std::bind(&EQStreamManager::ReliableStreamConnectionStateChange, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+	m_reliable_stream->OnPacketRecv(std::bind(&EQStreamManager::ReliableStreamPacketRecv, this, std::placeholders::_1, std::placeholders::_2));
 }
 
 EQ::Net::EQStreamManager::~EQStreamManager()
@@ -15,8 +24,12 @@ EQ::Net::EQStreamManager::~EQStreamManager()
 void EQ::Net::EQStreamManager::SetOptions(const EQStreamManagerInterfaceOptions &options)
 {
 	m_options = options;
-	auto &opts = m_reliable_stream.GetOptions();
-	opts = options.reliable_stream_options;
+
+	// a network thread keeps the reliable stream options it was started with
+	if (m_reliable_stream) {
+		auto &opts = m_reliable_stream->GetOptions();
+		opts = options.reliable_stream_options;
+	}
 }
 
 void EQ::Net::EQStreamManager::ReliableStreamNewConnection(std::shared_ptr<ReliableStreamConnection> connection)
@@ -53,10 +66,76 @@ void EQ::Net::EQStreamManager::ReliableStreamPacketRecv(std::shared_ptr<Reliable
 	}
 }
 
+void EQ::Net::EQStreamManager::HandleNetworkThreadEvent(NetworkThreadEvent &e)
+{
+	if (e.type == NetworkThreadEvent::NewConnection) {
+		std::shared_ptr<EQStream> stream(new EQStream(this, m_network_thread.get(), e.connection_id, e.endpoint, e.port));
+		stream->m_status = e.to;
+		stream->m_stats  = e.stats;
+		m_thread_streams.emplace(e.connection_id, stream);
+		if (m_on_new_connection) {
+			m_on_new_connection(stream);
+		}
+
+		return;
+	}
+
+	auto iter = m_thread_streams.find(e.connection_id);
+	if (iter == m_thread_streams.end()) {
+		return;
+	}
+
+	auto &stream = iter->second;
+	switch (e.type) {
+	case NetworkThreadEvent::StateChange:
+		// a locally closed stream does not go back to connected on a transition that was already in flight
+		if (!stream->m_closed || e.to == StatusDisconnected) {
+			stream->m_status = e.to;
+		}
+
+		stream->m_stats = e.stats;
+
+		if (m_on_connection_state_change) {
+			m_on_connection_state_change(stream, e.from, e.to);
+		}
+
+		if (e.to == EQ::Net::StatusDisconnected) {
+			m_thread_streams.erase(iter);
+		}
+		break;
+	case NetworkThreadEvent::PacketRecv:
+		stream->m_packet_queue.push_back(std::make_unique<EQ::Net::DynamicPacket>(std::move(e.packet)));
+		break;
+	case NetworkThreadEvent::StatsUpdate:
+		stream->m_stats = e.stats;
+		break;
+	default:
+		break;
+	}
+}
+
 EQ::Net::EQStream::EQStream(EQStreamManagerInterface *owner, std::shared_ptr<ReliableStreamConnection> connection)
 {
 	m_owner = owner;
 	m_connection = connection;
+	m_remote_endpoint = connection->RemoteEndpoint();
+	m_remote_port = connection->RemotePort();
+	m_network_thread = nullptr;
+	m_connection_id = 0;
+	m_status = StatusConnecting;
+	m_closed = false;
+	m_opcode_manager = nullptr;
+}
+
+EQ::Net::EQStream::EQStream(EQStreamManagerInterface *owner, NetworkThread *network_thread, uint64_t connection_id, const std::string &endpoint, int port)
+{
+	m_owner = owner;
+	m_remote_endpoint = endpoint;
+	m_remote_port = port;
+	m_network_thread = network_thread;
+	m_connection_id = connection_id;
+	m_status = StatusConnecting;
+	m_closed = false;
 	m_opcode_manager = nullptr;
 }
 
@@ -96,7 +175,10 @@ void EQ::Net::EQStream::QueuePacket(const EQApplicationPacket *p, bool ack_req)
 			break;
 		}
 
-		if (ack_req) {
+		if (m_network_thread) {
+			m_network_thread->Send(m_connection_id, out, ack_req);
+		}
+		else if (ack_req) {
 			m_connection->QueuePacket(out);
 		}
 		else {
@@ -142,16 +224,30 @@ EQApplicationPacket *EQ::Net::EQStream::PopPacket() {
 }
 
 void EQ::Net::EQStream::Close() {
+	if (m_network_thread) {
+		// mirrors ReliableStreamConnection::Close so callers see the stream closing right away
+		if (!m_closed) {
+			m_closed = true;
+			m_network_thread->Close(m_connection_id);
+		}
+
+		if (m_status != StatusDisconnected) {
+			m_status = StatusDisconnecting;
+		}
+
+		return;
+	}
+
 	m_connection->Close();
 }
 
 std::string EQ::Net::EQStream::GetRemoteAddr() const
 {
-	return m_connection->RemoteEndpoint();
+	return m_remote_endpoint;
 }
 
 uint32 EQ::Net::EQStream::GetRemoteIP() const {
-	return inet_addr(m_connection->RemoteEndpoint().c_str());
+	return inet_addr(m_remote_endpoint.c_str());
 }
 
 bool EQ::Net::EQStream::CheckState(EQStreamState state) {
@@ -194,23 +290,23 @@ EQStreamInterface::MatchState EQ::Net::EQStream::CheckSignature(const Signature
 		if (opcode == sig->first_eq_opcode) {
 			if (length == sig->first_length) {
 				LogF(Logs::General, Logs::Netcode, "[StreamIdentify] {0}:{1}: First opcode matched {2:#x} and length matched {3}",
-					m_connection->RemoteEndpoint(), m_connection->RemotePort(), sig->first_eq_opcode, length);
+					m_remote_endpoint, m_remote_port, sig->first_eq_opcode, length);
 				return MatchSuccessful;
 			}
 			else if (length == 0) {
 				LogF(Logs::General, Logs::Netcode, "[StreamIdentify] {0}:{1}: First opcode matched {2:#x} and length is ignored.",
-					m_connection->RemoteEndpoint(), m_connection->RemotePort(), sig->first_eq_opcode);
+					m_remote_endpoint, m_remote_port, sig->first_eq_opcode);
 				return MatchSuccessful;
 			}
 			else {
 				LogF(Logs::General, Logs::Netcode, "[StreamIdentify] {0}:{1}: First opcode matched {2:#x} but length {3} did not match expected {4}",
-					m_connection->RemoteEndpoint(), m_connection->RemotePort(), sig->first_eq_opcode, length, sig->first_length);
+					m_remote_endpoint, m_remote_port, sig->first_eq_opcode, length, sig->first_length);
 				return MatchFailed;
 			}
 		}
 		else {
 			LogF(Logs::General, Logs::Netcode, "[StreamIdentify] {0}:{1}: First opcode {1:#x} did not match expected {2:#x}",
-				m_connection->RemoteEndpoint(), m_connection->RemotePort(), opcode, sig->first_eq_opcode);
+				m_remote_endpoint, m_remote_port, opcode, sig->first_eq_opcode);
 			return MatchFailed;
 		}
 	}
@@ -219,7 +315,7 @@ EQStreamInterface::MatchState EQ::Net::EQStream::CheckSignature(const Signature
 }
 
 EQStreamState EQ::Net::EQStream::GetState() {
-	auto status = m_connection->GetStatus();
+	auto status = m_network_thread ? m_status : m_connection->GetStatus();
 	switch (status) {
 	case StatusConnecting:
 		return UNESTABLISHED;
@@ -235,7 +331,7 @@ EQStreamState EQ::Net::EQStream::GetState() {
 EQ::Net::EQStream::Stats EQ::Net::EQStream::GetStats() const
 {
 	Stats ret;
-	ret.ReliableStreamStats = m_connection->GetStats();
+	ret.ReliableStreamStats = m_network_thread ? m_stats : m_connection->GetStats();
 
 	for (int i = 0; i < _maxEmuOpcode; ++i) {
 		ret.RecvCount[i] = 0;
@@ -255,6 +351,12 @@ EQ::Net::EQStream::Stats EQ::Net::EQStream::GetStats() const
 
 void EQ::Net::EQStream::ResetStats()
 {
+	if (m_network_thread) {
+		m_stats.Reset();
+		m_network_thread->ResetStats(m_connection_id);
+		return;
+	}
+
 	m_connection->ResetStats();
 }
 
@@ -4,6 +4,7 @@
 #include "../eq_stream_intf.h"
 #include "../opcodemgr.h"
 #include "reliable_stream_connection.h"
+#include "network_thread.h"
 #include <vector>
 #include <deque>
 #include <unordered_map>
@@ -23,14 +24,18 @@ namespace EQ
 			void OnNewConnection(std::function<void(std::shared_ptr<EQStream>)> func) { m_on_new_connection = func; }
 			void OnConnectionStateChange(std::function<void(std::shared_ptr<EQStream>, DbProtocolStatus, DbProtocolStatus)> func) { m_on_connection_state_change = func; }
 		private:
-			ReliableStreamConnectionManager m_reliable_stream;
+			// exactly one of these is set, depending on EQStreamManagerInterfaceOptions::network_thread
+			std::unique_ptr<ReliableStreamConnectionManager> m_reliable_stream;
+			std::unique_ptr<NetworkThread> m_network_thread;
 			std::function<void(std::shared_ptr<EQStream>)> m_on_new_connection;
 			std::function<void(std::shared_ptr<EQStream>, DbProtocolStatus, DbProtocolStatus)> m_on_connection_state_change;
 			std::map<std::shared_ptr<ReliableStreamConnection>, std::shared_ptr<EQStream>> m_streams;
+			std::unordered_map<uint64_t, std::shared_ptr<EQStream>> m_thread_streams;
 
 			void ReliableStreamNewConnection(std::shared_ptr<ReliableStreamConnection> connection);
 			void ReliableStreamConnectionStateChange(std::shared_ptr<ReliableStreamConnection> connection, DbProtocolStatus from, DbProtocolStatus to);
 			void ReliableStreamPacketRecv(std::shared_ptr<ReliableStreamConnection> connection, const Packet &p);
+			void HandleNetworkThreadEvent(NetworkThreadEvent &e);
 			friend class EQStream;
 		};
 
@@ -38,6 +43,7 @@ namespace EQ
 		{
 		public:
 			EQStream(EQStreamManagerInterface *parent, std::shared_ptr<ReliableStreamConnection> connection);
+			EQStream(EQStreamManagerInterface *parent, NetworkThread *network_thread, uint64_t connection_id, const std::string &endpoint, int port);
 			~EQStream();
 
 			virtual void QueuePacket(const EQApplicationPacket *p, bool ack_req = true);
@@ -48,7 +54,7 @@ namespace EQ
 			virtual void RemoveData() { };
 			virtual std::string GetRemoteAddr() const;
 			virtual uint32 GetRemoteIP() const;
-			virtual uint16 GetRemotePort() const { return m_connection->RemotePort(); }
+			virtual uint16 GetRemotePort() const { return m_remote_port; }
 			virtual bool CheckState(EQStreamState state);
 			virtual std::string Describe() const { return "Direct EQStream"; }
 			virtual void SetActive(bool val) { }
@@ -68,6 +74,16 @@ namespace EQ
 		private:
 			EQStreamManagerInterface *m_owner;
 			std::shared_ptr<ReliableStreamConnection> m_connection;
+			std::string m_remote_endpoint;
+			int m_remote_port;
+
+			// when the connection lives on a network thread it is only known by id, state and stats are the last reported
+			NetworkThread *m_network_thread;
+			uint64_t m_connection_id;
+			DbProtocolStatus m_status;
+			bool m_closed;
+			ReliableStreamConnectionStats m_stats;
+
 			OpcodeManager **m_opcode_manager;
 			std::deque<std::unique_ptr<EQ::Net::Packet>> m_packet_queue;
 			std::unordered_map<int, int> m_packet_recv_count;
@@ -0,0 +1,246 @@
+#include "network_thread.h"
+#include "../event/event_loop.h"
+#include "../eqemu_logsys.h"
+#include <future>
+
+// sized for a full zone's worth of traffic between two owner frames, anything past this waits in the producer backlog
+constexpr size_t NETWORK_THREAD_EVENT_QUEUE_SIZE   = 8192;
+constexpr size_t NETWORK_THREAD_COMMAND_QUEUE_SIZE = 16384;
+constexpr size_t NETWORK_THREAD_BACKLOG_FLUSH_MS   = 10;
+constexpr size_t NETWORK_THREAD_STATS_INTERVAL_MS  = 1000;
+
+EQ::Net::NetworkThread::NetworkThread(
+	const ReliableStreamConnectionManagerOptions &opts,
+	std::function<void(NetworkThreadEvent &)> on_event
+) : m_on_event(std::move(on_event)),
+	m_commands(NETWORK_THREAD_COMMAND_QUEUE_SIZE),
+	m_events(NETWORK_THREAD_EVENT_QUEUE_SIZE)
+{
+	m_event_async = new uv_async_t;
+	memset(m_event_async, 0, sizeof(uv_async_t));
+	uv_async_init(EQ::EventLoop::Get().Handle(), m_event_async, [](uv_async_t *handle) {
+		static_cast<NetworkThread *>(handle->data)->DrainEvents();
+	});
+	m_event_async->data = this;
+
+	// a command backlog only builds up when the network thread is behind, hand it over once it catches up
+	m_command_flush_timer = std::make_unique<EQ::Timer>(
+		NETWORK_THREAD_BACKLOG_FLUSH_MS, true, [this](EQ::Timer *) {
+			if (m_commands.BacklogSize() > 0) {
+				m_commands.Flush();
+				uv_async_send(&m_command_async);
+			}
+		}
+	);
+
+	std::promise<void> ready;
+	auto               started = ready.get_future();
+
+	m_thread = std::thread(
+		[this, opts, ready = std::move(ready)]() mutable {
+			Run(opts, ready);
+		}
+	);
+
+	started.wait();
+
+	LogInfo("Network thread started for port [{}]", opts.port);
+}
+
+EQ::Net::NetworkThread::~NetworkThread()
+{
+	m_stopping = true;
+	uv_async_send(&m_command_async);
+	m_thread.join();
+
+	m_command_flush_timer.reset();
+
+	uv_close(reinterpret_cast<uv_handle_t *>(m_event_async), [](uv_handle_t *handle) {
+		delete reinterpret_cast<uv_async_t *>(handle);
+	});
+	m_event_async = nullptr;
+}
+
+void EQ::Net::NetworkThread::Send(uint64_t connection_id, DynamicPacket &p, bool reliable)
+{
+	NetworkThreadCommand c;
+	c.type          = NetworkThreadCommand::Send;
+	c.connection_id = connection_id;
+	c.packet        = std::move(p);
+	c.reliable      = reliable;
+	Push(c);
+}
+
+void EQ::Net::NetworkThread::Close(uint64_t connection_id)
+{
+	NetworkThreadCommand c;
+	c.type          = NetworkThreadCommand::Close;
+	c.connection_id = connection_id;
+	Push(c);
+}
+
+void EQ::Net::NetworkThread::ResetStats(uint64_t connection_id)
+{
+	NetworkThreadCommand c;
+	c.type          = NetworkThreadCommand::ResetStats;
+	c.connection_id = connection_id;
+	Push(c);
+}
+
+void EQ::Net::NetworkThread::Run(const ReliableStreamConnectionManagerOptions &opts, std::promise<void> &ready)
+{
+	// EventLoop::Get is per thread, everything created here lives on the network thread's loop
+	uv_async_init(EQ::EventLoop::Get().Handle(), &m_command_async, [](uv_async_t *handle) {
+		static_cast<NetworkThread *>(handle->data)->DrainCommands();
+	});
+	m_command_async.data = this;
+
+	m_manager = std::make_unique<ReliableStreamConnectionManager>(opts);
+
+	m_manager->OnNewConnection(
+		[this](std::shared_ptr<ReliableStreamConnection> connection) {
+			const uint64_t id = ++m_next_connection_id;
+			m_connections.emplace(id, connection);
+			m_connection_ids.emplace(connection.get(), id);
+
+			NetworkThreadEvent e;
+			e.type          = NetworkThreadEvent::NewConnection;
+			e.connection_id = id;
+			e.endpoint      = connection->RemoteEndpoint();
+			e.port          = connection->RemotePort();
+			e.to            = connection->GetStatus();
+			e.stats         = connection->GetStats();
+			Push(e);
+		}
+	);
+
+	m_manager->OnConnectionStateChange(
+		[this](std::shared_ptr<ReliableStreamConnection> connection, DbProtocolStatus from, DbProtocolStatus to) {
+			auto iter = m_connection_ids.find(connection.get());
+			if (iter == m_connection_ids.end()) {
+				return;
+			}
+
+			NetworkThreadEvent e;
+			e.type          = NetworkThreadEvent::StateChange;
+			e.connection_id = iter->second;
+			e.from          = from;
+			e.to            = to;
+			e.stats         = connection->GetStats();
+			Push(e);
+
+			if (to == StatusDisconnected) {
+				m_connections.erase(iter->second);
+				m_connection_ids.erase(iter);
+			}
+		}
+	);
+
+	m_manager->OnPacketRecv(
+		[this](std::shared_ptr<ReliableStreamConnection> connection, const Packet &p) {
+			auto iter = m_connection_ids.find(connection.get());
+			if (iter == m_connection_ids.end()) {
+				return;
+			}
+
+			NetworkThreadEvent e;
+			e.type          = NetworkThreadEvent::PacketRecv;
+			e.connection_id = iter->second;
+			e.packet.PutPacket(0, p);
+			Push(e);
+		}
+	);
+
+	m_last_stats = Clock::now();
+
+	auto tick_ms = static_cast<uint64_t>(1000.0 / opts.tic_rate_hertz);
+	m_tick_timer = std::make_unique<EQ::Timer>(
+		tick_ms, true, [this](EQ::Timer *) {
+			if (m_events.BacklogSize() > 0) {
+				m_events.Flush();
+				uv_async_send(m_event_async);
+			}
+
+			auto now = Clock::now();
+			if (std::chrono::duration_cast<std::chrono::milliseconds>(now - m_last_stats).count() >= NETWORK_THREAD_STATS_INTERVAL_MS) {
+				m_last_stats = now;
+				PublishStats();
+			}
+		}
+	);
+
+	ready.set_value();
+
+	EQ::EventLoop::Get().Run();
+
+	// every handle is closed by now, connections go before the manager that owns their socket
+	m_connection_ids.clear();
+	m_connections.clear();
+	m_manager.reset();
+}
+
+void EQ::Net::NetworkThread::Push(NetworkThreadCommand &c)
+{
+	m_commands.Push(c);
+	uv_async_send(&m_command_async);
+}
+
+void EQ::Net::NetworkThread::Push(NetworkThreadEvent &e)
+{
+	m_events.Push(e);
+	uv_async_send(m_event_async);
+}
+
+void EQ::Net::NetworkThread::DrainCommands()
+{
+	if (m_stopping) {
+		// closing the last handles lets the loop run dry and Run return
+		m_tick_timer.reset();
+		m_manager->CloseHandles();
+		uv_close(reinterpret_cast<uv_handle_t *>(&m_command_async), nullptr);
+		return;
+	}
+
+	NetworkThreadCommand c;
+	while (m_commands.Pop(c)) {
+		auto iter = m_connections.find(c.connection_id);
+		if (iter == m_connections.end()) {
+			continue;
+		}
+
+		switch (c.type) {
+			case NetworkThreadCommand::Send:
+				iter->second->QueuePacket(c.packet, 0, c.reliable);
+				break;
+			case NetworkThreadCommand::Close:
+				iter->second->Close();
+				break;
+			case NetworkThreadCommand::ResetStats:
+				iter->second->ResetStats();
+				break;
+		}
+	}
+}
+
+void EQ::Net::NetworkThread::DrainEvents()
+{
+	NetworkThreadEvent e;
+	while (m_events.Pop(e)) {
+		m_on_event(e);
+	}
+}
+
+void EQ::Net::NetworkThread::PublishStats()
+{
+	for (auto &c : m_connections) {
+		NetworkThreadEvent e;
+		e.type          = NetworkThreadEvent::StatsUpdate;
+		e.connection_id = c.first;
+		e.stats         = c.second->GetStats();
+		m_events.Push(e);
+	}
+
+	if (!m_connections.empty()) {
+		uv_async_send(m_event_async);
+	}
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "reliable_stream_connection.h"
+#include "spsc_queue.h"
+#include "../event/timer.h"
+#include <atomic>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <uv.h>
+
+namespace EQ
+{
+	namespace Net
+	{
+		// network thread to owner
+		struct NetworkThreadEvent
+		{
+			enum Type
+			{
+				NewConnection,
+				StateChange,
+				PacketRecv,
+				StatsUpdate
+			};
+
+			Type                          type          = NewConnection;
+			uint64_t                      connection_id = 0;
+			DbProtocolStatus              from          = StatusConnecting;
+			DbProtocolStatus              to            = StatusConnecting;
+			std::string                   endpoint;
+			int                           port          = 0;
+			DynamicPacket                 packet;
+			ReliableStreamConnectionStats stats;
+		};
+
+		// owner to network thread
+		struct NetworkThreadCommand
+		{
+			enum Type
+			{
+				Send,
+				Close,
+				ResetStats
+			};
+
+			Type          type          = Send;
+			uint64_t      connection_id = 0;
+			DynamicPacket packet;
+			bool          reliable      = true;
+		};
+
+		/**
+		 * Runs a ReliableStreamConnectionManager on its own thread and event loop
+		 *
+		 * Receive, decode, acks, resends, keepalives, encode and send all happen on the network thread, so their timing
+		 * does not depend on how long the owner's loop takes to come back around. Connections are known to the owner
+		 * by id only, everything crossing over goes through a pair of SPSC queues and the owner's events are
+		 * dispatched from its own event loop
+		 *
+		 * Stats reach the owner as snapshots, on every state change and once a second
+		 */
+		class NetworkThread
+		{
+		public:
+			NetworkThread(const ReliableStreamConnectionManagerOptions &opts, std::function<void(NetworkThreadEvent &)> on_event);
+			~NetworkThread();
+
+			// owner thread
+			void Send(uint64_t connection_id, DynamicPacket &p, bool reliable);
+			void Close(uint64_t connection_id);
+			void ResetStats(uint64_t connection_id);
+
+		private:
+			void Run(const ReliableStreamConnectionManagerOptions &opts, std::promise<void> &ready);
+			void Push(NetworkThreadCommand &c);
+			void Push(NetworkThreadEvent &e);
+			void DrainCommands();
+			void DrainEvents();
+			void PublishStats();
+
+			std::thread                               m_thread;
+			std::atomic_bool                          m_stopping{false};
+			std::function<void(NetworkThreadEvent &)> m_on_event;
+
+			// owner side
+			uv_async_t                      *m_event_async = nullptr;
+			std::unique_ptr<EQ::Timer>      m_command_flush_timer;
+			SPSCQueue<NetworkThreadCommand> m_commands;
+
+			// network thread side
+			uv_async_t                                                               m_command_async{};
+			std::unique_ptr<ReliableStreamConnectionManager>                         m_manager;
+			std::unique_ptr<EQ::Timer>                                               m_tick_timer;
+			SPSCQueue<NetworkThreadEvent>                                            m_events;
+			uint64_t                                                                 m_next_connection_id = 0;
+			Timestamp                                                                m_last_stats;
+			std::unordered_map<uint64_t, std::shared_ptr<ReliableStreamConnection>> m_connections;
+			std::unordered_map<const ReliableStreamConnection *, uint64_t>           m_connection_ids;
+		};
+	}
+}
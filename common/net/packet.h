@@ -115,6 +115,7 @@ namespace EQ {
 			DynamicPacket(DynamicPacket &&o) noexcept { m_data = std::move(o.m_data); }
 			DynamicPacket(const DynamicPacket &o) { m_data = o.m_data; }
 			DynamicPacket& operator=(const DynamicPacket &o) { m_data = o.m_data; return *this; }
+			DynamicPacket& operator=(DynamicPacket &&o) noexcept { m_data = std::move(o.m_data); return *this; }
 
 			virtual const void *Data() const { return &m_data[0]; }
 			virtual void *Data() { return &m_data[0]; }
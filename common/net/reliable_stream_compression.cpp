@@ -0,0 +1,280 @@
+#include "reliable_stream_compression.h"
+#include "reliable_stream_connection.h"
+#include <zlib.h>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+EQ::Net::ReliableStreamCompressionClass EQ::Net::GetCompressionClass(const uint8_t *data, size_t length)
+{
+	// anything that does not start with a zero byte is a raw app packet
+	if (length < 2 || data[0] != 0) {
+		return CompressionClassOther;
+	}
+
+	switch (data[1]) {
+		case OP_Packet:
+		case OP_Packet2:
+		case OP_Packet3:
+		case OP_Packet4:
+			return CompressionClassPacket;
+		case OP_Fragment:
+		case OP_Fragment2:
+		case OP_Fragment3:
+		case OP_Fragment4:
+			return CompressionClassFragment;
+		case OP_Combined:
+		case OP_AppCombined:
+			return CompressionClassCombined;
+		default:
+			return CompressionClassOther;
+	}
+}
+
+const char *EQ::Net::GetCompressionClassName(int compression_class)
+{
+	switch (compression_class) {
+		case CompressionClassPacket:
+			return "packet";
+		case CompressionClassFragment:
+			return "fragment";
+		case CompressionClassCombined:
+			return "combined";
+		case CompressionClassOther:
+			return "other";
+		default:
+			return "unknown";
+	}
+}
+
+bool EQ::Net::ParseCompressionPolicy(
+	const std::string &s,
+	ReliableStreamCompressionPolicy (&policies)[CompressionClassCount]
+)
+{
+	ReliableStreamCompressionPolicy parsed[CompressionClassCount];
+	for (int i = 0; i < CompressionClassCount; ++i) {
+		parsed[i] = policies[i];
+	}
+
+	std::stringstream ss(s);
+	std::string       entry;
+	while (std::getline(ss, entry, ',')) {
+		if (entry.empty()) {
+			continue;
+		}
+
+		auto first  = entry.find(':');
+		auto second = first == std::string::npos ? std::string::npos : entry.find(':', first + 1);
+		if (second == std::string::npos) {
+			return false;
+		}
+
+		const auto name     = entry.substr(0, first);
+		const auto level    = entry.substr(first + 1, second - first - 1);
+		const auto min_size = entry.substr(second + 1);
+
+		int c = 0;
+		for (; c < CompressionClassCount; ++c) {
+			if (name == GetCompressionClassName(c)) {
+				break;
+			}
+		}
+
+		if (c == CompressionClassCount || level.empty() || min_size.empty()) {
+			return false;
+		}
+
+		char *end = nullptr;
+		long l = strtol(level.c_str(), &end, 10);
+		if (*end != 0 || l < 0 || l > Z_BEST_COMPRESSION) {
+			return false;
+		}
+
+		unsigned long m = strtoul(min_size.c_str(), &end, 10);
+		if (*end != 0) {
+			return false;
+		}
+
+		parsed[c].level    = static_cast<int>(l);
+		parsed[c].min_size = static_cast<size_t>(m);
+	}
+
+	for (int i = 0; i < CompressionClassCount; ++i) {
+		policies[i] = parsed[i];
+	}
+
+	return true;
+}
+
+namespace {
+	// one deflate stream per level since changing the level of a live stream with deflateParams can flush output
+	struct DeflateContexts
+	{
+		z_stream stream[Z_BEST_COMPRESSION + 1];
+		bool     ready[Z_BEST_COMPRESSION + 1] = { false };
+
+		~DeflateContexts() {
+			for (int i = 0; i <= Z_BEST_COMPRESSION; ++i) {
+				if (ready[i]) {
+					deflateEnd(&stream[i]);
+				}
+			}
+		}
+
+		z_stream *Get(int level) {
+			if (!ready[level]) {
+				memset(&stream[level], 0, sizeof(z_stream));
+				if (deflateInit(&stream[level], level) != Z_OK) {
+					return nullptr;
+				}
+
+				ready[level] = true;
+				return &stream[level];
+			}
+
+			if (deflateReset(&stream[level]) != Z_OK) {
+				return nullptr;
+			}
+
+			return &stream[level];
+		}
+	};
+
+	struct InflateContext
+	{
+		z_stream stream;
+		bool     ready = false;
+
+		~InflateContext() {
+			if (ready) {
+				inflateEnd(&stream);
+			}
+		}
+
+		z_stream *Get() {
+			if (!ready) {
+				memset(&stream, 0, sizeof(z_stream));
+				if (inflateInit2(&stream, 15) != Z_OK) {
+					return nullptr;
+				}
+
+				ready = true;
+				return &stream;
+			}
+
+			if (inflateReset(&stream) != Z_OK) {
+				return nullptr;
+			}
+
+			return &stream;
+		}
+	};
+}
+
+uint32_t EQ::Net::DeflatePacket(const uint8_t *in, uint32_t in_len, uint8_t *out, uint32_t out_len, int level)
+{
+	if (!in || level < Z_BEST_SPEED || level > Z_BEST_COMPRESSION) {
+		return 0;
+	}
+
+	static thread_local DeflateContexts contexts;
+
+	z_stream *zstream = contexts.Get(level);
+	if (!zstream) {
+		return 0;
+	}
+
+	zstream->next_in   = const_cast<unsigned char *>(in);
+	zstream->avail_in  = in_len;
+	zstream->next_out  = out;
+	zstream->avail_out = out_len;
+
+	if (deflate(zstream, Z_FINISH) != Z_STREAM_END) {
+		return 0;
+	}
+
+	return static_cast<uint32_t>(zstream->total_out);
+}
+
+uint32_t EQ::Net::InflatePacket(const uint8_t *in, uint32_t in_len, uint8_t *out, uint32_t out_len)
+{
+	if (!in) {
+		return 0;
+	}
+
+	static thread_local InflateContext context;
+
+	z_stream *zstream = context.Get();
+	if (!zstream) {
+		return 0;
+	}
+
+	zstream->next_in   = const_cast<unsigned char *>(in);
+	zstream->avail_in  = in_len;
+	zstream->next_out  = out;
+	zstream->avail_out = out_len;
+
+	if (inflate(zstream, Z_FINISH) != Z_STREAM_END) {
+		return 0;
+	}
+
+	return static_cast<uint32_t>(zstream->total_out);
+}
+
+uint32_t EQ::Net::DeflatePacketOneShot(const uint8_t *in, uint32_t in_len, uint8_t *out, uint32_t out_len, int level)
+{
+	if (!in) {
+		return 0;
+	}
+
+	z_stream zstream;
+	memset(&zstream, 0, sizeof(zstream));
+
+	zstream.next_in  = const_cast<unsigned char *>(in);
+	zstream.avail_in = in_len;
+	zstream.opaque   = Z_NULL;
+
+	if (deflateInit(&zstream, level) != Z_OK) {
+		return 0;
+	}
+
+	zstream.next_out  = out;
+	zstream.avail_out = out_len;
+
+	if (deflate(&zstream, Z_FINISH) == Z_STREAM_END) {
+		deflateEnd(&zstream);
+		return static_cast<uint32_t>(zstream.total_out);
+	}
+
+	deflateEnd(&zstream);
+	return 0;
+}
+
+uint32_t EQ::Net::InflatePacketOneShot(const uint8_t *in, uint32_t in_len, uint8_t *out, uint32_t out_len)
+{
+	if (!in) {
+		return 0;
+	}
+
+	z_stream zstream;
+	memset(&zstream, 0, sizeof(zstream));
+
+	zstream.next_in   = const_cast<unsigned char *>(in);
+	zstream.avail_in  = in_len;
+	zstream.next_out  = out;
+	zstream.avail_out = out_len;
+	zstream.opaque    = Z_NULL;
+
+	if (inflateInit2(&zstream, 15) != Z_OK) {
+		return 0;
+	}
+
+	if (inflate(&zstream, Z_FINISH) == Z_STREAM_END) {
+		inflateEnd(&zstream);
+		return static_cast<uint32_t>(zstream.total_out);
+	}
+
+	inflateEnd(&zstream);
+	return 0;
+}
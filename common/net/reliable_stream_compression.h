@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace EQ
+{
+	namespace Net
+	{
+		// outgoing packets are grouped by their protocol opcode, each group has its own compression policy
+		enum ReliableStreamCompressionClass
+		{
+			CompressionClassPacket = 0, // OP_Packet..OP_Packet4, a single reliable app packet
+			CompressionClassFragment,   // OP_Fragment..OP_Fragment4, pieces of a large app packet
+			CompressionClassCombined,   // OP_Combined and OP_AppCombined, batches of small packets
+			CompressionClassOther,      // acks, keepalives and unsequenced app packets
+			CompressionClassCount
+		};
+
+		struct ReliableStreamCompressionPolicy
+		{
+			int    level    = 1;  // zlib level, 0 sends the payload stored without trying to compress it
+			size_t min_size = 31; // payloads shorter than this are always sent stored
+		};
+
+		ReliableStreamCompressionClass GetCompressionClass(const uint8_t *data, size_t length);
+		const char *GetCompressionClassName(int compression_class);
+
+		// "class:level:min_size" entries separated by commas, e.g. "packet:1:31,fragment:4:64", unlisted classes are
+		// left as they are. returns false and leaves policies untouched on a malformed entry
+		bool ParseCompressionPolicy(const std::string &s, ReliableStreamCompressionPolicy (&policies)[CompressionClassCount]);
+
+		// zlib streams kept per thread and reset between packets, returns the output length or 0 on failure
+		uint32_t DeflatePacket(const uint8_t *in, uint32_t in_len, uint8_t *out, uint32_t out_len, int level);
+		uint32_t InflatePacket(const uint8_t *in, uint32_t in_len, uint8_t *out, uint32_t out_len);
+
+		// the same with a stream set up and torn down for every call, kept for benchmarking against
+		uint32_t DeflatePacketOneShot(const uint8_t *in, uint32_t in_len, uint8_t *out, uint32_t out_len, int level);
+		uint32_t InflatePacketOneShot(const uint8_t *in, uint32_t in_len, uint8_t *out, uint32_t out_len);
+	}
+}
@@ -1,20 +1,25 @@
 #include "reliable_stream_connection.h"
 #include "../event/event_loop.h"
 #include "../data_verification.h"
+#include "../eqemu_logsys.h"
 #include "crc32.h"
-#include <zlib.h>
 #include <fmt/format.h>
 
 // observed client receive window is 300 packets, 140KB
 constexpr size_t MAX_CLIENT_RECV_PACKETS_PER_WINDOW = 300;
 constexpr size_t MAX_CLIENT_RECV_BYTES_PER_WINDOW   = 140 * 1024;
 
-// buffer pools
-SendBufferPool send_buffer_pool;
+// buffer pools, one per thread since sends complete on the loop of the thread that issued them
+thread_local SendBufferPool send_buffer_pool;
+
+// datagrams per recvmmsg batch, libuv caps this at 20
+constexpr size_t RECV_MMSG_BATCH = 16;
 
 EQ::Net::ReliableStreamConnectionManager::ReliableStreamConnectionManager()
 {
 	m_attached = nullptr;
+	m_compression_capture = nullptr;
+	m_compression_capture_left = 0;
 	memset(&m_timer, 0, sizeof(uv_timer_t));
 	memset(&m_socket, 0, sizeof(uv_udp_t));
 
@@ -25,15 +30,22 @@ EQ::Net::ReliableStreamConnectionManager::ReliableStreamConnectionManager(const
 {
 	m_attached = nullptr;
 	m_options = opts;
+	m_compression_capture = nullptr;
+	m_compression_capture_left = 0;
 	memset(&m_timer, 0, sizeof(uv_timer_t));
 	memset(&m_socket, 0, sizeof(uv_udp_t));
 
+	OpenCompressionCapture();
 	Attach(EQ::EventLoop::Get().Handle());
 }
 
 EQ::Net::ReliableStreamConnectionManager::~ReliableStreamConnectionManager()
 {
 	Detach();
+
+	if (m_compression_capture) {
+		fclose(m_compression_capture);
+	}
 }
 
 void EQ::Net::ReliableStreamConnectionManager::Attach(uv_loop_t *loop)
@@ -51,7 +63,17 @@ void EQ::Net::ReliableStreamConnectionManager::Attach(uv_loop_t *loop)
 			c->ProcessResend();
 		}, update_rate, update_rate);
 
+#if defined(__linux__) && UV_VERSION_HEX >= 0x012800
+		if (m_options.recv_mmsg) {
+			uv_udp_init_ex(loop, &m_socket, AF_UNSPEC | UV_UDP_RECVMMSG);
+			m_recv_pool.resize(UDP_RECV_BUFFER_SIZE * RECV_MMSG_BATCH);
+		}
+		else {
+			uv_udp_init(loop, &m_socket);
+		}
+#else
 		uv_udp_init(loop, &m_socket);
+#endif
 		m_socket.data = this;
 		struct sockaddr_in recv_addr;
 		uv_ip4_addr("0.0.0.0", m_options.port, &recv_addr);
@@ -60,30 +82,25 @@ void EQ::Net::ReliableStreamConnectionManager::Attach(uv_loop_t *loop)
 		rc = uv_udp_recv_start(
 			&m_socket,
 			[](uv_handle_t *handle, size_t suggested_size, uv_buf_t *buf) {
-				if (suggested_size > 65536) {
-					buf->base = new char[suggested_size];
-					buf->len  = suggested_size;
-					return;
-				}
+				ReliableStreamConnectionManager *c = (ReliableStreamConnectionManager*)handle->data;
 
-				static thread_local char temp_buf[65536];
-				buf->base = temp_buf;
-				buf->len  = 65536;
+				buf->base = c->m_recv_pool.acquire();
+				buf->len  = c->m_recv_pool.buffer_size();
 			},
 			[](uv_udp_t* handle, ssize_t nread, const uv_buf_t* buf, const struct sockaddr* addr, unsigned flags) {
 			ReliableStreamConnectionManager *c = (ReliableStreamConnectionManager*)handle->data;
-			if (nread < 0 || addr == nullptr) {
-				return;
+			if (nread >= 0 && addr != nullptr) {
+				c->ProcessPacket(*(const sockaddr_in*)addr, buf->base, nread);
 			}
 
-			char endpoint[16];
-			uv_ip4_name((const sockaddr_in*)addr, endpoint, 16);
-			auto port = ntohs(((const sockaddr_in*)addr)->sin_port);
-			c->ProcessPacket(endpoint, port, buf->base, nread);
-
-			if (buf->len > 65536) {
-				delete[] buf->base;
+#if UV_VERSION_HEX >= 0x012800
+			// recvmmsg delivers each datagram as a chunk of one buffer and frees it with a final UV_UDP_MMSG_FREE call
+			if (flags & UV_UDP_MMSG_CHUNK) {
+				return;
 			}
+#endif
+
+			c->m_recv_pool.release(buf->base);
 		});
 
 		m_attached = loop;
@@ -99,6 +116,59 @@ void EQ::Net::ReliableStreamConnectionManager::Detach()
 	}
 }
 
+void EQ::Net::ReliableStreamConnectionManager::CloseHandles()
+{
+	if (m_attached) {
+		uv_udp_recv_stop(&m_socket);
+		uv_timer_stop(&m_timer);
+		uv_close((uv_handle_t *)&m_socket, nullptr);
+		uv_close((uv_handle_t *)&m_timer, nullptr);
+		m_attached = nullptr;
+	}
+}
+
+void EQ::Net::ReliableStreamConnectionManager::OpenCompressionCapture()
+{
+	if (m_options.compression_capture_file.empty() || m_options.compression_capture_packets == 0) {
+		return;
+	}
+
+	m_compression_capture = fopen(m_options.compression_capture_file.c_str(), "ab");
+	if (!m_compression_capture) {
+		LogError("Unable to open compression capture file [{}]", m_options.compression_capture_file);
+		return;
+	}
+
+	m_compression_capture_left = m_options.compression_capture_packets;
+
+	LogInfo(
+		"Capturing up to [{}] outgoing payloads to [{}]",
+		m_compression_capture_left,
+		m_options.compression_capture_file
+	);
+}
+
+void EQ::Net::ReliableStreamConnectionManager::CaptureCompressionPayload(int compression_class, const uint8_t *data, size_t length)
+{
+	// records are a little endian uint32 length, the compression class and the payload as it was before compression
+	uint8_t header[5] = {
+		static_cast<uint8_t>(length & 0xff),
+		static_cast<uint8_t>((length >> 8) & 0xff),
+		static_cast<uint8_t>((length >> 16) & 0xff),
+		static_cast<uint8_t>((length >> 24) & 0xff),
+		static_cast<uint8_t>(compression_class)
+	};
+
+	fwrite(header, 1, sizeof(header), m_compression_capture);
+	fwrite(data, 1, length, m_compression_capture);
+
+	if (--m_compression_capture_left == 0) {
+		fclose(m_compression_capture);
+		m_compression_capture = nullptr;
+		LogInfo("Compression capture to [{}] is complete", m_options.compression_capture_file);
+	}
+}
+
 void EQ::Net::ReliableStreamConnectionManager::Connect(const std::string &addr, int port)
 {
 	//todo dns resolution
@@ -110,7 +180,7 @@ void EQ::Net::ReliableStreamConnectionManager::Connect(const std::string &addr,
 		m_on_new_connection(connection);
 	}
 
-	m_connections.emplace(std::make_pair(std::make_pair(addr, port), connection));
+	m_connections.emplace(EndpointKey(connection->m_remote_addr), connection);
 }
 
 void EQ::Net::ReliableStreamConnectionManager::Process()
@@ -217,7 +287,7 @@ void EQ::Net::ReliableStreamConnectionManager::ProcessResend()
 	}
 }
 
-void EQ::Net::ReliableStreamConnectionManager::ProcessPacket(const std::string &endpoint, int port, const char *data, size_t size)
+void EQ::Net::ReliableStreamConnectionManager::ProcessPacket(const sockaddr_in &addr, const char *data, size_t size)
 {
 	if (m_options.simulated_in_packet_loss && m_options.simulated_in_packet_loss >= m_rand.Int(0, 100)) {
 		return;
@@ -231,8 +301,10 @@ void EQ::Net::ReliableStreamConnectionManager::ProcessPacket(const std::string &
 	}
 
 	try {
-		auto connection = FindConnectionByEndpoint(endpoint, port);
-		if (connection) {
+		auto iter = m_connections.find(EndpointKey(addr));
+		if (iter != m_connections.end()) {
+			auto connection = iter->second;
+
 			StaticPacket p((void*)data, size);
 			connection->ProcessPacket(p);
 		}
@@ -241,17 +313,21 @@ void EQ::Net::ReliableStreamConnectionManager::ProcessPacket(const std::string &
 				StaticPacket p((void*)data, size);
 				auto request = p.GetSerialize<ReliableStreamConnect>(0);
 
-				connection = std::shared_ptr<ReliableStreamConnection>(new ReliableStreamConnection(this, request, endpoint, port));
+				// only new sessions pay for turning the address into a string
+				char endpoint[16];
+				uv_ip4_name(&addr, endpoint, 16);
+
+				auto connection = std::shared_ptr<ReliableStreamConnection>(new ReliableStreamConnection(this, request, endpoint, ntohs(addr.sin_port)));
 				connection->m_self = connection;
 
 				if (m_on_new_connection) {
 					m_on_new_connection(connection);
 				}
-				m_connections.emplace(std::make_pair(std::make_pair(endpoint, port), connection));
+				m_connections.emplace(EndpointKey(addr), connection);
 				connection->ProcessPacket(p);
 			}
 			else if (data[1] != OP_OutOfSession) {
-				SendDisconnect(endpoint, port);
+				SendDisconnect(addr);
 			}
 		}
 	}
@@ -264,8 +340,10 @@ void EQ::Net::ReliableStreamConnectionManager::ProcessPacket(const std::string &
 
 std::shared_ptr<EQ::Net::ReliableStreamConnection> EQ::Net::ReliableStreamConnectionManager::FindConnectionByEndpoint(std::string addr, int port)
 {
-	auto p = std::make_pair(addr, port);
-	auto iter = m_connections.find(p);
+	sockaddr_in a{};
+	uv_ip4_addr(addr.c_str(), port, &a);
+
+	auto iter = m_connections.find(EndpointKey(a));
 	if (iter != m_connections.end()) {
 		return iter->second;
 	}
@@ -273,7 +351,7 @@ std::shared_ptr<EQ::Net::ReliableStreamConnection> EQ::Net::ReliableStreamConnec
 	return nullptr;
 }
 
-void EQ::Net::ReliableStreamConnectionManager::SendDisconnect(const std::string &addr, int port)
+void EQ::Net::ReliableStreamConnectionManager::SendDisconnect(const sockaddr_in &addr)
 {
 	ReliableStreamDisconnect header;
 	header.zero = 0;
@@ -284,8 +362,7 @@ void EQ::Net::ReliableStreamConnectionManager::SendDisconnect(const std::string
 	out.PutSerialize(0, header);
 
 	uv_udp_send_t *send_req = new uv_udp_send_t;
-	sockaddr_in send_addr;
-	uv_ip4_addr(addr.c_str(), port, &send_addr);
+	sockaddr_in send_addr = addr;
 	uv_buf_t send_buffers[1];
 
 	char *data = new char[out.Length()];
@@ -308,6 +385,7 @@ EQ::Net::ReliableStreamConnection::ReliableStreamConnection(ReliableStreamConnec
 	m_status = StatusConnected;
 	m_endpoint = endpoint;
 	m_port = port;
+	uv_ip4_addr(m_endpoint.c_str(), m_port, &m_remote_addr);
 	m_connect_code = NetworkToHost(connect.connect_code);
 	m_encode_key = m_owner->m_rand.Int(std::numeric_limits<uint32_t>::min(), std::numeric_limits<uint32_t>::max());
 	m_max_packet_size = (uint32_t)std::min(owner->m_options.max_packet_size, (size_t)NetworkToHost(connect.max_packet_size));
@@ -335,6 +413,7 @@ EQ::Net::ReliableStreamConnection::ReliableStreamConnection(ReliableStreamConnec
 	m_status = StatusConnecting;
 	m_endpoint = endpoint;
 	m_port = port;
+	uv_ip4_addr(m_endpoint.c_str(), m_port, &m_remote_addr);
 	m_connect_code = m_owner->m_rand.Int(std::numeric_limits<uint32_t>::min(), std::numeric_limits<uint32_t>::max());
 	m_encode_key = 0;
 	m_max_packet_size = (uint32_t)owner->m_options.max_packet_size;
@@ -981,75 +1060,6 @@ void EQ::Net::ReliableStreamConnection::Encode(Packet &p, size_t offset, size_t
 	}
 }
 
-uint32_t Inflate(const uint8_t* in, uint32_t in_len, uint8_t* out, uint32_t out_len) {
-	if (!in) {
-		return 0;
-	}
-
-	z_stream zstream;
-	memset(&zstream, 0, sizeof(zstream));
-	int zerror = 0;
-	int i;
-
-	zstream.next_in = const_cast<unsigned char *>(in);
-	zstream.avail_in = in_len;
-	zstream.next_out = out;
-	zstream.avail_out = out_len;
-	zstream.opaque = Z_NULL;
-
-	i = inflateInit2(&zstream, 15);
-
-	if (i != Z_OK) {
-		return 0;
-	}
-
-	zerror = inflate(&zstream, Z_FINISH);
-
-	if (zerror == Z_STREAM_END) {
-		inflateEnd(&zstream);
-		return zstream.total_out;
-	}
-	else {
-		if (zerror == Z_MEM_ERROR && !zstream.msg)
-		{
-			return 0;
-		}
-
-		zerror = inflateEnd(&zstream);
-		return 0;
-	}
-}
-
-uint32_t Deflate(const uint8_t* in, uint32_t in_len, uint8_t* out, uint32_t out_len) {
-	if (!in) {
-		return 0;
-	}
-
-	z_stream zstream;
-	memset(&zstream, 0, sizeof(zstream));
-	int zerror;
-
-	zstream.next_in = const_cast<unsigned char *>(in);
-	zstream.avail_in = in_len;
-	zstream.opaque = Z_NULL;
-
-	deflateInit(&zstream, Z_BEST_SPEED);
-	zstream.next_out = out;
-	zstream.avail_out = out_len;
-
-	zerror = deflate(&zstream, Z_FINISH);
-
-	if (zerror == Z_STREAM_END)
-	{
-		deflateEnd(&zstream);
-		return zstream.total_out;
-	}
-	else {
-		zerror = deflateEnd(&zstream);
-		return 0;
-	}
-}
-
 void EQ::Net::ReliableStreamConnection::Decompress(Packet &p, size_t offset, size_t length)
 {
 	if (length < 2) {
@@ -1061,7 +1071,9 @@ void EQ::Net::ReliableStreamConnection::Decompress(Packet &p, size_t offset, siz
 	uint32_t new_length = 0;
 
 	if (buffer[0] == 0x5a) {
-		new_length = Inflate(buffer + 1, (uint32_t)length - 1, new_buffer, 4096);
+		auto start = Clock::now();
+		new_length = InflatePacket(buffer + 1, (uint32_t)length - 1, new_buffer, 4096);
+		m_stats.decompress_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
 	}
 	else if (buffer[0] == 0xa5) {
 		memcpy(new_buffer, buffer + 1, length - 1);
@@ -1082,15 +1094,34 @@ void EQ::Net::ReliableStreamConnection::Compress(Packet &p, size_t offset, size_
 	uint32_t new_length = 0;
 	bool send_uncompressed = true;
 
-	if (length > 30) {
-		new_length = Deflate(buffer, (uint32_t)length, new_buffer + 1, 2048) + 1;
-		new_buffer[0] = 0x5a;
-		send_uncompressed = (new_length > length);
+	auto compression_class = GetCompressionClass((const uint8_t*)p.Data(), p.Length());
+	auto &policy = m_owner->m_options.compression_policy[compression_class];
+
+	if (m_owner->m_compression_capture) {
+		m_owner->CaptureCompressionPayload(compression_class, buffer, length);
 	}
+
+	if (policy.level > 0 && length >= policy.min_size) {
+		auto start = Clock::now();
+		new_length = DeflatePacket(buffer, (uint32_t)length, new_buffer + 1, sizeof(new_buffer) - 1, policy.level);
+		m_stats.compress_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+		m_stats.compress_bytes_in += length;
+
+		// a failed deflate returns 0 and goes out stored
+		send_uncompressed = new_length == 0 || new_length + 1 > length;
+		if (!send_uncompressed) {
+			new_buffer[0] = 0x5a;
+			new_length += 1;
+			m_stats.compressed_packets++;
+			m_stats.compress_bytes_saved += length - new_length;
+		}
+	}
+
 	if (send_uncompressed) {
 		memcpy(new_buffer + 1, buffer, length);
 		new_buffer[0] = 0xa5;
 		new_length = length + 1;
+		m_stats.compress_skipped++;
 	}
 
 	p.Resize(offset);
@@ -1395,8 +1426,6 @@ void EQ::Net::ReliableStreamConnection::InternalSend(Packet &p) {
 	auto [send_req, data, ctx] = *pooled_opt;
 	ctx->pool = &send_buffer_pool; // set pool pointer
 
-	sockaddr_in send_addr{};
-	uv_ip4_addr(m_endpoint.c_str(), m_port, &send_addr);
 	uv_buf_t send_buffers[1];
 
 	if (PacketCanBeEncoded(p)) {
@@ -1444,7 +1473,7 @@ void EQ::Net::ReliableStreamConnection::InternalSend(Packet &p) {
 	}
 
 	int send_result = uv_udp_send(
-		send_req, &m_owner->m_socket, send_buffers, 1, (sockaddr *)&send_addr,
+		send_req, &m_owner->m_socket, send_buffers, 1, (const sockaddr *)&m_remote_addr,
 		[](uv_udp_send_t *req, int status) {
 			auto *ctx = reinterpret_cast<EmbeddedContext *>(req->data);
 			if (!ctx) {
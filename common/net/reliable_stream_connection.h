@@ -4,11 +4,14 @@
 #include "packet.h"
 #include "reliable_stream_structs.h"
 #include "reliable_stream_pooling.h"
+#include "reliable_stream_compression.h"
 #include <uv.h>
 #include <chrono>
+#include <cstdio>
 #include <functional>
 #include <memory>
 #include <map>
+#include <unordered_map>
 #include <queue>
 #include <list>
 
@@ -94,6 +97,12 @@ namespace EQ
 				datarate_remaining = 0.0;
 				bytes_after_decode = 0;
 				bytes_before_encode = 0;
+				compressed_packets = 0;
+				compress_skipped = 0;
+				compress_bytes_in = 0;
+				compress_bytes_saved = 0;
+				compress_ns = 0;
+				decompress_ns = 0;
 			}
 
 			void Reset() {
@@ -110,6 +119,12 @@ namespace EQ
 				datarate_remaining = 0.0;
 				bytes_after_decode = 0;
 				bytes_before_encode = 0;
+				compressed_packets = 0;
+				compress_skipped = 0;
+				compress_bytes_in = 0;
+				compress_bytes_saved = 0;
+				compress_ns = 0;
+				decompress_ns = 0;
 			}
 
 			uint64_t recv_bytes;
@@ -132,6 +147,12 @@ namespace EQ
 			double datarate_remaining;
 			uint64_t bytes_after_decode;
 			uint64_t bytes_before_encode;
+			uint64_t compressed_packets;   //sent with 0x5a, deflate made them smaller
+			uint64_t compress_skipped;     //sent stored with 0xa5, either by policy or because deflate did not help
+			uint64_t compress_bytes_in;    //payload bytes handed to deflate
+			uint64_t compress_bytes_saved; //payload bytes deflate took off the packets it was kept for
+			uint64_t compress_ns;
+			uint64_t decompress_ns;
 		};
 
 		class ReliableStreamConnectionManager;
@@ -163,6 +184,7 @@ namespace EQ
 			ReliableStreamConnectionManager *m_owner;
 			std::string m_endpoint;
 			int m_port;
+			sockaddr_in m_remote_addr; // resolved once from m_endpoint / m_port for sends
 			uint32_t m_connect_code;
 			uint32_t m_encode_key;
 			uint32_t m_max_packet_size;
@@ -279,6 +301,8 @@ namespace EQ
 				resend_timeout = 30000;
 				connection_close_time = 2000;
 				outgoing_data_rate = 0.0;
+				recv_mmsg = false;
+				compression_capture_packets = 20000;
 			}
 
 			size_t max_packet_size;
@@ -302,6 +326,10 @@ namespace EQ
 			ReliableStreamEncodeType encode_passes[2];
 			int port;
 			double outgoing_data_rate;
+			bool recv_mmsg; // read datagrams in batches with recvmmsg where libuv supports it
+			ReliableStreamCompressionPolicy compression_policy[CompressionClassCount]; // indexed by ReliableStreamCompressionClass
+			std::string compression_capture_file; // when set, payloads are appended here before compression for benchmark:compression
+			size_t compression_capture_packets; // stop capturing after this many payloads
 		};
 
 		class ReliableStreamConnectionManager
@@ -321,6 +349,9 @@ namespace EQ
 			void OnErrorMessage(std::function<void(const std::string&)> func) { m_on_error_message = func; }
 
 			ReliableStreamConnectionManagerOptions& GetOptions() { return m_options; }
+
+			// closes the socket and timer for good, the manager has to outlive the loop iteration that finishes the close
+			void CloseHandles();
 		private:
 			void Attach(uv_loop_t *loop);
 			void Detach();
@@ -334,11 +365,19 @@ namespace EQ
 			std::function<void(std::shared_ptr<ReliableStreamConnection>, DbProtocolStatus, DbProtocolStatus)> m_on_connection_state_change;
 			std::function<void(std::shared_ptr<ReliableStreamConnection>, const Packet&)> m_on_packet_recv;
 			std::function<void(const std::string&)> m_on_error_message;
-			std::map<std::pair<std::string, int>, std::shared_ptr<ReliableStreamConnection>> m_connections;
+			// keyed by EndpointKey, packed address and port so lookups on the receive path never build strings
+			std::unordered_map<uint64_t, std::shared_ptr<ReliableStreamConnection>> m_connections;
+			RecvBufferPool m_recv_pool;
+			FILE *m_compression_capture;
+			size_t m_compression_capture_left;
+
+			static uint64_t EndpointKey(const sockaddr_in &addr) { return (static_cast<uint64_t>(addr.sin_addr.s_addr) << 16) | addr.sin_port; }
 
-			void ProcessPacket(const std::string &endpoint, int port, const char *data, size_t size);
+			void ProcessPacket(const sockaddr_in &addr, const char *data, size_t size);
 			std::shared_ptr<ReliableStreamConnection> FindConnectionByEndpoint(std::string addr, int port);
-			void SendDisconnect(const std::string &addr, int port);
+			void SendDisconnect(const sockaddr_in &addr);
+			void OpenCompressionCapture();
+			void CaptureCompressionPayload(int compression_class, const uint8_t *data, size_t length);
 
 			friend class ReliableStreamConnection;
 		};
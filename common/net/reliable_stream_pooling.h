@@ -121,3 +121,81 @@ private:
 		return std::nullopt;
 	}
 };
+
+// libuv hands recvmmsg one datagram slot per 64KB of receive buffer
+constexpr size_t UDP_RECV_BUFFER_SIZE = 64 * 1024;
+
+// Recycled receive buffers for uv_udp_recv_start. Only ever touched from the owning loop's thread
+class RecvBufferPool {
+public:
+	explicit RecvBufferPool(size_t buffer_size = UDP_RECV_BUFFER_SIZE, size_t initial_capacity = 2)
+		: m_buffer_size(buffer_size)
+	{
+		LogNetClient("[RecvBufferPool] Initializing with capacity [{}] buffer size [{}]", initial_capacity, m_buffer_size);
+
+		m_buffers.reserve(initial_capacity);
+		m_free.reserve(initial_capacity);
+		for (size_t i = 0; i < initial_capacity; ++i) {
+			m_buffers.emplace_back(std::make_unique<char[]>(m_buffer_size));
+			m_free.push_back(m_buffers.back().get());
+		}
+	}
+
+	void resize(size_t buffer_size) {
+		if (buffer_size == m_buffer_size) {
+			return;
+		}
+
+		LogNetClient("[RecvBufferPool] Resizing buffers from [{}] to [{}]", m_buffer_size, buffer_size);
+
+		const size_t count = m_buffers.size();
+
+		m_buffer_size = buffer_size;
+		m_buffers.clear();
+		m_free.clear();
+		for (size_t i = 0; i < count; ++i) {
+			m_buffers.emplace_back(std::make_unique<char[]>(m_buffer_size));
+			m_free.push_back(m_buffers.back().get());
+		}
+	}
+
+	char *acquire() {
+		if (m_free.empty()) {
+			LogNetClient("[RecvBufferPool] Growing from [{}] to [{}]", m_buffers.size(), m_buffers.size() + 1);
+			m_buffers.emplace_back(std::make_unique<char[]>(m_buffer_size));
+			m_free.push_back(m_buffers.back().get());
+		}
+
+		char *buffer = m_free.back();
+		m_free.pop_back();
+		m_acquired++;
+
+		return buffer;
+	}
+
+	void release(char *buffer) {
+		if (!buffer) {
+			return;
+		}
+
+		for (const auto &b : m_buffers) {
+			if (b.get() == buffer) {
+				m_free.push_back(buffer);
+				return;
+			}
+		}
+
+		LogNetClient("[RecvBufferPool] Release of a buffer the pool does not own");
+	}
+
+	size_t buffer_size() const { return m_buffer_size; }
+	size_t capacity() const { return m_buffers.size(); }
+	size_t in_use() const { return m_buffers.size() - m_free.size(); }
+	uint64_t acquired() const { return m_acquired; }
+
+private:
+	size_t                               m_buffer_size;
+	std::vector<std::unique_ptr<char[]>> m_buffers;
+	std::vector<char *>                  m_free;
+	uint64_t                             m_acquired = 0;
+};
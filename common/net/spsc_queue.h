@@ -0,0 +1,66 @@
+#pragma once
+
+#include "../spsc_ring.h"
+#include <deque>
+
+namespace EQ
+{
+	namespace Net
+	{
+		/**
+		 * EQ::SPSCRing that never drops, one thread pushes and one thread pops
+		 *
+		 * A push that finds the ring full parks the item in a backlog only the producer touches, later pushes queue
+		 * behind it so ordering holds, and the producer hands the backlog over with Flush once the consumer has caught
+		 * up. Nothing is dropped and the producer never waits on the consumer
+		 */
+		template<typename T>
+		class SPSCQueue
+		{
+		public:
+			explicit SPSCQueue(size_t size) : m_ring(size) { }
+
+			// producer, returns false when the item went to the backlog instead of the ring
+			bool Push(T &item)
+			{
+				if (!m_backlog.empty() && !Flush()) {
+					m_backlog.push_back(std::move(item));
+					return false;
+				}
+
+				if (!m_ring.TryPush(item)) {
+					m_backlog.push_back(std::move(item));
+					return false;
+				}
+
+				return true;
+			}
+
+			// producer, moves as much of the backlog into the ring as fits, true when the backlog is empty
+			bool Flush()
+			{
+				while (!m_backlog.empty()) {
+					if (!m_ring.TryPush(m_backlog.front())) {
+						return false;
+					}
+
+					m_backlog.pop_front();
+				}
+
+				return true;
+			}
+
+			size_t BacklogSize() const { return m_backlog.size(); }
+
+			// consumer
+			bool Pop(T &item) { return m_ring.Pop(item); }
+
+			size_t Size() const { return m_ring.Size(); }
+			size_t Capacity() const { return m_ring.Capacity(); }
+
+		private:
+			SPSCRing<T>   m_ring;
+			std::deque<T> m_backlog; // producer only
+		};
+	}
+}
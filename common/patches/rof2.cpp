@@ -30,6 +30,7 @@
 #include "../misc_functions.h"
 #include "../strings.h"
 #include "../inventory_profile.h"
+#include "../item_body_cache.h"
 #include "rof2_structs.h"
 #include "../rulesys.h"
 #include "../path_manager.h"
@@ -51,6 +52,9 @@ namespace RoF2
 	static Strategy struct_strategy;
 
 	void SerializeItem(EQ::OutBuffer& ob, const EQ::ItemInstance *inst, int16 slot_id, uint8 depth, ItemPacketType packet_type);
+	void SerializeItemBody(EQ::OutBuffer& ob, const EQ::ItemData *item);
+
+	static EQ::ItemBodyCache item_body_cache(SerializeItemBody);
 
 	// server to client inventory location converters
 	static inline structs::InventorySlot_Struct ServerToRoF2Slot(uint32 server_slot);
@@ -6550,6 +6554,59 @@ namespace RoF2
 
 		ob.write((const char*)&hdrf, sizeof(RoF2::structs::ItemSerializationHeaderFinish));
 
+		const std::string &body = item_body_cache.Get(item);
+		ob.write(body.data(), body.size());
+
+		// the cached body ends with the quaternary block, built for every packet type but ItemPacketInvalid
+		if (packet_type == ItemPacketInvalid) {
+			EQ::OutBuffer::pos_type iqbs_pos = ob.tellp() - static_cast<EQ::OutBuffer::off_type>(sizeof(RoF2::structs::ItemQuaternaryBodyStruct));
+
+			uint16 unknown29 = 0xFF;
+			uint8  unknown39 = 0;
+
+			ob.overwrite(iqbs_pos + static_cast<EQ::OutBuffer::off_type>(offsetof(RoF2::structs::ItemQuaternaryBodyStruct, unknown29)), (const char*)&unknown29, sizeof(uint16));
+			ob.overwrite(iqbs_pos + static_cast<EQ::OutBuffer::off_type>(offsetof(RoF2::structs::ItemQuaternaryBodyStruct, unknown39)), (const char*)&unknown39, sizeof(uint8));
+		}
+
+		EQ::OutBuffer::pos_type count_pos = ob.tellp();
+		uint32 subitem_count = 0;
+
+		ob.write((const char*)&subitem_count, sizeof(uint32));
+
+		// moved outside of loop since it is not modified within that scope
+		int16 SubSlotNumber = EQ::invbag::SLOT_INVALID;
+
+		if (slot_id_in <= EQ::invslot::GENERAL_END && slot_id_in >= EQ::invslot::GENERAL_BEGIN)
+			SubSlotNumber = EQ::invbag::GENERAL_BAGS_BEGIN + ((slot_id_in - EQ::invslot::GENERAL_BEGIN) * EQ::invbag::SLOT_COUNT);
+		else if (slot_id_in == EQ::invslot::slotCursor)
+			SubSlotNumber = EQ::invbag::CURSOR_BAG_BEGIN;
+		else if (slot_id_in <= EQ::invslot::BANK_END && slot_id_in >= EQ::invslot::BANK_BEGIN)
+			SubSlotNumber = EQ::invbag::BANK_BAGS_BEGIN + ((slot_id_in - EQ::invslot::BANK_BEGIN) * EQ::invbag::SLOT_COUNT);
+		else if (slot_id_in <= EQ::invslot::SHARED_BANK_END && slot_id_in >= EQ::invslot::SHARED_BANK_BEGIN)
+			SubSlotNumber = EQ::invbag::SHARED_BANK_BAGS_BEGIN + ((slot_id_in - EQ::invslot::SHARED_BANK_BEGIN) * EQ::invbag::SLOT_COUNT);
+		else
+			SubSlotNumber = slot_id_in; // not sure if this is the best way to handle this..leaving for now
+
+		if (SubSlotNumber != EQ::invbag::SLOT_INVALID) {
+			for (uint32 index = EQ::invbag::SLOT_BEGIN; index <= EQ::invbag::SLOT_END; ++index) {
+				EQ::ItemInstance* sub = inst->GetItem(index);
+				if (!sub)
+					continue;
+
+				ob.write((const char*)&index, sizeof(uint32));
+
+				SerializeItem(ob, sub, SubSlotNumber, (depth + 1), packet_type);
+				++subitem_count;
+			}
+
+			if (subitem_count)
+				ob.overwrite(count_pos, (const char*)&subitem_count, sizeof(uint32));
+		}
+	}
+
+	// everything in the item packet that only depends on the item, built once per item by item_body_cache
+	void SerializeItemBody(EQ::OutBuffer& ob, const EQ::ItemData *item)
+	{
 		if (strlen(item->Name) > 0) {
 			ob.write(item->Name, strlen(item->Name));
 			ob.write("\0", 1);
@@ -6716,7 +6773,7 @@ namespace RoF2
 		itbs.potion_belt_enabled = item->PotionBelt;
 		itbs.potion_belt_slots   = item->PotionBeltSlots;
 		itbs.stacksize           =
-			item->ID == PARCEL_MONEY_ITEM_ID ? 0x7FFFFFFF : ((inst->IsStackable() ? item->StackSize : 0));
+			item->ID == PARCEL_MONEY_ITEM_ID ? 0x7FFFFFFF : ((item->Stackable ? item->StackSize : 0));
 		itbs.no_transfer         = item->NoTransfer;
 		itbs.expendablearrow     = item->ExpendableArrow;
 
@@ -6882,50 +6939,15 @@ namespace RoF2
 		iqbs.Heirloom = 0;
 		iqbs.Placeable = 0;
 		iqbs.unknown28 = -1;
-		iqbs.unknown29 = packet_type == ItemPacketInvalid ? 0xFF : 0;
+		iqbs.unknown29 = 0;
 		iqbs.unknown30 = -1;
 		iqbs.NoZone = 0;
 		iqbs.NoGround = 0;
 		iqbs.unknown37a = 0;	// (guessed position) New to RoF2
 		iqbs.unknown38 = 0;
-		iqbs.unknown39 = packet_type == ItemPacketInvalid ? 0 : 1;;
+		iqbs.unknown39 = 1;
 
 		ob.write((const char*)&iqbs, sizeof(RoF2::structs::ItemQuaternaryBodyStruct));
-
-		EQ::OutBuffer::pos_type count_pos = ob.tellp();
-		uint32 subitem_count = 0;
-
-		ob.write((const char*)&subitem_count, sizeof(uint32));
-
-		// moved outside of loop since it is not modified within that scope
-		int16 SubSlotNumber = EQ::invbag::SLOT_INVALID;
-
-		if (slot_id_in <= EQ::invslot::GENERAL_END && slot_id_in >= EQ::invslot::GENERAL_BEGIN)
-			SubSlotNumber = EQ::invbag::GENERAL_BAGS_BEGIN + ((slot_id_in - EQ::invslot::GENERAL_BEGIN) * EQ::invbag::SLOT_COUNT);
-		else if (slot_id_in == EQ::invslot::slotCursor)
-			SubSlotNumber = EQ::invbag::CURSOR_BAG_BEGIN;
-		else if (slot_id_in <= EQ::invslot::BANK_END && slot_id_in >= EQ::invslot::BANK_BEGIN)
-			SubSlotNumber = EQ::invbag::BANK_BAGS_BEGIN + ((slot_id_in - EQ::invslot::BANK_BEGIN) * EQ::invbag::SLOT_COUNT);
-		else if (slot_id_in <= EQ::invslot::SHARED_BANK_END && slot_id_in >= EQ::invslot::SHARED_BANK_BEGIN)
-			SubSlotNumber = EQ::invbag::SHARED_BANK_BAGS_BEGIN + ((slot_id_in - EQ::invslot::SHARED_BANK_BEGIN) * EQ::invbag::SLOT_COUNT);
-		else
-			SubSlotNumber = slot_id_in; // not sure if this is the best way to handle this..leaving for now
-
-		if (SubSlotNumber != EQ::invbag::SLOT_INVALID) {
-			for (uint32 index = EQ::invbag::SLOT_BEGIN; index <= EQ::invbag::SLOT_END; ++index) {
-				EQ::ItemInstance* sub = inst->GetItem(index);
-				if (!sub)
-					continue;
-
-				ob.write((const char*)&index, sizeof(uint32));
-
-				SerializeItem(ob, sub, SubSlotNumber, (depth + 1), packet_type);
-				++subitem_count;
-			}
-
-			if (subitem_count)
-				ob.overwrite(count_pos, (const char*)&subitem_count, sizeof(uint32));
-		}
 	}
 
 	static inline structs::InventorySlot_Struct ServerToRoF2Slot(uint32 server_slot)
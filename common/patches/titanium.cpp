@@ -31,6 +31,7 @@
 #include "../misc_functions.h"
 #include "../strings.h"
 #include "../item_instance.h"
+#include "../item_body_cache.h"
 #include "titanium_structs.h"
 #include "../rulesys.h"
 #include "../path_manager.h"
@@ -47,6 +48,9 @@ namespace Titanium
 	static Strategy struct_strategy;
 
 	void SerializeItem(EQ::OutBuffer& ob, const EQ::ItemInstance *inst, int16 slot_id_in, uint8 depth);
+	void SerializeItemBody(EQ::OutBuffer& ob, const EQ::ItemData *item);
+
+	static EQ::ItemBodyCache item_body_cache(SerializeItemBody);
 
 	// server to client inventory location converters
 	static inline int16 ServerToTitaniumSlot(uint32 server_slot);
@@ -3357,6 +3361,35 @@ namespace Titanium
 		ob << StringFormat("%.*s\"", depth, protection); // Quotes (and protection, if needed) around static data
 
 		// Item data
+		const std::string &body = item_body_cache.Get(item);
+		ob.write(body.data(), body.size());
+
+		ob << StringFormat("%.*s\"", depth, protection); // Quotes (and protection, if needed) around static data
+
+		// Sub data
+		for (int index = EQ::invbag::SLOT_BEGIN; index <= invbag::SLOT_END; ++index) {
+			ob << '|';
+
+			EQ::ItemInstance *sub = inst->GetItem(index);
+			if (!sub)
+				continue;
+
+			SerializeItem(ob, sub, 0, (depth + 1));
+		}
+
+		ob << StringFormat(
+			"%.*s%s",
+			(depth ? (depth - 1) : 0),
+			protection,
+			(depth ? "\"" : "")); // For trailing quotes (and protection) if a subitem;
+
+		if (!depth)
+			ob.write("\0", 1);
+	}
+
+	// everything in the item packet that only depends on the item, built once per item by item_body_cache
+	void SerializeItemBody(EQ::OutBuffer& ob, const EQ::ItemData *item)
+	{
 		ob << itoa(item->ItemClass);
 		ob << '|' << item->Name;
 		ob << '|' << item->Lore;
@@ -3553,28 +3586,6 @@ namespace Titanium
 		ob << '|' << itoa(item->Scroll.Level2);
 		ob << '|' << itoa(item->Scroll.Level);
 		ob << '|' << "0"; // Scroll name
-
-		ob << StringFormat("%.*s\"", depth, protection); // Quotes (and protection, if needed) around static data
-
-		// Sub data
-		for (int index = EQ::invbag::SLOT_BEGIN; index <= invbag::SLOT_END; ++index) {
-			ob << '|';
-
-			EQ::ItemInstance *sub = inst->GetItem(index);
-			if (!sub)
-				continue;
-
-			SerializeItem(ob, sub, 0, (depth + 1));
-		}
-
-		ob << StringFormat(
-			"%.*s%s",
-			(depth ? (depth - 1) : 0),
-			protection,
-			(depth ? "\"" : "")); // For trailing quotes (and protection) if a subitem;
-
-		if (!depth)
-			ob.write("\0", 1);
 	}
 
 	static inline int16 ServerToTitaniumSlot(uint32 server_slot) {
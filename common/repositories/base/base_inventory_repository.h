@@ -15,6 +15,7 @@
 #include "../../database.h"
 #include "../../strings.h"
 #include <ctime>
+#include "../../mysql_stmt.h"
 
 class BaseInventoryRepository {
 public:
@@ -567,6 +568,83 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	// binary protocol variants, each distinct query is prepared once per connection and reused
+
+	static Inventory PreparedRow(const mysql::StmtRow &row)
+	{
+		Inventory e{};
+
+		e.character_id        = row.Get<uint32_t>(0).value_or(0);
+		e.slot_id             = row.Get<uint32_t>(1).value_or(0);
+		e.item_id             = row.Get<uint32_t>(2).value_or(0);
+		e.charges             = row.Get<uint16_t>(3).value_or(0);
+		e.color               = row.Get<uint32_t>(4).value_or(0);
+		e.augment_one         = row.Get<uint32_t>(5).value_or(0);
+		e.augment_two         = row.Get<uint32_t>(6).value_or(0);
+		e.augment_three       = row.Get<uint32_t>(7).value_or(0);
+		e.augment_four        = row.Get<uint32_t>(8).value_or(0);
+		e.augment_five        = row.Get<uint32_t>(9).value_or(0);
+		e.augment_six         = row.Get<uint32_t>(10).value_or(0);
+		e.instnodrop          = row.Get<uint8_t>(11).value_or(0);
+		e.custom_data         = row.GetStr(12).value_or("");
+		e.ornament_icon       = row.Get<uint32_t>(13).value_or(0);
+		e.ornament_idfile     = row.Get<uint32_t>(14).value_or(0);
+		e.ornament_hero_model = row.Get<int32_t>(15).value_or(0);
+		e.guid                = row.Get<uint64_t>(16).value_or(0);
+
+		return e;
+	}
+
+	static Inventory FindOnePrepared(
+		Database& db,
+		int inventory_id
+	)
+	{
+		const auto l = GetWherePrepared(db, fmt::format("{} = ? LIMIT 1", PrimaryKey()), { inventory_id });
+
+		return l.empty() ? NewEntity() : l.front();
+	}
+
+	// throws std::runtime_error when the query still fails after re-preparing, rather than returning no rows
+	static std::vector<Inventory> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<mysql::PreparedStmt::param_t> &params = {}
+	)
+	{
+		std::vector<Inventory> all_entries;
+
+		const auto query = fmt::format("{} WHERE {}", BaseSelect(), where_filter);
+
+		// a second attempt re-prepares, a cached statement goes stale when the connection is re-established
+		for (int attempt = 0; attempt < 2; attempt++) {
+			try {
+				// held by shared_ptr, a reconnect on another thread can drop it from the cache mid query
+				auto stmt    = db.GetPreparedStmt(query);
+				auto results = stmt->Execute(params);
+
+				all_entries.reserve(results.RowCount());
+
+				for (auto row = stmt->Fetch(); row; row = stmt->Fetch()) {
+					all_entries.push_back(PreparedRow(row));
+				}
+
+				stmt->FreeResult();
+				break;
+			}
+			catch (const std::exception &e) {
+				all_entries.clear();
+				db.EvictPreparedStmt(query, e.what());
+
+				if (attempt > 0) {
+					throw;
+				}
+			}
+		}
+
+		return all_entries;
+	}
 };
 
 #endif //EQEMU_BASE_INVENTORY_REPOSITORY_H
@@ -15,6 +15,7 @@
 #include "../../database.h"
 #include "../../strings.h"
 #include <ctime>
+#include "../../mysql_stmt.h"
 
 class BaseNpcTypesRepository {
 public:
@@ -1934,6 +1935,197 @@ public:
 
 		return (results.Success() ? results.RowsAffected() : 0);
 	}
+
+	// binary protocol variants, each distinct query is prepared once per connection and reused
+
+	static NpcTypes PreparedRow(const mysql::StmtRow &row)
+	{
+		NpcTypes e{};
+
+		e.id                     = row.Get<int32_t>(0).value_or(0);
+		e.name                   = row.GetStr(1).value_or("");
+		e.lastname               = row.GetStr(2).value_or("");
+		e.level                  = row.Get<uint8_t>(3).value_or(0);
+		e.race                   = row.Get<uint16_t>(4).value_or(0);
+		e.class_                 = row.Get<uint8_t>(5).value_or(0);
+		e.bodytype               = row.Get<int32_t>(6).value_or(1);
+		e.hp                     = row.Get<int64_t>(7).value_or(0);
+		e.mana                   = row.Get<int64_t>(8).value_or(0);
+		e.gender                 = row.Get<uint8_t>(9).value_or(0);
+		e.texture                = row.Get<uint8_t>(10).value_or(0);
+		e.helmtexture            = row.Get<uint8_t>(11).value_or(0);
+		e.herosforgemodel        = row.Get<int32_t>(12).value_or(0);
+		e.size                   = row.Get<float>(13).value_or(0);
+		e.hp_regen_rate          = row.Get<int64_t>(14).value_or(0);
+		e.hp_regen_per_second    = row.Get<int64_t>(15).value_or(0);
+		e.mana_regen_rate        = row.Get<int64_t>(16).value_or(0);
+		e.loottable_id           = row.Get<uint32_t>(17).value_or(0);
+		e.merchant_id            = row.Get<uint32_t>(18).value_or(0);
+		e.greed                  = row.Get<uint8_t>(19).value_or(0);
+		e.alt_currency_id        = row.Get<uint32_t>(20).value_or(0);
+		e.npc_spells_id          = row.Get<uint32_t>(21).value_or(0);
+		e.npc_spells_effects_id  = row.Get<uint32_t>(22).value_or(0);
+		e.npc_faction_id         = row.Get<int32_t>(23).value_or(0);
+		e.adventure_template_id  = row.Get<uint32_t>(24).value_or(0);
+		e.trap_template          = row.Get<uint32_t>(25).value_or(0);
+		e.mindmg                 = row.Get<uint32_t>(26).value_or(0);
+		e.maxdmg                 = row.Get<uint32_t>(27).value_or(0);
+		e.attack_count           = row.Get<int16_t>(28).value_or(-1);
+		e.npcspecialattks        = row.GetStr(29).value_or("");
+		e.special_abilities      = row.GetStr(30).value_or("");
+		e.aggroradius            = row.Get<uint32_t>(31).value_or(0);
+		e.assistradius           = row.Get<uint32_t>(32).value_or(0);
+		e.face                   = row.Get<uint32_t>(33).value_or(1);
+		e.luclin_hairstyle       = row.Get<uint32_t>(34).value_or(1);
+		e.luclin_haircolor       = row.Get<uint32_t>(35).value_or(1);
+		e.luclin_eyecolor        = row.Get<uint32_t>(36).value_or(1);
+		e.luclin_eyecolor2       = row.Get<uint32_t>(37).value_or(1);
+		e.luclin_beardcolor      = row.Get<uint32_t>(38).value_or(1);
+		e.luclin_beard           = row.Get<uint32_t>(39).value_or(0);
+		e.drakkin_heritage       = row.Get<int32_t>(40).value_or(0);
+		e.drakkin_tattoo         = row.Get<int32_t>(41).value_or(0);
+		e.drakkin_details        = row.Get<int32_t>(42).value_or(0);
+		e.armortint_id           = row.Get<uint32_t>(43).value_or(0);
+		e.armortint_red          = row.Get<uint8_t>(44).value_or(0);
+		e.armortint_green        = row.Get<uint8_t>(45).value_or(0);
+		e.armortint_blue         = row.Get<uint8_t>(46).value_or(0);
+		e.d_melee_texture1       = row.Get<uint32_t>(47).value_or(0);
+		e.d_melee_texture2       = row.Get<uint32_t>(48).value_or(0);
+		e.ammo_idfile            = row.GetStr(49).value_or("IT10");
+		e.prim_melee_type        = row.Get<uint8_t>(50).value_or(28);
+		e.sec_melee_type         = row.Get<uint8_t>(51).value_or(28);
+		e.ranged_type            = row.Get<uint8_t>(52).value_or(7);
+		e.runspeed               = row.Get<float>(53).value_or(0);
+		e.MR                     = row.Get<int16_t>(54).value_or(0);
+		e.CR                     = row.Get<int16_t>(55).value_or(0);
+		e.DR                     = row.Get<int16_t>(56).value_or(0);
+		e.FR                     = row.Get<int16_t>(57).value_or(0);
+		e.PR                     = row.Get<int16_t>(58).value_or(0);
+		e.Corrup                 = row.Get<int16_t>(59).value_or(0);
+		e.PhR                    = row.Get<uint16_t>(60).value_or(0);
+		e.see_invis              = row.Get<int16_t>(61).value_or(0);
+		e.see_invis_undead       = row.Get<int16_t>(62).value_or(0);
+		e.qglobal                = row.Get<uint32_t>(63).value_or(0);
+		e.AC                     = row.Get<int16_t>(64).value_or(0);
+		e.npc_aggro              = row.Get<int8_t>(65).value_or(0);
+		e.spawn_limit            = row.Get<int8_t>(66).value_or(0);
+		e.attack_speed           = row.Get<float>(67).value_or(0);
+		e.attack_delay           = row.Get<uint8_t>(68).value_or(30);
+		e.findable               = row.Get<int8_t>(69).value_or(0);
+		e.STR                    = row.Get<uint32_t>(70).value_or(75);
+		e.STA                    = row.Get<uint32_t>(71).value_or(75);
+		e.DEX                    = row.Get<uint32_t>(72).value_or(75);
+		e.AGI                    = row.Get<uint32_t>(73).value_or(75);
+		e._INT                   = row.Get<uint32_t>(74).value_or(80);
+		e.WIS                    = row.Get<uint32_t>(75).value_or(75);
+		e.CHA                    = row.Get<uint32_t>(76).value_or(75);
+		e.see_hide               = row.Get<int8_t>(77).value_or(0);
+		e.see_improved_hide      = row.Get<int8_t>(78).value_or(0);
+		e.trackable              = row.Get<int8_t>(79).value_or(1);
+		e.isbot                  = row.Get<int8_t>(80).value_or(0);
+		e.exclude                = row.Get<int8_t>(81).value_or(1);
+		e.ATK                    = row.Get<int32_t>(82).value_or(0);
+		e.Accuracy               = row.Get<int32_t>(83).value_or(0);
+		e.Avoidance              = row.Get<uint32_t>(84).value_or(0);
+		e.slow_mitigation        = row.Get<int16_t>(85).value_or(0);
+		e.version                = row.Get<uint16_t>(86).value_or(0);
+		e.maxlevel               = row.Get<int8_t>(87).value_or(0);
+		e.scalerate              = row.Get<int32_t>(88).value_or(100);
+		e.private_corpse         = row.Get<uint8_t>(89).value_or(0);
+		e.unique_spawn_by_name   = row.Get<uint8_t>(90).value_or(0);
+		e.underwater             = row.Get<uint8_t>(91).value_or(0);
+		e.isquest                = row.Get<int8_t>(92).value_or(0);
+		e.emoteid                = row.Get<uint32_t>(93).value_or(0);
+		e.spellscale             = row.Get<float>(94).value_or(100);
+		e.healscale              = row.Get<float>(95).value_or(100);
+		e.no_target_hotkey       = row.Get<uint8_t>(96).value_or(0);
+		e.raid_target            = row.Get<uint8_t>(97).value_or(0);
+		e.armtexture             = row.Get<int8_t>(98).value_or(0);
+		e.bracertexture          = row.Get<int8_t>(99).value_or(0);
+		e.handtexture            = row.Get<int8_t>(100).value_or(0);
+		e.legtexture             = row.Get<int8_t>(101).value_or(0);
+		e.feettexture            = row.Get<int8_t>(102).value_or(0);
+		e.light                  = row.Get<int8_t>(103).value_or(0);
+		e.walkspeed              = row.Get<float>(104).value_or(0);
+		e.peqid                  = row.Get<int32_t>(105).value_or(0);
+		e.unique_                = row.Get<int8_t>(106).value_or(0);
+		e.fixed                  = row.Get<int8_t>(107).value_or(0);
+		e.ignore_despawn         = row.Get<int8_t>(108).value_or(0);
+		e.show_name              = row.Get<int8_t>(109).value_or(1);
+		e.untargetable           = row.Get<int8_t>(110).value_or(0);
+		e.charm_ac               = row.Get<int16_t>(111).value_or(0);
+		e.charm_min_dmg          = row.Get<int32_t>(112).value_or(0);
+		e.charm_max_dmg          = row.Get<int32_t>(113).value_or(0);
+		e.charm_attack_delay     = row.Get<int8_t>(114).value_or(0);
+		e.charm_accuracy_rating  = row.Get<int32_t>(115).value_or(0);
+		e.charm_avoidance_rating = row.Get<int32_t>(116).value_or(0);
+		e.charm_atk              = row.Get<int32_t>(117).value_or(0);
+		e.skip_global_loot       = row.Get<int8_t>(118).value_or(0);
+		e.rare_spawn             = row.Get<int8_t>(119).value_or(0);
+		e.stuck_behavior         = row.Get<int8_t>(120).value_or(0);
+		e.model                  = row.Get<int16_t>(121).value_or(0);
+		e.flymode                = row.Get<int8_t>(122).value_or(-1);
+		e.always_aggro           = row.Get<int8_t>(123).value_or(0);
+		e.exp_mod                = row.Get<int32_t>(124).value_or(100);
+		e.heroic_strikethrough   = row.Get<int32_t>(125).value_or(0);
+		e.faction_amount         = row.Get<int32_t>(126).value_or(0);
+		e.keeps_sold_items       = row.Get<uint8_t>(127).value_or(1);
+		e.is_parcel_merchant     = row.Get<uint8_t>(128).value_or(0);
+		e.multiquest_enabled     = row.Get<uint8_t>(129).value_or(0);
+		e.npc_tint_id            = row.Get<uint16_t>(130).value_or(0);
+
+		return e;
+	}
+
+	static NpcTypes FindOnePrepared(
+		Database& db,
+		int npc_types_id
+	)
+	{
+		const auto l = GetWherePrepared(db, fmt::format("{} = ? LIMIT 1", PrimaryKey()), { npc_types_id });
+
+		return l.empty() ? NewEntity() : l.front();
+	}
+
+	// throws std::runtime_error when the query still fails after re-preparing, rather than returning no rows
+	static std::vector<NpcTypes> GetWherePrepared(
+		Database& db,
+		const std::string &where_filter,
+		const std::vector<mysql::PreparedStmt::param_t> &params = {}
+	)
+	{
+		std::vector<NpcTypes> all_entries;
+
+		const auto query = fmt::format("{} WHERE {}", BaseSelect(), where_filter);
+
+		// a second attempt re-prepares, a cached statement goes stale when the connection is re-established
+		for (int attempt = 0; attempt < 2; attempt++) {
+			try {
+				// held by shared_ptr, a reconnect on another thread can drop it from the cache mid query
+				auto stmt    = db.GetPreparedStmt(query);
+				auto results = stmt->Execute(params);
+
+				all_entries.reserve(results.RowCount());
+
+				for (auto row = stmt->Fetch(); row; row = stmt->Fetch()) {
+					all_entries.push_back(PreparedRow(row));
+				}
+
+				stmt->FreeResult();
+				break;
+			}
+			catch (const std::exception &e) {
+				all_entries.clear();
+				db.EvictPreparedStmt(query, e.what());
+
+				if (attempt > 0) {
+					throw;
+				}
+			}
+		}
+
+		return all_entries;
+	}
 };
 
 #endif //EQEMU_BASE_NPC_TYPES_REPOSITORY_H
@@ -37,6 +37,9 @@ public:
 			auto e = EncryptPasswordFromContext(c);
 			a.account_password = e.password;
 		}
+		else {
+			a.account_password = c.password;
+		}
 
 		a.id                 = c.login_account_id > 0 ? c.login_account_id : GetFreeID(db, c.source_loginserver);
 		a.account_name       = c.username;
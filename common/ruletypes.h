@@ -165,6 +165,8 @@ RULE_BOOL(Character, ActiveInvSnapshots, false, "Takes a periodic snapshot of in
 RULE_INT(Character, InvSnapshotMinIntervalM, 180, "Minimum time between inventory snapshots (minutes)")
 RULE_INT(Character, InvSnapshotMinRetryM, 30, "Time to re-attempt an inventory snapshot after a failure  (minutes)")
 RULE_INT(Character, InvSnapshotHistoryD, 30, "Time to keep snapshot entries (days)")
+RULE_BOOL(Character, AsyncSaves, false, "Hands periodic character saves off to a background write-behind worker, zoning and camping still save synchronously. Requires a zone restart")
+RULE_INT(Character, AsyncSaveFlushTimeoutMS, 5000, "Longest the zone waits for the save worker to finish a character's pending write before going ahead with a synchronous save or load")
 RULE_BOOL(Character, RestrictSpellScribing, false, "Setting whether to restrict spell scribing to allowable races/classes of spell scroll")
 RULE_BOOL(Character, UseStackablePickPocketing, true, "Allows stackable pickpocketed items to stack instead of only being allowed in empty inventory slots")
 RULE_BOOL(Character, AllowMQTarget, false, "Disables putting players in the 'hackers' list for targeting beyond the clip plane or attempting to target something untargetable")
@@ -389,7 +391,9 @@ RULE_BOOL(Zone, StateSaveEntityVariables, true, "Set to true if you want buffs t
 RULE_BOOL(Zone, StateSaveBuffs, true, "Set to true if you want buffs to be saved on shutdown")
 RULE_INT(Zone, StateSaveClearDays, 7, "Clears state save data older than this many days")
 RULE_BOOL(Zone, StateSavingOnShutdown, true, "Set to true if you want zones to save state on shutdown (npcs, corpses, loot, entity variables, buffs etc.)")
+RULE_BOOL(Zone, StateSaveAsJson, false, "Writes zone state loot, entity variables and buffs as JSON instead of the compact binary encoding, for inspecting zone_state_spawns by hand. Either format loads")
 RULE_INT(Zone, UpdateWhoTimer, 120, "Seconds between updates to /who list, CLE stale timer")
+RULE_INT(Zone, BootLoaderThreads, 0, "Database worker threads Zone::Init uses to prefetch grids, spawns, doors and merchants while the map files parse in parallel, each opens its own connection. 0 boots serially on the zone thread")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(Map)
@@ -411,6 +415,7 @@ RULE_BOOL(Pathing, Fear, true, "Enable pathing for fear")
 RULE_REAL(Pathing, NavmeshStepSize, 100.0f, "Step size for the movement manager")
 RULE_REAL(Pathing, ShortMovementUpdateRange, 130.0f, "Range for short movement updates")
 RULE_INT(Pathing, MaxNavmeshNodes, 4092, "Maximum navmesh nodes in a traversable path")
+RULE_INT(Pathing, NavmeshRouteCacheSize, 1024, "Number of recent navmesh polygon corridors (start poly, end poly, flags) kept for reuse, 0 disables the cache")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(Watermap)
@@ -1015,6 +1020,10 @@ RULE_INT(Network, ResendDelayMinMS, 300, "Minimum timespan between two send retr
 RULE_INT(Network, ResendDelayMaxMS, 5000, "Maximum timespan between two send retries (milliseconds)")
 RULE_REAL(Network, ClientDataRate, 0.0, "KB / sec, 0.0 disabled")
 RULE_BOOL(Network, CompressZoneStream, true, "Setting whether the zone stream should be compressed for transmission")
+RULE_BOOL(Network, BatchedReceive, false, "Read client datagrams in batches with recvmmsg (Linux only, takes effect on zone or world restart)")
+RULE_STRING(Network, CompressionPolicy, "packet:1:31,fragment:1:31,combined:1:31,other:1:31", "Zone stream compression per packet class as class:level:min_size, level 0 sends the class uncompressed (takes effect on zone restart)")
+RULE_STRING(Network, CompressionCaptureFile, "", "When set, zone appends outgoing payloads before compression to this file for benchmark:compression (takes effect on zone restart)")
+RULE_BOOL(Network, DedicatedThread, false, "Run client UDP receive, acks, resends and sends on a dedicated network thread instead of the game loop (takes effect on zone or world restart)")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(QueryServ)
@@ -1082,6 +1091,10 @@ RULE_BOOL(Logging, PlayerEventsQSProcess, false, "Have query server process play
 RULE_STRING(Logging, PlayerEventsIgnoreGMCommands, "help,show", "This is a comma delimited list of commands to ignore when recording GM command player events.")
 RULE_INT(Logging, BatchPlayerEventProcessIntervalSeconds, 5, "This is the interval in which player events are processed in world or qs")
 RULE_INT(Logging, BatchPlayerEventProcessChunkSize, 10000, "This is the cap of events that can be inserted into the queue before a force flush. This is to keep from hitting MySQL max_allowed_packet and killing the connection")
+RULE_BOOL(Logging, AsyncWrites, false, "Write console and file logs from a background thread instead of the thread that logged them. Takes effect when file logs are (re)started")
+RULE_INT(Logging, AsyncQueueSize, 8192, "Log lines each thread can have waiting for the background writer, rounded up to a power of two")
+RULE_BOOL(Logging, AsyncBlockWhenFull, false, "When a thread's log queue is full, wait for the background writer instead of dropping the line. Dropped lines are counted and reported in the log")
+RULE_INT(Logging, AsyncFlushIntervalMS, 1000, "How often the background writer flushes the file log")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(HotReload)
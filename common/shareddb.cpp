@@ -30,6 +30,7 @@
 #include "features.h"
 #include "ipc_mutex.h"
 #include "inventory_profile.h"
+#include "item_body_cache.h"
 #include "memory_mapped_file.h"
 #include "mysql.h"
 #include "rulesys.h"
@@ -655,7 +656,16 @@ bool SharedDatabase::GetInventory(Client *c)
 	EQ::InventoryProfile &inv     = c->GetInv();
 
 	// Retrieve character inventory
-	auto results   = InventoryRepository::GetWhere(*this, fmt::format("`character_id` = '{}' ORDER BY `slot_id`", char_id));
+	std::vector<InventoryRepository::Inventory> results;
+
+	try {
+		results = InventoryRepository::GetWherePrepared(*this, "`character_id` = ? ORDER BY `slot_id`", { char_id });
+	}
+	catch (const std::exception &e) {
+		LogError("Error loading inventory for char_id {} from the database: {}", char_id, e.what());
+		return false;
+	}
+
 	auto e_results = CharacterEvolvingItemsRepository::GetWhere(
 		*this, fmt::format("`character_id` = '{}' AND `deleted_at` IS NULL", char_id)
 	);
@@ -871,7 +881,9 @@ bool SharedDatabase::GetInventory(Client *c)
 	}
 
 	if (!queue.empty()) {
+		TransactionBegin();
 		InventoryRepository::ReplaceMany(*this, queue);
+		TransactionCommit();
 	}
 
 	EQ::ItemInstance::ClearGUIDMap();
@@ -946,6 +958,8 @@ bool SharedDatabase::LoadItems(const std::string &prefix) {
 		items_hash = std::make_unique<EQ::FixedMemoryHashSet<EQ::ItemData>>(static_cast<uint8*>(items_mmf->Get()), items_mmf->Size());
 		mutex.Unlock();
 
+		EQ::ItemBodyCache::Invalidate();
+
 		LogInfo("Loaded [{}] items via shared memory", Strings::Commify(m_shared_items_count));
 	} catch(std::exception& ex) {
 		LogError("Error Loading Items: {}", ex.what());
@@ -1675,6 +1689,8 @@ bool SharedDatabase::LoadSpells(const std::string &prefix, int32 *records, const
 		*sp = reinterpret_cast<const SPDat_Spell_Struct*>(static_cast<char*>(spells_mmf->Get()) + 4);
 		mutex.Unlock();
 
+		BuildSpellEffectIndex(*sp, *records);
+
 		LogInfo("Loaded [{}] spells via shared memory", Strings::Commify(m_shared_spells_count));
 	}
 	catch(std::exception& ex) {
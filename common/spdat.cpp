@@ -79,6 +79,8 @@
 #include "../common/rulesys.h"
 #include "../common/strings.h"
 
+#include <vector>
+
 #ifndef WIN32
 #include <stdlib.h>
 #include "unix.h"
@@ -872,12 +874,65 @@ bool IsBardSong(uint16 spell_id)
 	return false;
 }
 
+// effect bits for every spell record, rebuilt whenever the spell table is (re)mapped
+static std::vector<SpellEffectBitset> spell_effect_index;
+static uint32                         spell_effect_index_generation = 0;
+
+void BuildSpellEffectIndex(const SPDat_Spell_Struct *sp, int32 records)
+{
+	spell_effect_index.clear();
+	spell_effect_index_generation++;
+
+	if (!sp || records <= 0) {
+		return;
+	}
+
+	spell_effect_index.resize(records);
+
+	for (int32 spell_id = 0; spell_id < records; spell_id++) {
+		auto &bits = spell_effect_index[spell_id];
+
+		for (int i = 0; i < EFFECT_COUNT; i++) {
+			const int effect_id = sp[spell_id].effect_id[i];
+			if (effect_id >= 0 && effect_id < SPELL_EFFECT_BITSET_SIZE) {
+				bits.set(effect_id);
+			}
+		}
+	}
+
+	LogInfo("Indexed spell effects for [{}] spells", Strings::Commify(records));
+}
+
+uint32 GetSpellEffectIndexGeneration()
+{
+	return spell_effect_index.empty() ? 0 : spell_effect_index_generation;
+}
+
+const SpellEffectBitset &GetSpellEffectBits(uint16 spell_id)
+{
+	static const SpellEffectBitset none;
+
+	if (!IsValidSpell(spell_id) || spell_id >= spell_effect_index.size()) {
+		return none;
+	}
+
+	return spell_effect_index[spell_id];
+}
+
 bool IsEffectInSpell(uint16 spell_id, int effect_id)
 {
 	if (!IsValidSpell(spell_id)) {
 		return false;
 	}
 
+	if (
+		effect_id >= 0 &&
+		effect_id < SPELL_EFFECT_BITSET_SIZE &&
+		spell_id < spell_effect_index.size()
+	) {
+		return spell_effect_index[spell_id].test(effect_id);
+	}
+
 	const auto& spell = spells[spell_id];
 
 	for (int i = 0; i < EFFECT_COUNT; i++) {
@@ -1018,6 +1073,16 @@ int GetSpellEffectIndex(uint16 spell_id, int effect_id)
 		return -1;
 	}
 
+	// most lookups are for effects the spell does not have, answer those without touching the record
+	if (
+		effect_id >= 0 &&
+		effect_id < SPELL_EFFECT_BITSET_SIZE &&
+		spell_id < spell_effect_index.size() &&
+		!spell_effect_index[spell_id].test(effect_id)
+	) {
+		return -1;
+	}
+
 	const auto& spell = spells[spell_id];
 
 	for (int i = 0; i < EFFECT_COUNT; i++) {
@@ -22,6 +22,8 @@
 #include "skills.h"
 #include "item_data.h"
 
+#include <bitset>
+
 #define SPELL_UNKNOWN 0xFFFF
 #define POISON_PROC 0xFFFE
 #define SPELLBOOK_UNKNOWN 0xFFFFFFFF		//player profile spells are 32 bit
@@ -1590,6 +1592,10 @@ namespace SpellEffect {
 	constexpr int Duration_Endurance_Pct          = 526; // implemented - Decrease Current Endurance by % of Total Hit Points per Tick, up to a MAX per tick
 }
 
+// one bit per SpellEffect id; ids at or above this are looked up by scanning effect_id instead
+constexpr int SPELL_EFFECT_BITSET_SIZE = 576;
+using SpellEffectBitset = std::bitset<SPELL_EFFECT_BITSET_SIZE>;
+
 #define DF_Permanent				50
 #define DF_Aura						51
 #define PERMANENT_BUFF_DURATION 	-1000 //this is arbitrary used when overriding spells regular buff duration to set it as permenant
@@ -1810,6 +1816,10 @@ bool IsResistableSpell(uint16 spell_id);
 bool IsGroupSpell(uint16 spell_id);
 bool IsTGBCompatibleSpell(uint16 spell_id);
 bool IsBardSong(uint16 spell_id);
+void BuildSpellEffectIndex(const SPDat_Spell_Struct *sp, int32 records);
+// 0 while there is no index, otherwise changes every time the spell table is reloaded
+uint32 GetSpellEffectIndexGeneration();
+const SpellEffectBitset &GetSpellEffectBits(uint16 spell_id);
 bool IsEffectInSpell(uint16 spell_id, int effect_id);
 uint16 GetSpellTriggerSpellID(uint16 spell_id, int effect_id);
 bool IsBlankSpellEffect(uint16 spell_id, int effect_index);
@@ -0,0 +1,69 @@
+#ifndef EQEMU_SPSC_RING_H
+#define EQEMU_SPSC_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace EQ {
+
+	/**
+	 * Bounded single producer, single consumer ring, one thread pushes and one thread pops without locking
+	 *
+	 * The size is rounded up to a power of two. What to do when it is full is up to the owner, see the async log
+	 * writer (drop or wait) and EQ::Net::SPSCQueue (backlog)
+	 */
+	template<typename T>
+	class SPSCRing {
+	public:
+		explicit SPSCRing(size_t size)
+		{
+			size_t capacity = 2;
+			while (capacity < size) {
+				capacity <<= 1;
+			}
+
+			m_slots.resize(capacity);
+			m_mask = capacity - 1;
+		}
+
+		// producer, only moves out of item when there was room for it
+		bool TryPush(T &item)
+		{
+			const size_t head = m_head.load(std::memory_order_relaxed);
+			if (head - m_tail.load(std::memory_order_acquire) > m_mask) {
+				return false;
+			}
+
+			m_slots[head & m_mask] = std::move(item);
+			m_head.store(head + 1, std::memory_order_release);
+			return true;
+		}
+
+		// consumer
+		bool Pop(T &item)
+		{
+			const size_t tail = m_tail.load(std::memory_order_relaxed);
+			if (tail == m_head.load(std::memory_order_acquire)) {
+				return false;
+			}
+
+			item = std::move(m_slots[tail & m_mask]);
+			m_tail.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+
+		size_t Size() const { return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire); }
+		size_t Capacity() const { return m_mask + 1; }
+
+	private:
+		std::vector<T> m_slots;
+		size_t         m_mask = 0;
+
+		alignas(64) std::atomic<size_t> m_head{0};
+		alignas(64) std::atomic<size_t> m_tail{0};
+	};
+
+}
+
+#endif //EQEMU_SPSC_RING_H
@@ -5,6 +5,9 @@
 #include "serialize_buffer.h"
 #include <algorithm>
 #include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <unordered_set>
 
 #define MAXTASKSETS 1000
 #define MAXACTIVEQUESTS 19 // The Client has a hard cap of 19 active quests, 29 in SoD+
@@ -49,6 +52,53 @@ enum class TaskTimerType
 	Request
 };
 
+// a '|' delimited npc_match_list or item_id_list, split and lowered once at load instead of on every update
+struct TaskMatchList {
+	std::unordered_set<uint32_t> ids;      // entries that are exactly an id's decimal string
+	std::vector<std::string>     partials; // every entry lowered, an empty entry partially matches anything
+	size_t                       shortest_partial = 0;
+	bool                         empty = true;
+	bool                         ids_only = false; // every entry is also in ids
+
+	void Compile(const std::string &match_list)
+	{
+		ids.clear();
+		partials.clear();
+		shortest_partial = 0;
+		empty            = match_list.empty();
+		ids_only         = !empty;
+
+		for (auto &e : Strings::Split(match_list, '|')) {
+			const auto id = std::strtoull(e.c_str(), nullptr, 10);
+			if (id <= UINT32_MAX && std::to_string(id) == e) {
+				ids.insert(static_cast<uint32_t>(id));
+			} else {
+				ids_only = false;
+			}
+
+			shortest_partial = partials.empty() ? e.size() : std::min(shortest_partial, e.size());
+			partials.emplace_back(Strings::ToLower(e));
+		}
+	}
+
+	inline bool HasId(uint32_t id) const
+	{
+		return ids.find(id) != ids.end();
+	}
+
+	// same as Tasks::IsInMatchListPartial, entry must already be lowered
+	inline bool HasPartial(const std::string &lowered_entry) const
+	{
+		for (const auto &p : partials) {
+			if (lowered_entry.find(p) != std::string::npos) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+};
+
 struct ActivityInformation {
 	int              req_activity_id;
 	int              step;
@@ -64,6 +114,8 @@ struct ActivityInformation {
 	int              goal_count;
 	std::string      npc_match_list; // delimited by '|' for partial name matches but also supports ids
 	std::string      item_id_list; // delimited by '|' to support multiple item ids
+	TaskMatchList    npc_matcher; // compiled from npc_match_list
+	TaskMatchList    item_matcher; // compiled from item_id_list
 	int              dz_switch_id;
 	float            min_x;
 	float            min_y;
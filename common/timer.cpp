@@ -24,16 +24,21 @@
 #endif
 
 #include "timer.h"
+#include "timer_wheel.h"
 
 uint32 current_time = 0;
 uint32 last_time = 0;
 
+static thread_local uint64 check_count = 0;
+
 Timer::Timer() {
 	timer_time = 0;
 	start_time = current_time;
 	set_at_trigger = timer_time;
 	pUseAcurateTiming = false;
 	enabled = false;
+	wheel = nullptr;
+	wheel_id = 0;
 }
 
 Timer::Timer(uint32 in_timer_time, bool iUseAcurateTiming) {
@@ -41,6 +46,8 @@ Timer::Timer(uint32 in_timer_time, bool iUseAcurateTiming) {
 	start_time = current_time;
 	set_at_trigger = timer_time;
 	pUseAcurateTiming = iUseAcurateTiming;
+	wheel = nullptr;
+	wheel_id = 0;
 	if (timer_time == 0) {
 		enabled = false;
 	}
@@ -54,6 +61,8 @@ Timer::Timer(uint32 start, uint32 timer, bool iUseAcurateTiming = false) {
 	start_time = start;
 	set_at_trigger = timer_time;
 	pUseAcurateTiming = iUseAcurateTiming;
+	wheel = nullptr;
+	wheel_id = 0;
 	if (timer_time == 0) {
 		enabled = false;
 	}
@@ -62,6 +71,33 @@ Timer::Timer(uint32 start, uint32 timer, bool iUseAcurateTiming = false) {
 	}
 }
 
+Timer::Timer(const Timer &t) {
+	start_time = t.start_time;
+	timer_time = t.timer_time;
+	enabled = t.enabled;
+	set_at_trigger = t.set_at_trigger;
+	pUseAcurateTiming = t.pUseAcurateTiming;
+	wheel = nullptr;
+	wheel_id = 0;
+}
+
+Timer &Timer::operator=(const Timer &t) {
+	if (this != &t) {
+		start_time = t.start_time;
+		timer_time = t.timer_time;
+		enabled = t.enabled;
+		set_at_trigger = t.set_at_trigger;
+		pUseAcurateTiming = t.pUseAcurateTiming;
+		SyncWheel();
+	}
+
+	return *this;
+}
+
+Timer::~Timer() {
+	Detach();
+}
+
 /* Reimplemented for MSVC - Bounce */
 #ifdef _WINDOWS
 int gettimeofday (timeval *tp, ...)
@@ -80,6 +116,8 @@ int gettimeofday (timeval *tp, ...)
 /* This function checks if the timer triggered */
 bool Timer::Check(bool iReset)
 {
+	check_count++;
+
 	if (enabled && current_time-start_time > timer_time) {
 		if (iReset) {
 			if (pUseAcurateTiming)
@@ -87,6 +125,7 @@ bool Timer::Check(bool iReset)
 			else
 				start_time = current_time; // Reset timer
 			timer_time = set_at_trigger;
+			SyncWheel();
 		}
 		return true;
 	}
@@ -97,10 +136,12 @@ bool Timer::Check(bool iReset)
 /* This function disables the timer */
 void Timer::Disable() {
 	enabled = false;
+	SyncWheel();
 }
 
 void Timer::Enable() {
 	enabled = true;
+	SyncWheel();
 }
 
 /* This function set the timer and restart it */
@@ -113,6 +154,7 @@ void Timer::Start(uint32 set_timer_time, bool ChangeResetTimer) {
 		if (ChangeResetTimer)
 			set_at_trigger = set_timer_time;
 	}
+	SyncWheel();
 }
 
 /* This timer updates the timer without restarting it */
@@ -126,6 +168,7 @@ void Timer::SetTimer(uint32 set_timer_time) {
 		timer_time = set_timer_time;
 		set_at_trigger = set_timer_time;
 	}
+	SyncWheel();
 }
 
 uint32 Timer::GetRemainingTime() const
@@ -150,6 +193,7 @@ void Timer::SetAtTrigger(uint32 in_set_at_trigger, bool iEnableIfDisabled, bool
 	}
 	if (ChangeTimerTime)
 		timer_time = set_at_trigger;
+	SyncWheel();
 }
 
 void Timer::Trigger()
@@ -158,6 +202,60 @@ void Timer::Trigger()
 
 	timer_time = set_at_trigger;
 	start_time = current_time-timer_time-1;
+	SyncWheel();
+}
+
+void Timer::Attach(TimerWheel *in_wheel, std::function<void()> fn)
+{
+	Detach();
+
+	if (!in_wheel) {
+		return;
+	}
+
+	wheel = in_wheel;
+	wheel_id = wheel->Add(
+		[this, fn = std::move(fn), w = in_wheel]() {
+			const uint32 id = wheel_id;
+
+			if (Check()) {
+				fn();
+			}
+
+			// fn may have detached us, in which case there is nothing left to reschedule
+			if (w->Contains(id)) {
+				SyncWheel();
+			}
+		}
+	);
+
+	SyncWheel();
+}
+
+void Timer::Detach()
+{
+	if (!wheel) {
+		return;
+	}
+
+	wheel->Remove(wheel_id);
+	wheel = nullptr;
+	wheel_id = 0;
+}
+
+void Timer::SyncWheel()
+{
+	if (!wheel) {
+		return;
+	}
+
+	if (!enabled) {
+		wheel->Unschedule(wheel_id);
+		return;
+	}
+
+	// Check() passes once more than timer_time has elapsed since start_time
+	wheel->ScheduleAt(wheel_id, start_time + timer_time + 1);
 }
 
 const uint32 Timer::GetCurrentTime()
@@ -165,6 +263,11 @@ const uint32 Timer::GetCurrentTime()
 	return current_time;
 }
 
+const uint64 Timer::GetCheckCount()
+{
+	return check_count;
+}
+
 //just to keep all time related crap in one place... not really related to timers.
 const uint32 Timer::GetTimeSeconds() {
 	struct timeval read_time;
@@ -20,6 +20,7 @@
 
 #include "types.h"
 #include <chrono>
+#include <functional>
 
 // Disgrace: for windows compile
 #ifdef _WINDOWS
@@ -27,13 +28,18 @@
 	int gettimeofday (timeval *tp, ...);
 #endif
 
+class TimerWheel;
+
 class Timer
 {
 public:
 	Timer();
 	Timer(uint32 timer_time, bool iUseAcurateTiming = false);
 	Timer(uint32 start, uint32 timer, bool iUseAcurateTiming);
-	~Timer() { }
+	// copies only the timing state, a wheel attachment stays with the original
+	Timer(const Timer &t);
+	Timer &operator=(const Timer &t);
+	~Timer();
 
 	bool Check(bool iReset = true);
 	void Enable();
@@ -54,8 +60,18 @@ public:
 	static const uint32 RollForward(uint32 seconds);
 	static const uint32 GetCurrentTime();
 	static const uint32 GetTimeSeconds();
+	// Check() calls made on the calling thread, for measuring how much polling a loop does
+	static const uint64 GetCheckCount();
+
+	// Instead of polling Check() the wheel runs fn whenever Check() would have passed. Start, Disable etc. keep
+	// working as before and move the wheel entry along with them. fn must not destroy the timer it is attached to
+	void Attach(TimerWheel *wheel, std::function<void()> fn);
+	void Detach();
+	inline bool IsAttached() const { return wheel != nullptr; }
 
 private:
+	void SyncWheel();
+
 	uint32	start_time;
 	uint32	timer_time;
 	bool	enabled;
@@ -65,6 +81,9 @@ private:
 	// Instead of Check() setting the start_time = now,
 	// it it sets it to start_time += timer_time
 	bool	pUseAcurateTiming;
+
+	TimerWheel	*wheel;
+	uint32		wheel_id;
 };
 
 /* Wrapper around chrono to make adding simple time based benching easy
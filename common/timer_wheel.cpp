@@ -0,0 +1,230 @@
+#include "timer_wheel.h"
+#include "timer.h"
+
+#include <algorithm>
+
+TimerWheel::TimerWheel()
+{
+	for (int level = 0; level < LEVELS; ++level) {
+		m_levels[level].resize(level == 0 ? ROOT_SLOTS : LEVEL_SLOTS);
+	}
+
+	m_time             = Timer::GetCurrentTime();
+	m_last_check_count = Timer::GetCheckCount();
+}
+
+uint32 TimerWheel::Add(Callback fn)
+{
+	const uint32 id = m_next_id++;
+
+	m_entries[id].fn = std::move(fn);
+
+	return id;
+}
+
+void TimerWheel::Remove(uint32 id)
+{
+	auto it = m_entries.find(id);
+	if (it == m_entries.end()) {
+		return;
+	}
+
+	if (it->second.scheduled) {
+		m_scheduled--;
+	}
+
+	// anything left in the slots for this id is skipped when its slot comes up
+	m_entries.erase(it);
+}
+
+void TimerWheel::ScheduleAt(uint32 id, uint32 at)
+{
+	auto it = m_entries.find(id);
+	if (it == m_entries.end()) {
+		return;
+	}
+
+	auto &e = it->second;
+
+	int32 delay = static_cast<int32>(at - m_time);
+	if (delay < 1) {
+		delay = 1;
+	}
+
+	const uint64 expires = m_tick + static_cast<uint64>(delay);
+	if (e.scheduled && e.expires == expires) {
+		return;
+	}
+
+	if (!e.scheduled) {
+		m_scheduled++;
+	}
+
+	e.expires   = expires;
+	e.scheduled = true;
+	e.generation++;
+
+	Insert(id, e);
+}
+
+void TimerWheel::Unschedule(uint32 id)
+{
+	auto it = m_entries.find(id);
+	if (it == m_entries.end() || !it->second.scheduled) {
+		return;
+	}
+
+	it->second.scheduled = false;
+	it->second.generation++;
+	m_scheduled--;
+}
+
+bool TimerWheel::IsScheduled(uint32 id) const
+{
+	auto it = m_entries.find(id);
+	return it != m_entries.end() && it->second.scheduled;
+}
+
+void TimerWheel::Advance(uint32 now)
+{
+	const uint32 elapsed = now - m_time;
+	const uint64 target  = m_tick + elapsed;
+
+	const uint64 check_count = Timer::GetCheckCount();
+	m_last_tick_checks = check_count - m_last_check_count;
+	m_last_check_count = check_count;
+	m_max_tick_checks  = std::max(m_max_tick_checks, m_last_tick_checks);
+	m_total_checks += m_last_tick_checks;
+	m_ticks++;
+
+	m_last_tick_fired = 0;
+
+	if (m_scheduled == 0) {
+		// nothing can fire, only stale references are left in the slots
+		for (auto &level : m_levels) {
+			for (auto &slot : level) {
+				slot.clear();
+			}
+		}
+
+		m_tick = target;
+		m_time = now;
+		return;
+	}
+
+	// m_time steps with m_tick, so a callback scheduling from inside Fire is placed against the slot being fired
+	while (m_tick < target) {
+		m_tick++;
+		m_time++;
+
+		const uint32 index = m_tick & LevelMask(0);
+		if (index == 0) {
+			for (int level = 1; level < LEVELS; ++level) {
+				Cascade(level);
+				if (((m_tick >> LevelShift(level)) & LevelMask(level)) != 0) {
+					break;
+				}
+			}
+		}
+
+		Fire(m_levels[0][index]);
+	}
+}
+
+TimerWheel::Stats TimerWheel::GetStats() const
+{
+	Stats s{};
+	s.registered          = m_entries.size();
+	s.scheduled           = m_scheduled;
+	s.ticks               = m_ticks;
+	s.fired               = m_fired;
+	s.last_tick_fired     = m_last_tick_fired;
+	s.last_tick_checks    = m_last_tick_checks;
+	s.max_tick_checks     = m_max_tick_checks;
+	s.average_tick_checks = m_ticks ? static_cast<double>(m_total_checks) / m_ticks : 0.0;
+
+	return s;
+}
+
+void TimerWheel::Insert(uint32 id, Entry &e)
+{
+	uint64 expires = e.expires;
+	uint64 delta   = expires > m_tick ? expires - m_tick : 0;
+
+	// beyond the outermost level, park it at the far end and let cascading re-place it
+	if (delta >= MAX_SPAN) {
+		delta   = MAX_SPAN - 1;
+		expires = m_tick + delta;
+	}
+
+	int level = 0;
+	while (level < LEVELS - 1 && delta >= (1ull << LevelShift(level + 1))) {
+		level++;
+	}
+
+	const uint32 index = (expires >> LevelShift(level)) & LevelMask(level);
+
+	m_levels[level][index].push_back(SlotRef{id, e.generation});
+}
+
+void TimerWheel::Cascade(int level)
+{
+	const uint32 index = (m_tick >> LevelShift(level)) & LevelMask(level);
+
+	Slot refs;
+	refs.swap(m_levels[level][index]);
+
+	for (const auto &r : refs) {
+		auto it = m_entries.find(r.id);
+		if (it == m_entries.end() || !it->second.scheduled || it->second.generation != r.generation) {
+			continue;
+		}
+
+		Insert(r.id, it->second);
+	}
+}
+
+void TimerWheel::Fire(Slot &slot)
+{
+	if (slot.empty()) {
+		return;
+	}
+
+	Slot due;
+	due.swap(slot);
+
+	for (const auto &r : due) {
+		auto it = m_entries.find(r.id);
+		if (it == m_entries.end() || !it->second.scheduled || it->second.generation != r.generation) {
+			continue;
+		}
+
+		auto &e = it->second;
+
+		// a parked far-future entry, not due yet
+		if (e.expires > m_tick) {
+			Insert(r.id, e);
+			continue;
+		}
+
+		e.scheduled = false;
+		m_scheduled--;
+		m_fired++;
+		m_last_tick_fired++;
+
+		// the callback may reschedule, remove or add entries, so run it from a local copy
+		auto fn = std::move(e.fn);
+		fn();
+
+		it = m_entries.find(r.id);
+		if (it != m_entries.end() && !it->second.fn) {
+			it->second.fn = std::move(fn);
+		}
+	}
+
+	// hand the capacity back unless a callback already queued something here
+	if (slot.empty()) {
+		due.clear();
+		slot.swap(due);
+	}
+}
@@ -0,0 +1,102 @@
+#ifndef EQEMU_TIMER_WHEEL_H
+#define EQEMU_TIMER_WHEEL_H
+
+#include <array>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include "types.h"
+
+/**
+ * Hierarchical timing wheel driven off Timer::GetCurrentTime
+ *
+ * Entries are registered once and then (re)scheduled for a point in time, the owning loop calls Advance every tick
+ * and only the entries that actually came due are touched. The finest level has 1 ms slots, each coarser level
+ * covers the full span of the one below it and is cascaded down as time reaches it
+ *
+ * Timers can be migrated onto a wheel with Timer::Attach, see timer.h
+ */
+class TimerWheel {
+public:
+	using Callback = std::function<void()>;
+
+	struct Stats {
+		size_t registered;
+		size_t scheduled;
+		uint64 ticks;
+		uint64 fired;
+		uint32 last_tick_fired;
+		uint64 last_tick_checks; // Timer::Check calls made since the previous Advance
+		uint64 max_tick_checks;
+		double average_tick_checks;
+	};
+
+	static TimerWheel *Instance()
+	{
+		static TimerWheel instance;
+		return &instance;
+	}
+
+	TimerWheel();
+
+	// registers an unscheduled entry and returns its id, ids are never reused
+	uint32 Add(Callback fn);
+	void Remove(uint32 id);
+	inline bool Contains(uint32 id) const { return m_entries.find(id) != m_entries.end(); }
+
+	// at is in Timer::GetCurrentTime milliseconds, anything already due fires on the next Advance
+	void ScheduleAt(uint32 id, uint32 at);
+	void Unschedule(uint32 id);
+	bool IsScheduled(uint32 id) const;
+
+	void Advance(uint32 now);
+
+	Stats GetStats() const;
+
+private:
+	static constexpr int    LEVELS              = 4;
+	static constexpr uint32 ROOT_BITS           = 8;
+	static constexpr uint32 LEVEL_BITS          = 6;
+	static constexpr uint32 ROOT_SLOTS          = 1 << ROOT_BITS;
+	static constexpr uint32 LEVEL_SLOTS         = 1 << LEVEL_BITS;
+	static constexpr uint64 MAX_SPAN            = 1ull << (ROOT_BITS + LEVEL_BITS * (LEVELS - 1));
+
+	struct Entry {
+		Callback fn;
+		uint64   expires    = 0;
+		uint32   generation = 0;
+		bool     scheduled  = false;
+	};
+
+	struct SlotRef {
+		uint32 id;
+		uint32 generation;
+	};
+
+	using Slot = std::vector<SlotRef>;
+
+	void Insert(uint32 id, Entry &e);
+	void Cascade(int level);
+	void Fire(Slot &slot);
+
+	inline static uint32 LevelShift(int level) { return level == 0 ? 0 : ROOT_BITS + LEVEL_BITS * (level - 1); }
+	inline static uint32 LevelMask(int level) { return level == 0 ? ROOT_SLOTS - 1 : LEVEL_SLOTS - 1; }
+
+	std::array<std::vector<Slot>, LEVELS> m_levels;
+	std::unordered_map<uint32, Entry>     m_entries;
+
+	uint32 m_next_id   = 1;
+	uint64 m_tick      = 0; // wheel time, in ms since the wheel was created
+	uint32 m_time      = 0; // Timer::GetCurrentTime at m_tick
+	size_t m_scheduled = 0;
+
+	uint64 m_ticks            = 0;
+	uint64 m_fired            = 0;
+	uint32 m_last_tick_fired  = 0;
+	uint64 m_last_tick_checks = 0;
+	uint64 m_max_tick_checks  = 0;
+	uint64 m_total_checks     = 0;
+	uint64 m_last_check_count = 0;
+};
+
+#endif //EQEMU_TIMER_WHEEL_H
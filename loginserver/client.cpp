@@ -2,6 +2,7 @@
 #include "login_server.h"
 #include "encryption.h"
 #include "account_management.h"
+#include <algorithm>
 
 extern LoginServer server;
 
@@ -209,35 +210,90 @@ void Client::HandleLogin(const char *data, unsigned int size)
 
 	auto a = LoginAccountsRepository::GetAccountFromContext(database, c);
 	if (a.id > 0) {
-		login_success = VerifyAndUpdateLoginHash(c, a);
-
-		// if user updated their password on the login server, update it here by validating their credentials with the login server
-		if (std::getenv("LSPX") && !login_success && db_loginserver == "eqemu") {
-			LogInfo("LSPX | Attempting login account via [{}]", db_loginserver);
-			uint32 account_id = AccountManagement::CheckExternalLoginserverUserCredentials(c);
-			LogInfo("LSPX | External login account id [{}]", account_id);
-			if (account_id > 0) {
-				auto updated_account = LoginAccountsRepository::UpdateAccountPassword(database, a, cred);
-				if (!updated_account.id) {
-					LogError("Failed to update eqemu account [{}] password hash", account_id);
-					SendFailedLogin();
-					return;
-				}
+		VerifyPasswordLogin(c, a);
+		return;
+	}
+
+	// if we are here, the account does not exist
+	m_client_status = cs_creating_account;
+	AttemptLoginAccountCreation(c);
+}
 
-				LogInfo("Updating eqemu account [{}] password hash", account_id);
-				DoSuccessfulLogin(updated_account);
+bool Client::SubmitHashJob(std::function<void()> work, std::function<void()> done)
+{
+	std::weak_ptr<bool> alive = m_alive;
+
+	const bool admitted = server.hash_pool->Submit(
+		m_connection->GetRemoteIP(),
+		std::move(work),
+		[alive, done = std::move(done)]() {
+			// the client disconnected while its password was being hashed
+			if (alive.expired()) {
 				return;
 			}
+
+			done();
 		}
+	);
 
-		LogInfo("Successful login [{}]", (login_success ? "true" : "false"));
-		login_success ? DoSuccessfulLogin(a) : SendFailedLogin();
-		return;
+	if (!admitted) {
+		LogWarning(
+			"Password hashing is saturated, turning away login from {} ([{}] in flight)",
+			GetClientLoggingDescription(),
+			server.hash_pool->GetInFlight()
+		);
 	}
 
-	// if we are here, the account does not exist
-	m_client_status = cs_creating_account;
-	AttemptLoginAccountCreation(c);
+	return admitted;
+}
+
+void Client::VerifyPasswordLogin(const LoginAccountContext &c, const LoginAccountsRepository::LoginAccounts &a)
+{
+	m_client_status = cs_verifying_login;
+
+	auto r = std::make_shared<LoginHashResult>();
+
+	const bool admitted = SubmitHashJob(
+		[r, c, a]() {
+			*r = VerifyLoginHash(c, a);
+		},
+		[this, r, c, a]() mutable {
+			FinishPasswordLogin(c, a, ApplyLoginHashResult(c, a, *r));
+		}
+	);
+
+	if (!admitted) {
+		SendFailedLogin();
+	}
+}
+
+void Client::FinishPasswordLogin(
+	const LoginAccountContext &c,
+	LoginAccountsRepository::LoginAccounts &a,
+	bool login_success
+)
+{
+	// if user updated their password on the login server, update it here by validating their credentials with the login server
+	if (std::getenv("LSPX") && !login_success && c.source_loginserver == "eqemu") {
+		LogInfo("LSPX | Attempting login account via [{}]", c.source_loginserver);
+		uint32 account_id = AccountManagement::CheckExternalLoginserverUserCredentials(c);
+		LogInfo("LSPX | External login account id [{}]", account_id);
+		if (account_id > 0) {
+			auto updated_account = LoginAccountsRepository::UpdateAccountPassword(database, a, c.password);
+			if (!updated_account.id) {
+				LogError("Failed to update eqemu account [{}] password hash", account_id);
+				SendFailedLogin();
+				return;
+			}
+
+			LogInfo("Updating eqemu account [{}] password hash", account_id);
+			DoSuccessfulLogin(updated_account);
+			return;
+		}
+	}
+
+	LogInfo("Successful login [{}]", (login_success ? "true" : "false"));
+	login_success ? DoSuccessfulLogin(a) : SendFailedLogin();
 }
 
 void Client::SendPlayToWorld(const char *data)
@@ -322,18 +378,37 @@ void Client::AttemptLoginAccountCreation(LoginAccountContext c)
 
 	if (server.options.CanAutoCreateAccounts() && c.source_loginserver == "local") {
 		LogInfo("CanAutoCreateAccounts enabled, attempting to crate account [{}]", c.username);
-		auto a = LoginAccountsRepository::CreateAccountFromContext(database, c);
-		if (a.id > 0) {
-			DoSuccessfulLogin(a);
-			return;
-		}
-
+		CreateLocalAccount(c);
 		return;
 	}
 
 	SendFailedLogin();
 }
 
+void Client::CreateLocalAccount(LoginAccountContext c)
+{
+	auto hash = std::make_shared<std::string>();
+
+	const bool admitted = SubmitHashJob(
+		[hash, c]() {
+			*hash = EncryptPasswordFromContext(c).password;
+		},
+		[this, hash, c]() mutable {
+			c.password              = *hash;
+			c.password_is_encrypted = true;
+
+			auto a = LoginAccountsRepository::CreateAccountFromContext(database, c);
+			if (a.id > 0) {
+				DoSuccessfulLogin(a);
+			}
+		}
+	);
+
+	if (!admitted) {
+		SendFailedLogin();
+	}
+}
+
 void Client::SendFailedLogin()
 {
 	m_stored_username.clear();
@@ -364,11 +439,14 @@ void Client::SendFailedLogin()
 	m_client_status = cs_failed_to_login;
 }
 
-bool Client::VerifyAndUpdateLoginHash(LoginAccountContext c, const LoginAccountsRepository::LoginAccounts &a)
+LoginHashResult Client::VerifyLoginHash(const LoginAccountContext &c, const LoginAccountsRepository::LoginAccounts &a)
 {
+	LoginHashResult r;
+
 	auto encryption_mode = server.options.GetEncryptionMode();
 	if (eqcrypt_verify_hash(a.account_name, c.password, a.account_password, encryption_mode)) {
-		return true;
+		r.verified = true;
+		return r;
 	}
 
 	if (encryption_mode < EncryptionModeArgon2) {
@@ -402,22 +480,42 @@ bool Client::VerifyAndUpdateLoginHash(LoginAccountContext c, const LoginAccounts
 	}
 
 	if (insecure_source_encryption_mode > 0) {
+		LoginAccountContext u;
+		u.username = a.account_name;
+		u.password = c.password;
+
+		r.verified             = true;
+		r.insecure_source_mode = insecure_source_encryption_mode;
+		r.upgraded_hash        = EncryptPasswordFromContext(u).password;
+	}
+
+	return r;
+}
+
+bool Client::ApplyLoginHashResult(
+	const LoginAccountContext &c,
+	LoginAccountsRepository::LoginAccounts &a,
+	const LoginHashResult &r
+)
+{
+	if (r.insecure_source_mode > 0) {
+		auto encryption_mode = std::max(server.options.GetEncryptionMode(), static_cast<int>(EncryptionModeArgon2));
+
 		LogInfo(
 			"Updated insecure password user [{}] loginserver [{}] from mode [{}] ({}) to mode [{}] ({})",
 			c.username,
 			c.source_loginserver,
-			GetEncryptionByModeId(insecure_source_encryption_mode),
-			insecure_source_encryption_mode,
+			GetEncryptionByModeId(r.insecure_source_mode),
+			r.insecure_source_mode,
 			GetEncryptionByModeId(encryption_mode),
 			encryption_mode
 		);
 
-		LoginAccountsRepository::UpdateAccountPassword(database, a, c.password);
-
-		return true;
+		a.account_password = r.upgraded_hash;
+		LoginAccountsRepository::UpdateOne(database, a);
 	}
 
-	return false;
+	return r.verified;
 }
 
 void Client::DoSuccessfulLogin(LoginAccountsRepository::LoginAccounts &a)
@@ -9,8 +9,16 @@
 #include "../common/net/reliable_stream_connection.h"
 #include "login_types.h"
 #include "../common/repositories/login_accounts_repository.h"
+#include <functional>
 #include <memory>
 
+// outcome of checking a login against the stored hash, filled in on a hashing thread
+struct LoginHashResult {
+	bool        verified             = false;
+	uint32      insecure_source_mode = 0; // set when the password matched an older mode and should be re-hashed
+	std::string upgraded_hash;
+};
+
 class Client {
 public:
 	Client(std::shared_ptr<EQStreamInterface> c, LSClientVersion v);
@@ -40,9 +48,11 @@ public:
 
 	void AttemptLoginAccountCreation(LoginAccountContext c);
 	void SendFailedLogin();
-	bool VerifyAndUpdateLoginHash(LoginAccountContext c, const LoginAccountsRepository::LoginAccounts& a);
 	void DoSuccessfulLogin(LoginAccountsRepository::LoginAccounts& a);
 
+	// safe to call from any thread, touches neither the client nor the database
+	static LoginHashResult VerifyLoginHash(const LoginAccountContext &c, const LoginAccountsRepository::LoginAccounts &a);
+
 private:
 	EQ::Random                                          m_random;
 	std::shared_ptr<EQStreamInterface>                  m_connection;
@@ -59,9 +69,17 @@ private:
 	LoginBaseMessage                                    m_login_base_message;
 	std::string                                         m_stored_username;
 	std::string                                         m_stored_password;
+	// expires with the client, pending hash jobs check it before calling back
+	std::shared_ptr<bool>                               m_alive = std::make_shared<bool>(true);
 	static bool ProcessHealthCheck(std::string username) {
 		return username == "healthcheckuser";
 	}
+
+	bool SubmitHashJob(std::function<void()> work, std::function<void()> done);
+	void VerifyPasswordLogin(const LoginAccountContext &c, const LoginAccountsRepository::LoginAccounts &a);
+	bool ApplyLoginHashResult(const LoginAccountContext &c, LoginAccountsRepository::LoginAccounts &a, const LoginHashResult &r);
+	void FinishPasswordLogin(const LoginAccountContext &c, LoginAccountsRepository::LoginAccounts &a, bool login_success);
+	void CreateLocalAccount(LoginAccountContext c);
 };
 
 #endif
@@ -0,0 +1,209 @@
+#include "hash_worker_pool.h"
+#include "../common/event/event_loop.h"
+#include "../common/eqemu_logsys.h"
+#include <algorithm>
+
+HashWorkerPool::~HashWorkerPool()
+{
+	Stop();
+}
+
+void HashWorkerPool::Start(int threads, size_t max_in_flight, int max_in_flight_per_ip)
+{
+	if (m_running) {
+		return;
+	}
+
+	m_max_in_flight        = std::max<size_t>(max_in_flight, 1);
+	m_max_in_flight_per_ip = std::max(max_in_flight_per_ip, 1);
+
+	if (threads <= 0) {
+		LogInfo("Password hashing runs inline on the event loop");
+		return;
+	}
+
+	uv_async_init(EQ::EventLoop::Get().Handle(), &m_async, &HashWorkerPool::OnCompletion);
+	m_async.data = this;
+
+	m_running = true;
+	for (int i = 0; i < threads; ++i) {
+		m_threads.emplace_back(&HashWorkerPool::Worker, this);
+	}
+
+	LogInfo(
+		"Password hashing pool started with [{}] thread(s) max in flight [{}] max in flight per ip [{}]",
+		threads,
+		m_max_in_flight,
+		m_max_in_flight_per_ip
+	);
+}
+
+void HashWorkerPool::Stop()
+{
+	if (!m_running) {
+		return;
+	}
+
+	{
+		std::unique_lock<std::mutex> lock(m_lock);
+		m_running = false;
+	}
+
+	m_cv.notify_all();
+
+	for (auto &t : m_threads) {
+		t.join();
+	}
+
+	m_threads.clear();
+
+	// clients are gone by now, whatever is left is dropped without calling back
+	m_queue.clear();
+	m_completed.clear();
+	m_in_flight = 0;
+	m_in_flight_per_ip.clear();
+
+	uv_close(reinterpret_cast<uv_handle_t *>(&m_async), nullptr);
+}
+
+bool HashWorkerPool::Submit(uint32 ip, std::function<void()> work, std::function<void()> done)
+{
+	m_stats.submitted++;
+
+	if (!m_running) {
+		const auto start = std::chrono::steady_clock::now();
+		work();
+		const auto us = static_cast<uint64>(
+			std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count()
+		);
+
+		m_stats.completed++;
+		m_stats.work_total_us += us;
+		m_stats.work_max_us = std::max(m_stats.work_max_us, us);
+
+		done();
+		return true;
+	}
+
+	if (m_in_flight >= m_max_in_flight) {
+		m_stats.rejected_queue++;
+		return false;
+	}
+
+	auto &per_ip = m_in_flight_per_ip[ip];
+	if (per_ip >= m_max_in_flight_per_ip) {
+		m_stats.rejected_ip++;
+		return false;
+	}
+
+	per_ip++;
+	m_in_flight++;
+
+	Job j;
+	j.ip        = ip;
+	j.work      = std::move(work);
+	j.done      = std::move(done);
+	j.queued_at = std::chrono::steady_clock::now();
+
+	{
+		std::unique_lock<std::mutex> lock(m_lock);
+		m_queue.push_back(std::move(j));
+	}
+
+	m_cv.notify_one();
+
+	return true;
+}
+
+void HashWorkerPool::Worker()
+{
+	for (;;) {
+		Job j;
+
+		{
+			std::unique_lock<std::mutex> lock(m_lock);
+			m_cv.wait(lock, [this] { return !m_running || !m_queue.empty(); });
+
+			if (!m_running) {
+				return;
+			}
+
+			j = std::move(m_queue.front());
+			m_queue.pop_front();
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+
+		j.work();
+
+		const auto end = std::chrono::steady_clock::now();
+
+		j.wait_us = static_cast<uint64>(std::chrono::duration_cast<std::chrono::microseconds>(start - j.queued_at).count());
+		j.work_us = static_cast<uint64>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+
+		{
+			std::unique_lock<std::mutex> lock(m_lock);
+			m_completed.push_back(std::move(j));
+		}
+
+		// coalesces, one wake up can drain many completions
+		uv_async_send(&m_async);
+	}
+}
+
+void HashWorkerPool::OnCompletion(uv_async_t *handle)
+{
+	static_cast<HashWorkerPool *>(handle->data)->DrainCompletions();
+}
+
+void HashWorkerPool::DrainCompletions()
+{
+	std::deque<Job> completed;
+
+	{
+		std::unique_lock<std::mutex> lock(m_lock);
+		completed.swap(m_completed);
+	}
+
+	for (auto &j : completed) {
+		auto it = m_in_flight_per_ip.find(j.ip);
+		if (it != m_in_flight_per_ip.end() && --it->second <= 0) {
+			m_in_flight_per_ip.erase(it);
+		}
+
+		m_in_flight--;
+
+		m_stats.completed++;
+		m_stats.wait_total_us += j.wait_us;
+		m_stats.wait_max_us = std::max(m_stats.wait_max_us, j.wait_us);
+		m_stats.work_total_us += j.work_us;
+		m_stats.work_max_us = std::max(m_stats.work_max_us, j.work_us);
+
+		j.done();
+	}
+}
+
+void HashWorkerPool::LogStats()
+{
+	if (m_stats.submitted == 0) {
+		return;
+	}
+
+	const uint64 completed = std::max<uint64>(m_stats.completed, 1);
+
+	LogInfo(
+		"Password hashing submitted [{}] completed [{}] rejected full [{}] rejected ip [{}] in flight [{}] "
+		"queue wait avg [{}] us max [{}] us hash time avg [{}] us max [{}] us",
+		m_stats.submitted,
+		m_stats.completed,
+		m_stats.rejected_queue,
+		m_stats.rejected_ip,
+		m_in_flight,
+		m_stats.wait_total_us / completed,
+		m_stats.wait_max_us,
+		m_stats.work_total_us / completed,
+		m_stats.work_max_us
+	);
+
+	m_stats = {};
+}
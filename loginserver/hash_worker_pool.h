@@ -0,0 +1,85 @@
+#ifndef EQEMU_HASH_WORKER_POOL_H
+#define EQEMU_HASH_WORKER_POOL_H
+
+#include "../common/types.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <uv.h>
+
+/**
+ * Runs password hashing and verification off the event loop
+ *
+ * Jobs are admitted on the event loop thread, run on a fixed set of worker threads and their completion callback is
+ * posted back to the event loop, so everything outside of the work function keeps running single threaded. Admission
+ * is bounded both in total and per client ip, a job that is turned away never runs either callback
+ *
+ * With no worker threads configured jobs run inline on submit, which is the old behavior
+ */
+class HashWorkerPool {
+public:
+	struct Stats {
+		uint64 submitted      = 0;
+		uint64 completed      = 0;
+		uint64 rejected_queue = 0;
+		uint64 rejected_ip    = 0;
+		uint64 wait_total_us  = 0;
+		uint64 wait_max_us    = 0;
+		uint64 work_total_us  = 0;
+		uint64 work_max_us    = 0;
+	};
+
+	~HashWorkerPool();
+
+	// must be called from the event loop thread
+	void Start(int threads, size_t max_in_flight, int max_in_flight_per_ip);
+	void Stop();
+
+	// work runs on a pool thread, done on the event loop thread once work has returned
+	// returns false when the job was not admitted
+	bool Submit(uint32 ip, std::function<void()> work, std::function<void()> done);
+
+	size_t GetInFlight() const { return m_in_flight; }
+	const Stats &GetStats() const { return m_stats; }
+
+	// logs and resets the stats window, quiet when nothing was submitted
+	void LogStats();
+
+private:
+	struct Job {
+		uint32                                ip      = 0;
+		std::function<void()>                 work;
+		std::function<void()>                 done;
+		std::chrono::steady_clock::time_point queued_at;
+		uint64                                wait_us = 0;
+		uint64                                work_us = 0;
+	};
+
+	void Worker();
+	void DrainCompletions();
+	static void OnCompletion(uv_async_t *handle);
+
+	std::vector<std::thread> m_threads;
+	bool                     m_running = false;
+	uv_async_t               m_async{};
+
+	// shared with the workers
+	std::mutex              m_lock;
+	std::condition_variable m_cv;
+	std::deque<Job>         m_queue;
+	std::deque<Job>         m_completed;
+
+	// event loop thread only
+	size_t                          m_max_in_flight        = 0;
+	int                             m_max_in_flight_per_ip = 0;
+	size_t                          m_in_flight            = 0;
+	std::unordered_map<uint32, int> m_in_flight_per_ip;
+	Stats                           m_stats;
+};
+
+#endif
@@ -8,6 +8,7 @@
 #include "world_server_manager.h"
 #include "client_manager.h"
 #include "loginserver_webserver.h"
+#include "hash_worker_pool.h"
 
 struct LoginServer {
 public:
@@ -22,6 +23,7 @@ public:
 	Options                            options;
 	WorldServerManager                 *server_manager;
 	ClientManager                      *client_manager{};
+	HashWorkerPool                     *hash_pool{};
 };
 
 #endif
@@ -92,7 +92,8 @@ enum LSClientStatus {
 	cs_waiting_for_login,
 	cs_creating_account,
 	cs_failed_to_login,
-	cs_logged_in
+	cs_logged_in,
+	cs_verifying_login
 };
 
 struct LoginWorldContext {
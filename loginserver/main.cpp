@@ -203,6 +203,14 @@ int main(int argc, char **argv)
 		return 1;
 	}
 
+	LogInfo("Password Hashing Init");
+	server.hash_pool = new HashWorkerPool();
+	server.hash_pool->Start(
+		server.config.GetVariableInt("security", "hash_threads", 2),
+		server.config.GetVariableInt("security", "hash_max_in_flight", 256),
+		server.config.GetVariableInt("security", "hash_max_in_flight_per_ip", 4)
+	);
+
 #ifdef WIN32
 #ifdef UNICODE
 		SetConsoleTitle(L"EQEmu Login Server");
@@ -242,6 +250,7 @@ int main(int argc, char **argv)
 	LogInfo("[Config] [Security] IsTokenLoginAllowed [{}]", server.options.IsTokenLoginAllowed());
 
 	Timer keepalive(INTERSERVER_TIMER); // does auto-reconnect
+	Timer hash_stats(60000);
 
 	auto loop_fn = [&](EQ::Timer* t) {
 		Timer::SetCurrentTime();
@@ -251,6 +260,11 @@ int main(int argc, char **argv)
 			database.ping();
 		}
 
+		if (hash_stats.Check()) {
+			hash_stats.Start();
+			server.hash_pool->LogStats();
+		}
+
 		if (!run_server) {
 			EQ::EventLoop::Get().Shutdown();
 			return;
@@ -266,6 +280,9 @@ int main(int argc, char **argv)
 
 	LogInfo("Server Shutdown");
 
+	LogInfo("Password Hashing Shutdown");
+	delete server.hash_pool;
+
 	LogInfo("Client Manager Shutdown");
 	delete server.client_manager;
 
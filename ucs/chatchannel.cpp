@@ -24,9 +24,11 @@
 #include "database.h"
 #include <cstdlib>
 #include <algorithm>
+#include <memory>
 
 extern UCSDatabase database;
 extern uint32 ChatMessagesSent;
+extern std::string WorldShortName;
 
 void ServerToClient45SayLink(std::string& clientSayLink, const std::string& serverSayLink);
 void ServerToClient50SayLink(std::string& clientSayLink, const std::string& serverSayLink);
@@ -58,13 +60,6 @@ ChatChannel::ChatChannel(const std::string& inName, const std::string& inOwner,
 }
 
 ChatChannel::~ChatChannel() {
-
-	LinkedListIterator<Client*> iterator(m_clients_in_channel);
-
-	iterator.Reset();
-
-	while(iterator.MoreElements())
-		iterator.RemoveCurrent(false);
 }
 
 ChatChannel *ChatChannelList::CreateChannel(
@@ -105,6 +100,8 @@ ChatChannel *ChatChannelList::CreateChannel(
 
 	ChatChannels.Insert(new_channel);
 
+	m_channels_by_name[new_channel->GetName()] = new_channel;
+
 	if (owner == SYSTEM_OWNER) {
 		save_to_db = false;
 	}
@@ -139,8 +136,21 @@ ChatChannel *ChatChannelList::CreateChannel(
 
 ChatChannel* ChatChannelList::FindChannel(const std::string& Name) {
 
-	std::string normalized_name = CapitaliseName(Name);
+	auto it = m_channels_by_name.find(CapitaliseName(Name));
+
+	return it != m_channels_by_name.end() ? it->second : nullptr;
+}
+
+void ChatChannelList::UnindexChannel(ChatChannel *Channel) {
+
+	auto it = m_channels_by_name.find(Channel->GetName());
+
+	if(it == m_channels_by_name.end() || it->second != Channel)
+		return;
+
+	m_channels_by_name.erase(it);
 
+	// a same named channel created earlier becomes the one FindChannel returns again
 	LinkedListIterator<ChatChannel*> iterator(ChatChannels);
 
 	iterator.Reset();
@@ -149,13 +159,13 @@ ChatChannel* ChatChannelList::FindChannel(const std::string& Name) {
 
 		auto *current_channel = iterator.GetData();
 
-		if(current_channel && (current_channel->m_name == normalized_name))
-			return iterator.GetData();
+		if(current_channel && current_channel != Channel && current_channel->m_name == Channel->GetName()) {
+			m_channels_by_name[current_channel->m_name] = current_channel;
+			return;
+		}
 
 		iterator.Advance();
 	}
-
-	return nullptr;
 }
 
 void ChatChannelList::SendAllChannels(Client *c) {
@@ -230,6 +240,8 @@ void ChatChannelList::RemoveChannel(ChatChannel *Channel) {
 
 		if(iterator.GetData() == Channel) {
 
+			UnindexChannel(Channel);
+
 			iterator.RemoveCurrent();
 
 			return;
@@ -243,6 +255,8 @@ void ChatChannelList::RemoveAllChannels() {
 
 	LogDebug("RemoveAllChannels");
 
+	m_channels_by_name.clear();
+
 	LinkedListIterator<ChatChannel*> iterator(ChatChannels);
 
 	iterator.Reset();
@@ -255,18 +269,10 @@ int ChatChannel::MemberCount(int Status) {
 
 	int Count = 0;
 
-	LinkedListIterator<Client*> iterator(m_clients_in_channel);
+	for(auto *ChannelClient : m_clients_in_channel) {
 
-	iterator.Reset();
-
-	while(iterator.MoreElements()) {
-
-		Client *ChannelClient = iterator.GetData();
-
-		if(ChannelClient && (!ChannelClient->GetHideMe() || (ChannelClient->GetAccountStatus() < Status)))
+		if(!ChannelClient->GetHideMe() || (ChannelClient->GetAccountStatus() < Status))
 			Count++;
-
-		iterator.Advance();
 	}
 
 	return Count;
@@ -323,22 +329,15 @@ void ChatChannel::AddClient(Client *c) {
 
 	LogDebug("Adding [{}] to channel [{}]", c->GetName().c_str(), m_name.c_str());
 
-	LinkedListIterator<Client*> iterator(m_clients_in_channel);
-
-	iterator.Reset();
+	for(auto *CurrentClient : m_clients_in_channel) {
 
-	while(iterator.MoreElements()) {
-
-		Client *CurrentClient = iterator.GetData();
-
-		if(CurrentClient && CurrentClient->IsAnnounceOn())
+		if(CurrentClient->IsAnnounceOn())
 			if(!HideMe || (CurrentClient->GetAccountStatus() > AccountStatus))
 				CurrentClient->AnnounceJoin(this, c);
-
-		iterator.Advance();
 	}
 
-	m_clients_in_channel.Insert(c);
+	m_clients_in_channel.push_back(c);
+	m_client_set.insert(c);
 
 }
 
@@ -352,30 +351,17 @@ bool ChatChannel::RemoveClient(Client *c) {
 
 	int account_status = c->GetAccountStatus();
 
-	int players_in_channel = 0;
-
-	LinkedListIterator<Client*> iterator(m_clients_in_channel);
-
-	iterator.Reset();
-
-	while(iterator.MoreElements()) {
-
-		auto *current_client = iterator.GetData();
-
-		if(current_client == c) {
-			iterator.RemoveCurrent(false);
-		}
-		else if(current_client) {
+	if(m_client_set.erase(c)) {
+		m_clients_in_channel.erase(std::find(m_clients_in_channel.begin(), m_clients_in_channel.end(), c));
+	}
 
-			players_in_channel++;
+	int players_in_channel = static_cast<int>(m_clients_in_channel.size());
 
-			if(current_client->IsAnnounceOn())
-				if(!hide_me || (current_client->GetAccountStatus() > account_status))
-					current_client->AnnounceLeave(this, c);
-
-			iterator.Advance();
-		}
+	for(auto *current_client : m_clients_in_channel) {
 
+		if(current_client->IsAnnounceOn())
+			if(!hide_me || (current_client->GetAccountStatus() > account_status))
+				current_client->AnnounceLeave(this, c);
 	}
 
 	if((players_in_channel == 0) && !m_permanent) {
@@ -426,20 +412,12 @@ void ChatChannel::SendChannelMembers(Client *c) {
 
 	int MembersInLine = 0;
 
-	LinkedListIterator<Client*> iterator(m_clients_in_channel);
-
-	iterator.Reset();
-
-	while(iterator.MoreElements()) {
-
-		Client *ChannelClient = iterator.GetData();
+	for(auto *ChannelClient : m_clients_in_channel) {
 
 		// Don't list hidden characters with status higher or equal than the character requesting the list.
 		//
-		if(!ChannelClient || (ChannelClient->GetHideMe() && (ChannelClient->GetAccountStatus() >= AccountStatus))) {
-			iterator.Advance();
+		if(ChannelClient->GetHideMe() && (ChannelClient->GetAccountStatus() >= AccountStatus))
 			continue;
-		}
 
 		if(MembersInLine > 0)
 			Message += ", ";
@@ -456,8 +434,6 @@ void ChatChannel::SendChannelMembers(Client *c) {
 
 			Message.clear();
 		}
-
-		iterator.Advance();
 	}
 
 	if(MembersInLine > 0)
@@ -469,47 +445,45 @@ void ChatChannel::SendMessageToChannel(const std::string& Message, Client* Sende
 
 	if(!Sender) return;
 
-	std::string cv_messages[EQ::versions::ClientVersionCount];
+	// saylinks are converted and the packet built once per client version, every member on that version gets the same one
+	std::unique_ptr<EQApplicationPacket> cv_packets[EQ::versions::ClientVersionCount];
 
-	ChatMessagesSent++;
-
-	LinkedListIterator<Client*> iterator(m_clients_in_channel);
+	const std::string FQSenderName = WorldShortName + "." + Sender->GetName();
 
-	iterator.Reset();
-
-	while(iterator.MoreElements()) {
+	ChatMessagesSent++;
 
-		auto *channel_client = iterator.GetData();
-
-		if(channel_client)
-		{
-			LogDebug("Sending message to [{}] from [{}]",
-				channel_client->GetName().c_str(), Sender->GetName().c_str());
-
-			if (cv_messages[static_cast<uint32>(channel_client->GetClientVersion())].length() == 0) {
-				switch (channel_client->GetClientVersion()) {
-				case EQ::versions::ClientVersion::Titanium:
-					ServerToClient45SayLink(cv_messages[static_cast<uint32>(channel_client->GetClientVersion())], Message);
-					break;
-				case EQ::versions::ClientVersion::SoF:
-				case EQ::versions::ClientVersion::SoD:
-				case EQ::versions::ClientVersion::UF:
-					ServerToClient50SayLink(cv_messages[static_cast<uint32>(channel_client->GetClientVersion())], Message);
-					break;
-				case EQ::versions::ClientVersion::RoF:
-					ServerToClient55SayLink(cv_messages[static_cast<uint32>(channel_client->GetClientVersion())], Message);
-					break;
-				case EQ::versions::ClientVersion::RoF2:
-				default:
-					cv_messages[static_cast<uint32>(channel_client->GetClientVersion())] = Message;
-					break;
-				}
+	for(auto *channel_client : m_clients_in_channel) {
+
+		LogDebug("Sending message to [{}] from [{}]",
+			channel_client->GetName().c_str(), Sender->GetName().c_str());
+
+		auto &packet = cv_packets[static_cast<uint32>(channel_client->GetClientVersion())];
+
+		if (!packet) {
+			std::string cv_message;
+
+			switch (channel_client->GetClientVersion()) {
+			case EQ::versions::ClientVersion::Titanium:
+				ServerToClient45SayLink(cv_message, Message);
+				break;
+			case EQ::versions::ClientVersion::SoF:
+			case EQ::versions::ClientVersion::SoD:
+			case EQ::versions::ClientVersion::UF:
+				ServerToClient50SayLink(cv_message, Message);
+				break;
+			case EQ::versions::ClientVersion::RoF:
+				ServerToClient55SayLink(cv_message, Message);
+				break;
+			case EQ::versions::ClientVersion::RoF2:
+			default:
+				cv_message = Message;
+				break;
 			}
 
-			channel_client->SendChannelMessage(m_name, cv_messages[static_cast<uint32>(channel_client->GetClientVersion())], Sender);
+			packet = Client::MakeChannelMessagePacket(m_name, cv_message, FQSenderName, channel_client->IsUnderfootOrLater());
 		}
 
-		iterator.Advance();
+		channel_client->QueuePacket(packet.get());
 	}
 }
 
@@ -517,23 +491,12 @@ void ChatChannel::SetModerated(bool inModerated) {
 
 	m_moderated = inModerated;
 
-	LinkedListIterator<Client*> iterator(m_clients_in_channel);
-
-	iterator.Reset();
-
-	while(iterator.MoreElements()) {
-
-		Client *ChannelClient = iterator.GetData();
-
-		if(ChannelClient) {
-
-			if(m_moderated)
-				ChannelClient->GeneralChannelMessage("Channel " + m_name + " is now moderated.");
-			else
-				ChannelClient->GeneralChannelMessage("Channel " + m_name + " is no longer moderated.");
-		}
+	for(auto *ChannelClient : m_clients_in_channel) {
 
-		iterator.Advance();
+		if(m_moderated)
+			ChannelClient->GeneralChannelMessage("Channel " + m_name + " is now moderated.");
+		else
+			ChannelClient->GeneralChannelMessage("Channel " + m_name + " is no longer moderated.");
 	}
 
 }
@@ -541,19 +504,7 @@ bool ChatChannel::IsClientInChannel(Client *c) {
 
 	if(!c) return false;
 
-	LinkedListIterator<Client*> iterator(m_clients_in_channel);
-
-	iterator.Reset();
-
-	while(iterator.MoreElements()) {
-
-		if(iterator.GetData() == c)
-			return true;
-
-		iterator.Advance();
-	}
-
-	return false;
+	return m_client_set.count(c) > 0;
 }
 
 ChatChannel *ChatChannelList::AddClientToChannel(std::string channel_name, Client *c, bool command_directed) {
@@ -701,6 +652,8 @@ void ChatChannelList::Process() {
 			LogDebug("Empty temporary password protected channel [{}] being destroyed",
 				CurrentChannel->GetName().c_str());
 
+			UnindexChannel(CurrentChannel);
+
 			iterator.RemoveCurrent();
 		}
 		else {
@@ -711,8 +664,7 @@ void ChatChannelList::Process() {
 
 void ChatChannel::AddInvitee(const std::string &Invitee)
 {
-	if (!IsInvitee(Invitee)) {
-		m_invitees.push_back(Invitee);
+	if (m_invitees.insert(Invitee).second) {
 
 		LogDebug("Added [{}] as invitee to channel [{}]", Invitee.c_str(), m_name.c_str());
 	}
@@ -721,22 +673,19 @@ void ChatChannel::AddInvitee(const std::string &Invitee)
 
 void ChatChannel::RemoveInvitee(std::string Invitee)
 {
-	auto it = std::find(std::begin(m_invitees), std::end(m_invitees), Invitee);
-
-	if(it != std::end(m_invitees)) {
-		m_invitees.erase(it);
+	if(m_invitees.erase(Invitee)) {
 		LogDebug("Removed [{}] as invitee to channel [{}]", Invitee.c_str(), m_name.c_str());
 	}
 }
 
 bool ChatChannel::IsInvitee(std::string Invitee)
 {
-	return std::find(std::begin(m_invitees), std::end(m_invitees), Invitee) != std::end(m_invitees);
+	return m_invitees.count(Invitee) > 0;
 }
 
 void ChatChannel::AddModerator(const std::string &Moderator)
 {
-	if (!IsModerator(Moderator)) {
+	if (m_moderator_set.insert(Moderator).second) {
 		m_moderators.push_back(Moderator);
 
 		LogInfo("Added [{}] as moderator to channel [{}]", Moderator.c_str(), m_name.c_str());
@@ -746,23 +695,20 @@ void ChatChannel::AddModerator(const std::string &Moderator)
 
 void ChatChannel::RemoveModerator(const std::string &Moderator)
 {
-	auto it = std::find(std::begin(m_moderators), std::end(m_moderators), Moderator);
-
-	if (it != std::end(m_moderators)) {
-		m_moderators.erase(it);
+	if (m_moderator_set.erase(Moderator)) {
+		m_moderators.erase(std::find(std::begin(m_moderators), std::end(m_moderators), Moderator));
 		LogInfo("Removed [{}] as moderator to channel [{}]", Moderator.c_str(), m_name.c_str());
 	}
 }
 
 bool ChatChannel::IsModerator(std::string Moderator)
 {
-	return std::find(std::begin(m_moderators), std::end(m_moderators), Moderator) != std::end(m_moderators);
+	return m_moderator_set.count(Moderator) > 0;
 }
 
 void ChatChannel::AddVoice(const std::string &inVoiced)
 {
-	if (!HasVoice(inVoiced)) {
-		m_voiced.push_back(inVoiced);
+	if (m_voiced.insert(inVoiced).second) {
 
 		LogInfo("Added [{}] as voiced to channel [{}]", inVoiced.c_str(), m_name.c_str());
 	}
@@ -770,10 +716,7 @@ void ChatChannel::AddVoice(const std::string &inVoiced)
 
 void ChatChannel::RemoveVoice(const std::string &inVoiced)
 {
-	auto it = std::find(std::begin(m_voiced), std::end(m_voiced), inVoiced);
-
-	if (it != std::end(m_voiced)) {
-		m_voiced.erase(it);
+	if (m_voiced.erase(inVoiced)) {
 
 		LogInfo("Removed [{}] as voiced to channel [{}]", inVoiced.c_str(), m_name.c_str());
 	}
@@ -781,7 +724,7 @@ void ChatChannel::RemoveVoice(const std::string &inVoiced)
 
 bool ChatChannel::HasVoice(std::string inVoiced)
 {
-	return std::find(std::begin(m_voiced), std::end(m_voiced), inVoiced) != std::end(m_voiced);
+	return m_voiced.count(inVoiced) > 0;
 }
 
 std::string CapitaliseName(const std::string& inString) {
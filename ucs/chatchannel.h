@@ -5,6 +5,8 @@
 #include "../common/linked_list.h"
 #include "../common/timer.h"
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 class Client;
@@ -64,11 +66,14 @@ private:
 
 	Timer m_delete_timer;
 
-	LinkedList<Client*> m_clients_in_channel;
+	// join order for listing and fan-out, the set answers membership checks
+	std::vector<Client*>        m_clients_in_channel;
+	std::unordered_set<Client*> m_client_set;
 
-	std::vector<std::string> m_moderators;
-	std::vector<std::string> m_invitees;
-	std::vector<std::string> m_voiced;
+	std::vector<std::string>        m_moderators; // kept in grant order for the op-list
+	std::unordered_set<std::string> m_moderator_set;
+	std::unordered_set<std::string> m_invitees;
+	std::unordered_set<std::string> m_voiced;
 
 };
 
@@ -94,8 +99,10 @@ public:
 	static inline void SetChannelBlockList(const std::vector<std::string>& new_list) { m_blocked_channel_names = new_list; }
 	static inline void SetFilteredNameList(const std::vector<std::string>& new_list) { m_filtered_names = new_list; }
 private:
+	void UnindexChannel(ChatChannel *Channel);
 
 	LinkedList<ChatChannel*> ChatChannels;
+	std::unordered_map<std::string, ChatChannel*> m_channels_by_name;
 	static inline std::vector<std::string> m_blocked_channel_names;
 	static inline std::vector<std::string> m_filtered_names;
 
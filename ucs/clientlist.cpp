@@ -591,6 +591,8 @@ void Clientlist::CheckForStaleConnections(Client *c) {
 			LogInfo("Client connection from [{}]:[{}] closed", inet_ntoa(in),
 				ntohs((*Iterator)->ClientStream->GetRemotePort()));
 
+			UnindexCharacter(*Iterator);
+
 			safe_delete((*Iterator));
 
 			Iterator = ClientChatConnections.erase(Iterator);
@@ -632,6 +634,8 @@ void Clientlist::Process()
 			LogInfo("Client connection from [{}]:[{}] closed", inet_ntoa(in),
 				ntohs((*it)->ClientStream->GetRemotePort()));
 
+			UnindexCharacter(*it);
+
 			safe_delete((*it));
 
 			it = ClientChatConnections.erase(it);
@@ -696,8 +700,12 @@ void Clientlist::Process()
 					break;
 				}
 
+				UnindexCharacter(*it);
+
 				(*it)->SetAccountID(database.FindAccount(CharacterName.c_str(), (*it)));
 
+				IndexCharacter(*it);
+
 				database.GetAccountStatus((*it));
 
 				if ((*it)->GetConnectionType() == ConnectionTypeCombined) {
@@ -741,6 +749,8 @@ void Clientlist::Process()
 
 			(*it)->ClientStream->Close();
 
+			UnindexCharacter(*it);
+
 			safe_delete((*it));
 
 			it = ClientChatConnections.erase(it);
@@ -985,16 +995,34 @@ void Client::SendMailBoxes() {
 
 Client *Clientlist::FindCharacter(const std::string& CharacterName) {
 
-	std::list<Client*>::iterator Iterator;
+	auto it = m_clients_by_name.find(CharacterName);
 
-	for (Iterator = ClientChatConnections.begin(); Iterator != ClientChatConnections.end(); ++Iterator) {
+	return it != m_clients_by_name.end() ? it->second.front() : nullptr;
+}
 
-		if ((*Iterator)->GetName() == CharacterName)
-			return ((*Iterator));
+void Clientlist::IndexCharacter(Client *c) {
 
-	}
+	const std::string name = c->GetName();
 
-	return nullptr;
+	if (name.empty())
+		return;
+
+	m_clients_by_name[name].push_back(c);
+}
+
+void Clientlist::UnindexCharacter(Client *c) {
+
+	auto it = m_clients_by_name.find(c->GetName());
+
+	if (it == m_clients_by_name.end())
+		return;
+
+	auto &clients = it->second;
+
+	clients.erase(std::remove(clients.begin(), clients.end(), c), clients.end());
+
+	if (clients.empty())
+		m_clients_by_name.erase(it);
 }
 
 void Client::AddToChannelList(ChatChannel *JoinedChannel) {
@@ -1525,14 +1553,19 @@ void Client::SendChannelMessage(const std::string& ChannelName, const std::strin
 
 	if (!Sender) return;
 
-	std::string FQSenderName = WorldShortName + "." + Sender->GetName();
+	auto outapp = MakeChannelMessagePacket(ChannelName, Message, WorldShortName + "." + Sender->GetName(), UnderfootOrLater);
+
+	QueuePacket(outapp.get());
+}
+
+std::unique_ptr<EQApplicationPacket> Client::MakeChannelMessagePacket(const std::string& ChannelName, const std::string& Message, const std::string& FQSenderName, bool UnderfootOrLater) {
 
 	int PacketLength = ChannelName.length() + Message.length() + FQSenderName.length() + 3;
 
 	if (UnderfootOrLater)
 		PacketLength += 8;
 
-	auto outapp = new EQApplicationPacket(OP_ChannelMessage, PacketLength);
+	auto outapp = std::make_unique<EQApplicationPacket>(OP_ChannelMessage, PacketLength);
 
 	char *PacketBuffer = (char *)outapp->pBuffer;
 
@@ -1543,9 +1576,7 @@ void Client::SendChannelMessage(const std::string& ChannelName, const std::strin
 	if (UnderfootOrLater)
 		VARSTRUCT_ENCODE_STRING(PacketBuffer, "SPAM:0:");
 
-	QueuePacket(outapp);
-
-	safe_delete(outapp);
+	return outapp;
 }
 
 void Client::ToggleAnnounce(const std::string& State)
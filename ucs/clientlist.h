@@ -25,6 +25,8 @@
 #include "../common/rulesys.h"
 #include "chatchannel.h"
 #include <list>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 #define MAX_JOINED_CHANNELS 10
@@ -99,6 +101,7 @@ public:
 	void RemoveFromChannelList(ChatChannel *JoinedChannel);
 	void SendChannelMessage(std::string Message);
 	void SendChannelMessage(const std::string& ChannelName, const std::string& Message, Client *Sender);
+	static std::unique_ptr<EQApplicationPacket> MakeChannelMessagePacket(const std::string& ChannelName, const std::string& Message, const std::string& FQSenderName, bool UnderfootOrLater);
 	void SendChannelMessageByNumber(std::string Message);
 	void SendChannelList();
 	void CloseConnection();
@@ -144,6 +147,7 @@ public:
 	void SetConnectionType(char c);
 	ConnectionType GetConnectionType() { return TypeOfConnection; }
 	EQ::versions::ClientVersion GetClientVersion() { return ClientVersion_; }
+	inline bool IsUnderfootOrLater() { return UnderfootOrLater; }
 
 	inline bool IsMailConnection() { return (TypeOfConnection == ConnectionTypeMail) || (TypeOfConnection == ConnectionTypeCombined); }
 	void SendNotification(int MailBoxNumber, const std::string& Subject, const std::string& From, int MessageID);
@@ -191,10 +195,16 @@ public:
 	void ProcessOPMailCommand(Client* c, std::string command_string, bool command_directed = false);
 
 private:
+	void IndexCharacter(Client *c);
+	void UnindexCharacter(Client *c);
+
 	EQ::Net::EQStreamManager *chatsf;
 
 	std::list<Client*> ClientChatConnections;
 
+	// logged in connections by character name, a character can hold more than one (mail and chat) in login order
+	std::unordered_map<std::string, std::vector<Client*>> m_clients_by_name;
+
 	OpcodeManager *ChatOpMgr;
 };
 
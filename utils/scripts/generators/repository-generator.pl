@@ -118,6 +118,13 @@ my @cereal_enabled_tables = (
     "player_event_log_settings"
 );
 
+# Tables that also get binary protocol (prepared statement) FindOne and GetWhere
+my @prepared_enabled_tables = (
+    "inventory",
+    "items",
+    "npc_types"
+);
+
 my $generated_base_repository_files = "";
 my $generated_repository_files      = "";
 
@@ -167,6 +174,11 @@ foreach my $table_to_generate (@tables) {
         $cereal_enabled = 1;
     }
 
+    my $prepared_enabled = 0;
+    if ($table_to_generate ~~ @prepared_enabled_tables) {
+        $prepared_enabled = 1;
+    }
+
     if ($table_found_in_schema == 0 && ($requested_table_to_generate eq "" || $requested_table_to_generate eq "all")) {
         print "Table [$table_to_generate] not found in schema, skipping\n";
         next;
@@ -224,6 +236,7 @@ foreach my $table_to_generate (@tables) {
     my $cereal_columns             = "";
     my $update_one_entries         = "";
     my $all_entries                = "";
+    my $prepared_row_entries       = "";
     my $index                      = 0;
     my %table_data                 = ();
     my %table_primary_key          = ();
@@ -366,6 +379,20 @@ foreach my $table_to_generate (@tables) {
             $find_one_entries .= sprintf("\t\t\te.%-${longest_column_length}s = row[%s] ? row[%s] : %s;\n", $column_name_formatted, $index, $index, $default_value);
         }
 
+        # prepared (binary protocol) select, values arrive typed so only NULLs fall back to the default
+        my $prepared_value = sprintf("row.Get<%s>(%s).value_or(%s)", $struct_data_type, $index, $default_value);
+        if ($data_type =~ /datetime|timestamp/) {
+            $prepared_value = sprintf("row.Get<int64_t>(%s).value_or(-1)", $index);
+        }
+        elsif ($struct_data_type eq "std::string") {
+            $prepared_value = sprintf("row.GetStr(%s).value_or(%s)", $index, ($default_value eq "0" ? '""' : $default_value));
+        }
+        elsif ($column_type =~ /unsigned/ && $data_type =~ /float|decimal/) {
+            $prepared_value = sprintf("row.Get<float>(%s).value_or(%s) > 0.0f ? row.Get<float>(%s).value_or(%s) : %s", $index, $default_value, $index, $default_value, $default_value);
+        }
+
+        $prepared_row_entries .= sprintf("\t\te.%-${longest_column_length}s = %s;\n", $column_name_formatted, $prepared_value);
+
         # print $column_name . "\n";
 
         # print "table_name [$table_name] column_name [$column_name] data_type [$data_type] column_type [$column_type]\n";
@@ -430,6 +457,10 @@ foreach my $table_to_generate (@tables) {
     }
 
     my $additional_includes = "";
+    if ($prepared_enabled) {
+        $additional_includes .= "#include \"../../mysql_stmt.h\"\n";
+    }
+
     if ($cereal_enabled) {
         chomp($cereal_columns);
         # remove the last comma "," from string
@@ -453,6 +484,7 @@ foreach my $table_to_generate (@tables) {
     chomp($insert_one_entries);
     chomp($insert_many_entries);
     chomp($all_entries);
+    chomp($prepared_row_entries);
 
     use POSIX qw(strftime);
     my $generated_date = strftime "%b%e, %Y", localtime;
@@ -482,6 +514,15 @@ foreach my $table_to_generate (@tables) {
     $new_base_repository =~ s/\{\{GENERATED_DATE}}/$generated_date/g;
     $new_base_repository =~ s/\{\{ADDITIONAL_INCLUDES}}\n/$additional_includes/g;
 
+    if ($prepared_enabled) {
+        $new_base_repository =~ s/\{\{PREPARED_BEGIN}}\n//g;
+        $new_base_repository =~ s/\{\{PREPARED_END}}\n//g;
+        $new_base_repository =~ s/\{\{PREPARED_ROW_ENTRIES}}/$prepared_row_entries/g;
+    }
+    else {
+        $new_base_repository =~ s/\{\{PREPARED_BEGIN}}.*?\{\{PREPARED_END}}\n//gs;
+    }
+
     # Extended repository
     my $new_repository = $repository_template;
     $new_repository =~ s/\{\{TABLE_NAME_CLASS}}/$table_name_camel_case/g;
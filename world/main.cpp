@@ -338,6 +338,8 @@ int main(int argc, char **argv)
 	opts.reliable_stream_options.resend_delay_min    = RuleI(Network, ResendDelayMinMS);
 	opts.reliable_stream_options.resend_delay_max    = RuleI(Network, ResendDelayMaxMS);
 	opts.reliable_stream_options.outgoing_data_rate  = RuleR(Network, ClientDataRate);
+	opts.reliable_stream_options.recv_mmsg           = RuleB(Network, BatchedReceive);
+	opts.network_thread                              = RuleB(Network, DedicatedThread);
 
 	EQ::Net::EQStreamManager eqsm(opts);
 
@@ -866,6 +866,8 @@ void Client::RefundAA() {
 		rank_value        = aa_ranks.erase(rank_value);
 	}
 
+	SetBonusesDirty(BonusLayer::AAs);
+
 	if (refunded > 0) {
 		m_pp.aapoints += refunded;
 		SaveAA();
@@ -1405,6 +1407,7 @@ void Mob::ExpendAlternateAdvancementCharge(uint32 aa_id) {
 					}
 
 					aa_ranks.erase(iter.first);
+					SetBonusesDirty(BonusLayer::AAs);
 				}
 
 				if (IsClient()) {
@@ -1555,6 +1558,7 @@ bool Mob::SetAA(uint32 rank_id, uint32 new_value, uint32 charges)
 		}
 
 		aa_ranks[a->id] = std::make_pair(new_value, charges);
+		SetBonusesDirty(BonusLayer::AAs);
 	}
 
 	return true;
@@ -2051,6 +2055,7 @@ void Client::ResetAlternateAdvancementRank(uint32 aa_id) {
 		if(ability && aa_id == ability->id) {
 			RemoveExpendedAA(ability->first_rank_id);
 			aa_ranks.erase(iter.first);
+			SetBonusesDirty(BonusLayer::AAs);
 			SaveAA();
 			SendAlternateAdvancementPoints();
 			return;
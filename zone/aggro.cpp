@@ -1267,6 +1267,54 @@ bool Mob::CheckLosFN(Mob *other)
 	return Result;
 }
 
+// CheckLosFN against several mobs in one map query, null entries are skipped and come back false
+// last_los_check is left alone, it is the state against a single target and a batch has no one target to keep
+void Mob::CheckLosFN(const std::vector<Mob *> &others, std::vector<bool> &results)
+{
+	results.assign(others.size(), false);
+
+	if (!zone->zonemap) {
+#ifdef LOS_DEFAULT_CAN_SEE
+		results.assign(others.size(), true);
+#endif
+		return;
+	}
+
+#define LOS_DEFAULT_HEIGHT 6.0f
+
+	const glm::vec3 myloc(
+		GetX(),
+		GetY(),
+		GetZ() + (GetSize() == 0.0 ? LOS_DEFAULT_HEIGHT : GetSize()) / 2 * HEAD_POSITION
+	);
+
+	std::vector<glm::vec3> olocs;
+	std::vector<size_t>    indexes;
+	olocs.reserve(others.size());
+	indexes.reserve(others.size());
+
+	for (size_t i = 0; i < others.size(); ++i) {
+		Mob *other = others[i];
+		if (!other) {
+			continue;
+		}
+
+		olocs.emplace_back(
+			other->GetX(),
+			other->GetY(),
+			other->GetZ() + (other->GetSize() == 0.0 ? LOS_DEFAULT_HEIGHT : other->GetSize()) / 2 * SEE_POSITION
+		);
+		indexes.push_back(i);
+	}
+
+	std::vector<bool> visible;
+	zone->zonemap->CheckLoSBatch(myloc, olocs, visible);
+
+	for (size_t i = 0; i < visible.size(); ++i) {
+		results[indexes[i]] = visible[i];
+	}
+}
+
 bool Mob::CheckLosFN(float posX, float posY, float posZ, float mobSize) {
 	if(zone->zonemap == nullptr) {
 		//not sure what the best return is on error
@@ -1616,6 +1664,7 @@ void Mob::AddFeignMemory(Mob* attacker) {
 
 	if (attacker) {
 		feign_memory_list.insert(attacker->GetID());
+		attacker->AddAggroHolder(this, AggroHolder::FeignMemory);
 	}
 }
 
@@ -1626,6 +1675,7 @@ void Mob::RemoveFromFeignMemory(Mob* attacker) {
 	}
 
 	feign_memory_list.erase(attacker->GetID());
+	attacker->RemoveAggroHolder(this, AggroHolder::FeignMemory);
 	if (feign_memory_list.empty() && AI_feign_remember_timer != nullptr) {
 		AI_feign_remember_timer->Disable();
 	}
@@ -1644,6 +1694,9 @@ void Mob::ClearFeignMemory() {
 	while (remembered_feigned_mobid != feign_memory_list.end())
 	{
 		Mob* remembered_mob = entity_list.GetMob(*remembered_feigned_mobid);
+		if (remembered_mob) {
+			remembered_mob->RemoveAggroHolder(this, AggroHolder::FeignMemory);
+		}
 		if (remembered_mob && remembered_mob->IsClient()) { //Still in zone
 			remembered_mob->CastToClient()->RemoveXTarget(this, false);
 		}
@@ -1667,6 +1720,55 @@ bool Mob::IsOnFeignMemory(Mob *attacker) const
 	return feign_memory_list.find(attacker->GetID()) != feign_memory_list.end();
 }
 
+void Mob::AddAggroHolder(Mob *holder, uint8 type)
+{
+	if (!holder) {
+		return;
+	}
+
+	m_aggro_holders[holder->GetID()] |= type;
+}
+
+void Mob::RemoveAggroHolder(Mob *holder, uint8 type)
+{
+	if (!holder) {
+		return;
+	}
+
+	auto it = m_aggro_holders.find(holder->GetID());
+	if (it == m_aggro_holders.end()) {
+		return;
+	}
+
+	it->second &= ~type;
+	if (!it->second) {
+		m_aggro_holders.erase(it);
+	}
+}
+
+// mobs that may hold us on the given lists, holders that have left the zone are dropped along the way
+std::vector<Mob *> Mob::GetAggroHolders(uint8 type)
+{
+	std::vector<Mob *> holders;
+	holders.reserve(m_aggro_holders.size());
+
+	for (auto it = m_aggro_holders.begin(); it != m_aggro_holders.end();) {
+		Mob *m = entity_list.GetMob(it->first);
+		if (!m) {
+			it = m_aggro_holders.erase(it);
+			continue;
+		}
+
+		if (it->second & type) {
+			holders.push_back(m);
+		}
+
+		++it;
+	}
+
+	return holders;
+}
+
 bool Mob::PassCharismaCheck(Mob* caster, uint16 spell_id) {
 
 	/*
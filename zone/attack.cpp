@@ -4216,51 +4216,35 @@ void Mob::CommonDamage(Mob* attacker, int64 &damage, const uint16 spell_id, cons
 		int old_hp_ratio = (int)GetHPRatio();
 
 
+		QuestDamageEvent damage_event{
+			.entity_id        = 0,
+			.damage           = damage,
+			.spell_id         = spell_id,
+			.skill_id         = static_cast<int>(skill_used),
+			.is_damage_shield = FromDamageShield,
+			.is_avoidable     = avoidable,
+			.buff_slot        = buffslot,
+			.is_buff_tic      = iBuffTic,
+			.special_attack   = static_cast<int>(special)
+		};
+
 		std::vector<std::any> args;
 
 		int64 damage_override = 0;
 
 		if (attacker) {
-			args = { this };
-
-			parse->EventMob(EVENT_DAMAGE_GIVEN, attacker, this,
-				[&]() {
-					return fmt::format(
-						"{} {} {} {} {} {} {} {} {}",
-						GetID(),
-						damage,
-						spell_id,
-						static_cast<int>(skill_used),
-						FromDamageShield ? 1 : 0,
-						avoidable ? 1 : 0,
-						buffslot,
-						iBuffTic ? 1 : 0,
-						static_cast<int>(special)
-					);
-				},
-				0, &args
-			);
+			damage_event.entity_id = GetID();
+
+			args = { this, &damage_event };
+
+			parse->EventMob(EVENT_DAMAGE_GIVEN, attacker, this, []() { return ""; }, 0, &args);
 		}
 
-		args = { attacker };
+		damage_event.entity_id = attacker ? attacker->GetID() : 0;
 
-		damage_override = parse->EventMob(EVENT_DAMAGE_TAKEN, this, attacker,
-			[&]() {
-				return fmt::format(
-					"{} {} {} {} {} {} {} {} {}",
-					attacker ? attacker->GetID() : 0,
-					damage,
-					spell_id,
-					static_cast<int>(skill_used),
-					FromDamageShield ? 1 : 0,
-					avoidable ? 1 : 0,
-					buffslot,
-					iBuffTic ? 1 : 0,
-					static_cast<int>(special)
-				);
-			},
-			0, &args
-		);
+		args = { attacker, &damage_event };
+
+		damage_override = parse->EventMob(EVENT_DAMAGE_TAKEN, this, attacker, []() { return ""; }, 0, &args);
 
 		if (damage_override > 0) {
 			damage = damage_override;
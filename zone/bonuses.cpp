@@ -69,12 +69,51 @@ void NPC::CalcBonuses()
 
 void Client::CalcBonuses()
 {
-	memset(&itembonuses, 0, sizeof(StatBonuses));
-	CalcItemBonuses(&itembonuses);
-	CalcHeroicBonuses(&itembonuses);
-	CalcEdibleBonuses(&itembonuses);
-	CalcSpellBonuses(&spellbonuses);
-	CalcAABonuses(&aabonuses);
+	// item ATK is capped using the spell and AA caps as they stand going in
+	const int32 item_atk_cap = spellbonuses.ItemATKCap + aabonuses.ItemATKCap;
+
+	if (
+		m_bonus_generation != s_bonus_generation ||
+		m_item_bonus_revision != m_inv.GetRevision() ||
+		m_item_bonus_atk_cap != item_atk_cap
+	) {
+		m_dirty_bonus_layers |= (m_bonus_generation != s_bonus_generation ? BonusLayer::All : BonusLayer::Items);
+	}
+
+	// negation rewrites the item and AA layers from inside the spell pass, so replay the whole pass
+	if (m_spell_bonus_cache.NegateEffects) {
+		m_dirty_bonus_layers |= BonusLayer::Spells;
+	}
+
+	if (m_dirty_bonus_layers & BonusLayer::Items) {
+		memset(&itembonuses, 0, sizeof(StatBonuses));
+		CalcItemBonuses(&itembonuses);
+		CalcHeroicBonuses(&itembonuses);
+		CalcEdibleBonuses(&itembonuses);
+
+		memcpy(&m_item_bonus_cache, &itembonuses, sizeof(StatBonuses));
+		m_item_bonus_revision = m_inv.GetRevision();
+		m_item_bonus_atk_cap  = item_atk_cap;
+	} else {
+		memcpy(&itembonuses, &m_item_bonus_cache, sizeof(StatBonuses));
+	}
+
+	if (m_dirty_bonus_layers & BonusLayer::Spells) {
+		CalcSpellBonuses(&spellbonuses);
+		memcpy(&m_spell_bonus_cache, &spellbonuses, sizeof(StatBonuses));
+	} else {
+		memcpy(&spellbonuses, &m_spell_bonus_cache, sizeof(StatBonuses));
+	}
+
+	if (m_dirty_bonus_layers & BonusLayer::AAs) {
+		CalcAABonuses(&aabonuses);
+		memcpy(&m_aa_bonus_cache, &aabonuses, sizeof(StatBonuses));
+	} else {
+		memcpy(&aabonuses, &m_aa_bonus_cache, sizeof(StatBonuses));
+	}
+
+	m_dirty_bonus_layers = 0;
+	m_bonus_generation   = s_bonus_generation;
 
 	CalcSeeInvisibleLevel();
 	CalcInvisibleLevel();
@@ -1833,9 +1872,14 @@ void Mob::CalcSpellBonuses(StatBonuses* newbon)
 	newbon->AggroRange = -1;
 	newbon->AssistRange = -1;
 
+	// buffs[] may have been rewritten wholesale by a loader, resync the effect bits while we walk it anyway
+	m_active_buff_effects.reset();
+	m_active_buff_effects_generation = GetSpellEffectIndexGeneration();
+
 	int buff_count = GetMaxTotalSlots();
 	for (i = 0; i < buff_count; i++) {
 		if (IsValidSpell(buffs[i].spellid)) {
+			m_active_buff_effects |= GetSpellEffectBits(buffs[i].spellid);
 			ApplySpellsBonuses(buffs[i].spellid, buffs[i].casterlevel, newbon, buffs[i].casterid, 0, buffs[i].ticsremaining, i, buffs[i].instrument_mod);
 
 			if (buffs[i].hit_number > 0) {
@@ -3932,6 +3976,7 @@ void Client::CalcItemScale() {
 
 	if(changed)
 	{
+		SetBonusesDirty(BonusLayer::Items); // items were rescaled in place, the inventory revision did not move
 		CalcBonuses();
 	}
 }
@@ -4025,6 +4070,7 @@ void Client::DoItemEnterZone() {
 
 	if(changed)
 	{
+		SetBonusesDirty(BonusLayer::Items); // items were rescaled in place, the inventory revision did not move
 		CalcBonuses();
 	}
 }
@@ -660,6 +660,8 @@ bool BotDatabase::LoadBuffs(Bot* b)
 		++buff_count;
 	}
 
+	b->RefreshActiveBuffEffects();
+
 	return true;
 }
 
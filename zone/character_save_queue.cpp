@@ -0,0 +1,234 @@
+#include <algorithm>
+#include "character_save_queue.h"
+#include "../common/eqemu_config.h"
+#include "../common/eqemu_logsys.h"
+#include "../common/rulesys.h"
+
+CharacterSaveQueue::~CharacterSaveQueue()
+{
+	Stop();
+}
+
+bool CharacterSaveQueue::Start()
+{
+	if (m_running) {
+		return true;
+	}
+
+	auto c = EQEmuConfig::get();
+	if (!m_database.Connect(
+		c->DatabaseHost.c_str(),
+		c->DatabaseUsername.c_str(),
+		c->DatabasePassword.c_str(),
+		c->DatabaseDB.c_str(),
+		c->DatabasePort,
+		"save-worker"
+	)) {
+		LogError("Character save worker failed to connect to the database, saves will be written synchronously");
+		return false;
+	}
+
+	m_running = true;
+	m_thread  = std::thread(&CharacterSaveQueue::ProcessWork, this);
+
+	LogInfo("Character save worker started");
+
+	return true;
+}
+
+void CharacterSaveQueue::Stop()
+{
+	{
+		std::unique_lock<std::mutex> lock(m_lock);
+		if (!m_running) {
+			return;
+		}
+
+		m_running = false;
+	}
+
+	// the worker drains whatever is still queued before it exits
+	m_work_cv.notify_all();
+
+	if (m_thread.joinable()) {
+		m_thread.join();
+	}
+
+	LogInfo("Character save worker stopped, [{}] saves written", m_written);
+}
+
+void CharacterSaveQueue::Enqueue(std::unique_ptr<CharacterSaveState> state)
+{
+	if (!state) {
+		return;
+	}
+
+	state->queued_at = std::chrono::steady_clock::now();
+
+	{
+		std::unique_lock<std::mutex> lock(m_lock);
+
+		const uint32 character_id = state->character_id;
+
+		m_queued++;
+
+		auto it = m_pending.find(character_id);
+		if (it != m_pending.end()) {
+			// keep the original queue time so latency reflects how long the character has been waiting on disk
+			state->queued_at = it->second->queued_at;
+			it->second       = std::move(state);
+			m_coalesced++;
+		}
+		else {
+			m_pending.emplace(character_id, std::move(state));
+			m_order.push_back(character_id);
+		}
+	}
+
+	m_work_cv.notify_one();
+}
+
+std::chrono::milliseconds CharacterSaveQueue::FlushTimeout(uint32 timeout_ms)
+{
+	// never wait unbounded on the zone thread, the worker may be stuck on a dead connection
+	if (timeout_ms == 0) {
+		timeout_ms = std::max(RuleI(Character, AsyncSaveFlushTimeoutMS), 1);
+	}
+
+	return std::chrono::milliseconds(timeout_ms);
+}
+
+bool CharacterSaveQueue::Flush(uint32 character_id, uint32 timeout_ms)
+{
+	const auto timeout = FlushTimeout(timeout_ms);
+
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	const bool flushed = m_done_cv.wait_for(
+		lock,
+		timeout,
+		[&] {
+			return m_in_flight != character_id && m_pending.find(character_id) == m_pending.end();
+		}
+	);
+
+	if (flushed) {
+		return true;
+	}
+
+	// the caller is about to write newer state itself, the queued snapshot must not land on top of it later
+	if (m_pending.erase(character_id)) {
+		m_order.erase(std::remove(m_order.begin(), m_order.end(), character_id), m_order.end());
+		m_dropped++;
+	}
+
+	const bool in_flight = m_in_flight == character_id;
+
+	LogError(
+		"Timed out after [{}] ms waiting on the save worker for character [{}], queue depth [{}], {}",
+		timeout.count(),
+		character_id,
+		m_pending.size(),
+		in_flight ? "its write is still in flight" : "dropped its queued snapshot"
+	);
+
+	return !in_flight;
+}
+
+CharacterSaveQueueStats CharacterSaveQueue::GetStats()
+{
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	CharacterSaveQueueStats s{};
+	s.queue_depth        = m_pending.size();
+	s.queued             = m_queued;
+	s.coalesced          = m_coalesced;
+	s.written            = m_written;
+	s.failed             = m_failed;
+	s.dropped            = m_dropped;
+	s.last_latency_ms    = m_last_latency_ms;
+	s.max_latency_ms     = m_max_latency_ms;
+	s.average_latency_ms = m_written ? m_total_latency_ms / m_written : 0.0;
+	s.average_write_ms   = m_written ? m_total_write_ms / m_written : 0.0;
+
+	return s;
+}
+
+void CharacterSaveQueue::ProcessWork()
+{
+	for (;;) {
+		std::unique_ptr<CharacterSaveState> state;
+
+		{
+			std::unique_lock<std::mutex> lock(m_lock);
+			m_work_cv.wait(lock, [this] { return !m_running || !m_order.empty(); });
+
+			if (m_order.empty()) {
+				// only reachable once stopped and fully drained
+				return;
+			}
+
+			const uint32 character_id = m_order.front();
+			m_order.pop_front();
+
+			auto it = m_pending.find(character_id);
+			state = std::move(it->second);
+			m_pending.erase(it);
+
+			m_in_flight = character_id;
+		}
+
+		const auto write_start = std::chrono::steady_clock::now();
+		const bool success     = Write(*state);
+		const auto write_end   = std::chrono::steady_clock::now();
+
+		{
+			std::unique_lock<std::mutex> lock(m_lock);
+
+			const double write_ms   = std::chrono::duration<double, std::milli>(write_end - write_start).count();
+			const double latency_ms = std::chrono::duration<double, std::milli>(write_end - state->queued_at).count();
+
+			if (success) {
+				m_written++;
+			}
+			else {
+				m_failed++;
+			}
+
+			m_last_latency_ms = latency_ms;
+			m_max_latency_ms  = std::max(m_max_latency_ms, latency_ms);
+			m_total_latency_ms += latency_ms;
+			m_total_write_ms += write_ms;
+
+			m_in_flight = 0;
+		}
+
+		m_done_cv.notify_all();
+	}
+}
+
+bool CharacterSaveQueue::Write(CharacterSaveState &s)
+{
+	m_database.SaveCharacterCurrency(s.character_id, &s.pp);
+	m_database.SaveCharacterBinds(s.character_id, s.pp);
+	m_database.SaveBuffs(s.character_id, s.buffs.data(), static_cast<int>(s.buffs.size()));
+	m_database.SavePetInfo(s.character_id, &s.pet, &s.suspended_pet);
+	m_database.SaveCharacterTribute(s.character_id, s.pp);
+
+	const bool success = m_database.SaveCharacterData(
+		s.character_id,
+		s.account_id,
+		s.name,
+		s.pp,
+		s.epp,
+		s.exp_enabled,
+		s.mail_key,
+		s.illusion_block
+	);
+
+	if (!success) {
+		LogError("Write-behind save failed for character [{}] ([{}])", s.name, s.character_id);
+	}
+
+	return success;
+}
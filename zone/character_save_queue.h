@@ -0,0 +1,111 @@
+#ifndef EQEMU_CHARACTER_SAVE_QUEUE_H
+#define EQEMU_CHARACTER_SAVE_QUEUE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "../common/eq_packet_structs.h"
+#include "common.h"
+#include "zonedb.h"
+
+// point-in-time copy of everything Client::Save hands off to the save worker
+struct CharacterSaveState {
+	uint32                    character_id   = 0;
+	uint32                    account_id     = 0;
+	std::string               name;
+	PlayerProfile_Struct      pp{};
+	ExtendedProfile_Struct    epp{};
+	bool                      exp_enabled    = false;
+	std::string               mail_key;
+	bool                      illusion_block = false;
+	std::vector<Buffs_Struct> buffs;
+	PetInfo                   pet{};
+	PetInfo                   suspended_pet{};
+
+	std::chrono::steady_clock::time_point queued_at;
+};
+
+struct CharacterSaveQueueStats {
+	size_t queue_depth;
+	uint64 queued;
+	uint64 coalesced;
+	uint64 written;
+	uint64 failed;
+	uint64 dropped;
+	double last_latency_ms;
+	double max_latency_ms;
+	double average_latency_ms;
+	double average_write_ms;
+};
+
+/**
+ * Write-behind persistence for Client::Save
+ *
+ * The zone thread snapshots character state into a CharacterSaveState and hands it off here, a dedicated worker
+ * with its own database connection then performs the writes. Only the newest snapshot per character is kept while
+ * it waits, so a burst of saves for the same character collapses into a single write
+ *
+ * Anything that is about to read or overwrite the same rows synchronously (zoning, camping, direct saves) must call
+ * Flush for that character first, and leave the rows alone when it fails
+ */
+class CharacterSaveQueue {
+public:
+	static CharacterSaveQueue *Instance()
+	{
+		static CharacterSaveQueue instance;
+		return &instance;
+	}
+
+	~CharacterSaveQueue();
+
+	bool Start();
+	void Stop();
+	inline bool IsRunning() const { return m_running; }
+
+	void Enqueue(std::unique_ptr<CharacterSaveState> state);
+
+	// blocks until no write for the character is pending or in flight, or the timeout passes
+	// a timeout of 0 uses Character:AsyncSaveFlushTimeoutMS. On timeout a queued snapshot is dropped, and false
+	// means a write for the character is still in flight so the caller must not write the same rows itself
+	bool Flush(uint32 character_id, uint32 timeout_ms = 0);
+
+	CharacterSaveQueueStats GetStats();
+
+private:
+	static std::chrono::milliseconds FlushTimeout(uint32 timeout_ms);
+
+	void ProcessWork();
+	bool Write(CharacterSaveState &state);
+
+	ZoneDatabase m_database;
+	std::thread  m_thread;
+	bool         m_running = false;
+
+	std::mutex              m_lock;
+	std::condition_variable m_work_cv;
+	std::condition_variable m_done_cv;
+
+	std::deque<uint32>                                               m_order;
+	std::unordered_map<uint32, std::unique_ptr<CharacterSaveState>> m_pending;
+	uint32                                                           m_in_flight = 0;
+
+	// counters, guarded by m_lock
+	uint64 m_queued           = 0;
+	uint64 m_coalesced        = 0;
+	uint64 m_written          = 0;
+	uint64 m_failed           = 0;
+	uint64 m_dropped          = 0; // snapshots given up on by a timed out Flush
+	double m_last_latency_ms  = 0.0;
+	double m_max_latency_ms   = 0.0;
+	double m_total_latency_ms = 0.0;
+	double m_total_write_ms   = 0.0;
+};
+
+#endif //EQEMU_CHARACTER_SAVE_QUEUE_H
@@ -0,0 +1,172 @@
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <random>
+#include "../../common/eqemu_logsys.h"
+#include "../../common/platform.h"
+#include "../../common/rulesys.h"
+#include "../zone.h"
+#include "../npc.h"
+#include "../zonedb.h"
+
+extern Zone *zone;
+
+// replica of the pre-grid EntityList::ScanCloseMobs, walks every mob in the zone and fills the same close lists
+void LinearScanCloseMobs(Mob *scanning_mob)
+{
+	float scan_range = RuleI(Range, MobCloseScanDistance);
+
+	if (scanning_mob->m_close_mobs.bucket_count() < entity_list.GetMobList().size()) {
+		scanning_mob->m_close_mobs.reserve(entity_list.GetMobList().size());
+	}
+
+	scanning_mob->m_close_mobs.clear();
+
+	for (auto &e : entity_list.GetMobList()) {
+		auto mob = e.second;
+
+		if (mob && (mob->GetID() <= 0 || mob->IsZoneController())) {
+			continue;
+		}
+
+		float distance = Distance(scanning_mob->GetPosition(), mob->GetPosition());
+		if (distance <= scan_range || mob->GetAggroRange() >= scan_range) {
+			if (mob->m_close_mobs.find(scanning_mob->GetID()) == mob->m_close_mobs.end()) {
+				mob->m_close_mobs[scanning_mob->GetID()] = scanning_mob;
+			}
+			scanning_mob->m_close_mobs[mob->GetID()] = mob;
+		}
+	}
+}
+
+void ZoneCLI::BenchmarkCloseMobs(int argc, char **argv, argh::parser &cmd, std::string &description)
+{
+	description = "Benchmark EntityList::ScanCloseMobs (spatial grid) against a linear mob_list scan on a synthetic zone.";
+
+	if (cmd[{"-h", "--help"}]) {
+		std::cout << "Usage: benchmark:close-mobs [--mobs=4000] [--npc-type-id=754008]\n";
+		return;
+	}
+
+	uint32 mob_count   = 4000;
+	uint32 npc_type_id = 754008;
+	if (!cmd("--mobs").str().empty()) {
+		mob_count = Strings::ToUnsignedInt(cmd("--mobs").str());
+	}
+	if (!cmd("--npc-type-id").str().empty()) {
+		npc_type_id = Strings::ToUnsignedInt(cmd("--npc-type-id").str());
+	}
+
+	if (mob_count == 0) {
+		return;
+	}
+
+	EQEmuLogSys::Instance()->SilenceConsoleLogging();
+
+	// boot shell zone for benchmarking
+	Zone::Bootup(ZoneID("qrg"), 0, false);
+	zone->StopShutdownTimer();
+	entity_list.Process();
+	entity_list.MobProcess();
+
+	EQEmuLogSys::Instance()->EnableConsoleLogging();
+
+	auto npc_type = content_db.LoadNPCTypesData(npc_type_id);
+	if (!npc_type) {
+		std::cerr << "NPC type [" << npc_type_id << "] not found\n";
+		return;
+	}
+
+	// spread mobs at roughly one per 60x60 units, a busy but realistic density
+	const float                           half_extent = std::sqrt(static_cast<float>(mob_count)) * 30.0f;
+	std::mt19937                          rng(1337);
+	std::uniform_real_distribution<float> coord(-half_extent, half_extent);
+
+	std::cout << Strings::Repeat("-", 70) << "\n";
+	std::cout << "📌 Spawning " << Strings::Commify(mob_count) << " NPCs over a "
+			  << static_cast<int>(half_extent * 2) << " x " << static_cast<int>(half_extent * 2) << " area...\n";
+
+	std::vector<NPC *> npcs;
+	npcs.reserve(mob_count);
+	for (uint32 i = 0; i < mob_count; ++i) {
+		auto npc = new NPC(
+			npc_type,
+			nullptr,
+			glm::vec4(coord(rng), coord(rng), 0, 0),
+			GravityBehavior::Water
+		);
+
+		entity_list.AddNPC(npc, false);
+		npcs.emplace_back(npc);
+	}
+
+	// populate grid cells for the freshly added mobs
+	entity_list.MobProcess();
+
+	std::cout << "✅ Grid holds " << Strings::Commify(entity_list.GetMobGrid().Size()) << " mobs in "
+			  << Strings::Commify(entity_list.GetMobGrid().CellCount()) << " cells (cell size "
+			  << entity_list.GetMobGrid().GetCellSize() << ")\n";
+	std::cout << Strings::Repeat("-", 70) << "\n";
+
+	// both variants start from empty close lists and get one untimed warm-up pass over the same mobs
+	auto run_pass = [&](const std::function<void(NPC *)> &scan, uint64 &found) {
+		for (auto &npc: npcs) {
+			npc->m_close_mobs.clear();
+		}
+
+		found      = 0;
+		auto start = std::chrono::high_resolution_clock::now();
+		for (auto &npc: npcs) {
+			scan(npc);
+		}
+		std::chrono::duration<double> time = std::chrono::high_resolution_clock::now() - start;
+
+		for (auto &npc: npcs) {
+			found += npc->m_close_mobs.size();
+		}
+
+		return time.count();
+	};
+
+	auto linear_scan = [](NPC *npc) { LinearScanCloseMobs(npc); };
+	auto grid_scan   = [](NPC *npc) { entity_list.ScanCloseMobs(npc); };
+
+	uint64 linear_found = 0;
+	uint64 grid_found   = 0;
+
+	run_pass(linear_scan, linear_found);
+	const double linear_time = run_pass(linear_scan, linear_found);
+
+	// kept for the comparison below, the buckets the linear scan reserved are released so the grid starts fresh
+	std::unordered_map<uint16, std::unordered_map<uint16, Mob *>> linear_lists;
+	for (auto &npc: npcs) {
+		linear_lists[npc->GetID()] = npc->m_close_mobs;
+		std::unordered_map<uint16, Mob *>().swap(npc->m_close_mobs);
+	}
+
+	run_pass(grid_scan, grid_found);
+	const double grid_time = run_pass(grid_scan, grid_found);
+
+	std::cout << "📊 Linear scan  | " << Strings::Commify(mob_count) << " scans in " << linear_time
+			  << " seconds (" << (linear_time * 1000000 / mob_count) << " us/scan) avg close ["
+			  << (linear_found / mob_count) << "]\n";
+	std::cout << "📊 Grid scan    | " << Strings::Commify(mob_count) << " scans in " << grid_time
+			  << " seconds (" << (grid_time * 1000000 / mob_count) << " us/scan) avg close ["
+			  << (grid_found / mob_count) << "]\n";
+
+	if (grid_time > 0) {
+		std::cout << "🚀 Speedup " << (linear_time / grid_time) << "x\n";
+	}
+
+	// the grid has to find at least everything the linear scan did
+	for (auto &npc: npcs) {
+		for (auto &e: linear_lists[npc->GetID()]) {
+			if (npc->m_close_mobs.find(e.first) == npc->m_close_mobs.end()) {
+				std::cerr << "[❌] Grid scan for [" << npc->GetID() << "] is missing mob [" << e.first << "]\n";
+				std::exit(1);
+			}
+		}
+	}
+
+	std::cout << "[✅] Grid close lists match linear scan\n";
+}
@@ -0,0 +1,204 @@
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include "../../common/strings.h"
+#include "../../common/net/reliable_stream_compression.h"
+
+struct CompressionBenchmarkPayload {
+	int                  compression_class;
+	std::vector<uint8_t> data;
+};
+
+// records written by the zone when Network:CompressionCaptureFile is set, see CaptureCompressionPayload
+std::vector<CompressionBenchmarkPayload> LoadCompressionBenchmarkCapture(const std::string &path)
+{
+	std::vector<CompressionBenchmarkPayload> payloads;
+
+	std::ifstream in(path, std::ios::binary);
+	uint8_t       header[5];
+	while (in.read(reinterpret_cast<char *>(header), sizeof(header))) {
+		const uint32 length = header[0] | (header[1] << 8) | (header[2] << 16) | (header[3] << 24);
+		if (length > 4096 || header[4] >= EQ::Net::CompressionClassCount) {
+			break;
+		}
+
+		CompressionBenchmarkPayload p;
+		p.compression_class = header[4];
+		p.data.resize(length);
+		if (!in.read(reinterpret_cast<char *>(p.data.data()), length)) {
+			break;
+		}
+
+		payloads.push_back(std::move(p));
+	}
+
+	return payloads;
+}
+
+// rough stand ins for a busy zone, small position updates, batches of them and fragments of text heavy packets
+std::vector<CompressionBenchmarkPayload> GenerateCompressionBenchmarkPayloads(uint32 count, uint32 seed)
+{
+	std::vector<CompressionBenchmarkPayload> payloads;
+
+	std::mt19937                    rng(seed);
+	std::uniform_int_distribution<> byte(0, 255);
+	std::uniform_int_distribution<> kind(0, 9);
+
+	const std::string text = "You have been given a task. Speak with the merchant in the Plane of Knowledge. ";
+
+	auto position_update = [&](std::vector<uint8_t> &out) {
+		// opcode, spawn id and packed coordinates, mostly high entropy
+		out.push_back(0x00);
+		out.push_back(0x09);
+		for (int i = 0; i < 20; i++) {
+			out.push_back(static_cast<uint8_t>(byte(rng)));
+		}
+		out.insert(out.end(), 6, 0);
+	};
+
+	for (uint32 i = 0; i < count; i++) {
+		CompressionBenchmarkPayload p;
+
+		const int k = kind(rng);
+		if (k < 5) {
+			p.compression_class = EQ::Net::CompressionClassPacket;
+			position_update(p.data);
+		}
+		else if (k < 8) {
+			p.compression_class = EQ::Net::CompressionClassCombined;
+			const int updates   = 4 + byte(rng) % 12;
+			for (int u = 0; u < updates; u++) {
+				p.data.push_back(28);
+				position_update(p.data);
+			}
+		}
+		else {
+			p.compression_class = EQ::Net::CompressionClassFragment;
+			while (p.data.size() < 500) {
+				p.data.insert(p.data.end(), text.begin(), text.end());
+				p.data.push_back(static_cast<uint8_t>(byte(rng)));
+			}
+			p.data.resize(500);
+		}
+
+		payloads.push_back(std::move(p));
+	}
+
+	return payloads;
+}
+
+void ZoneCLI::BenchmarkCompression(int argc, char **argv, argh::parser &cmd, std::string &description)
+{
+	description = "Benchmark reliable stream packet compression, per call zlib streams against reused ones, per level and class.";
+
+	if (cmd[{"-h", "--help"}]) {
+		std::cout << "Usage: benchmark:compression [--capture=path] [--packets=50000] [--levels=1,4,6,9] [--min-size=31] "
+					 "[--seed=1]\n";
+		return;
+	}
+
+	std::string levels   = "1,4,6,9";
+	uint32      packets  = 50000;
+	uint32      min_size = 31;
+	uint32      seed     = 1;
+	if (!cmd("--levels").str().empty()) {
+		levels = cmd("--levels").str();
+	}
+	cmd("--packets", packets) >> packets;
+	cmd("--min-size", min_size) >> min_size;
+	cmd("--seed", seed) >> seed;
+
+	std::vector<CompressionBenchmarkPayload> payloads;
+	if (!cmd("--capture").str().empty()) {
+		payloads = LoadCompressionBenchmarkCapture(cmd("--capture").str());
+		std::cout << "📦 Loaded [" << Strings::Commify(payloads.size()) << "] captured payloads from ["
+				  << cmd("--capture").str() << "]\n";
+	}
+	else {
+		payloads = GenerateCompressionBenchmarkPayloads(packets, seed);
+		std::cout << "📦 Generated [" << Strings::Commify(payloads.size()) << "] synthetic payloads\n";
+	}
+
+	if (payloads.empty()) {
+		return;
+	}
+
+	using clock = std::chrono::steady_clock;
+
+	uint8_t deflated[2048];
+	uint8_t inflated[4096];
+
+	for (const auto &level_str : Strings::Split(levels, ',')) {
+		const int level = Strings::ToInt(level_str);
+		if (level < 1 || level > 9) {
+			continue;
+		}
+
+		std::cout << Strings::Repeat("-", 70) << "\n";
+		std::cout << "⚙️  Level [" << level << "] minimum size [" << min_size << "]\n";
+		std::cout << Strings::Repeat("-", 70) << "\n";
+		std::cout << fmt::format(
+			"{:<10} {:>9} {:>11} {:>11} {:>8} {:>10} {:>10}\n",
+			"Class",
+			"Packets",
+			"Bytes In",
+			"Saved",
+			"Ratio",
+			"one-shot",
+			"reused"
+		);
+
+		for (int c = 0; c < EQ::Net::CompressionClassCount; c++) {
+			size_t packet_count = 0, bytes_in = 0, bytes_saved = 0, mismatches = 0;
+			double one_shot_ns  = 0.0, reused_ns = 0.0;
+
+			for (const auto &p : payloads) {
+				if (p.compression_class != c || p.data.size() < min_size) {
+					continue;
+				}
+
+				const auto length = static_cast<uint32>(p.data.size());
+
+				auto start = clock::now();
+				EQ::Net::DeflatePacketOneShot(p.data.data(), length, deflated, sizeof(deflated), level);
+				one_shot_ns += std::chrono::duration<double, std::nano>(clock::now() - start).count();
+
+				start = clock::now();
+				const uint32 out = EQ::Net::DeflatePacket(p.data.data(), length, deflated, sizeof(deflated), level);
+				reused_ns += std::chrono::duration<double, std::nano>(clock::now() - start).count();
+
+				const uint32 back = out ? EQ::Net::InflatePacket(deflated, out, inflated, sizeof(inflated)) : 0;
+				if (out && (back != length || memcmp(inflated, p.data.data(), length) != 0)) {
+					mismatches++;
+				}
+
+				packet_count++;
+				bytes_in += length;
+				// a packet deflate can not shrink goes out stored with its one byte marker either way
+				if (out && out + 1 <= length) {
+					bytes_saved += length - (out + 1);
+				}
+			}
+
+			if (packet_count == 0) {
+				continue;
+			}
+
+			std::cout << fmt::format(
+				"{:<10} {:>9} {:>11} {:>11} {:>7.1f}% {:>7.0f} ns {:>7.0f} ns{}\n",
+				EQ::Net::GetCompressionClassName(c),
+				Strings::Commify(packet_count),
+				Strings::Commify(bytes_in),
+				Strings::Commify(bytes_saved),
+				100.0 * bytes_saved / bytes_in,
+				one_shot_ns / packet_count,
+				reused_ns / packet_count,
+				mismatches ? fmt::format(" ❌ [{}] round trip mismatches", mismatches) : ""
+			);
+		}
+	}
+
+	std::cout << Strings::Repeat("-", 70) << "\n";
+}
@@ -0,0 +1,202 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include "../../common/eqemu_logsys.h"
+#include "../../common/strings.h"
+#include "../map.h"
+#include "../raycast_mesh.h"
+
+struct RaycastBenchmarkRays {
+	std::vector<glm::vec3> from;
+	std::vector<glm::vec3> to;
+};
+
+// AE shaped workload, groups of targets scattered on the ground around a caster standing somewhere on the map
+RaycastBenchmarkRays GenerateRaycastBenchmarkRays(Map *m, uint32 groups, uint32 group_size, uint32 seed)
+{
+	RaycastBenchmarkRays rays;
+
+	const RmReal *bmin = m->GetRaycastMesh()->getBoundMin();
+	const RmReal *bmax = m->GetRaycastMesh()->getBoundMax();
+
+	std::mt19937                          rng(seed);
+	std::uniform_real_distribution<float> x_dist(bmin[0], bmax[0]);
+	std::uniform_real_distribution<float> y_dist(bmin[1], bmax[1]);
+	std::uniform_real_distribution<float> offset(-150.0f, 150.0f);
+
+	auto ground = [&](float x, float y, float &z) {
+		glm::vec3 p(x, y, bmax[2]);
+		z = m->FindBestZ(p, nullptr);
+		return z != BEST_Z_INVALID;
+	};
+
+	for (uint32 g = 0, attempts = 0; g < groups && attempts < groups * 100; attempts++) {
+		float     z;
+		glm::vec3 caster(x_dist(rng), y_dist(rng), 0.0f);
+		if (!ground(caster.x, caster.y, z)) {
+			continue;
+		}
+		caster.z = z + 5.0f;
+
+		for (uint32 i = 0; i < group_size; i++) {
+			glm::vec3 target(caster.x + offset(rng), caster.y + offset(rng), caster.z);
+			if (ground(target.x, target.y, z)) {
+				target.z = z + 3.0f;
+			}
+
+			rays.from.push_back(caster);
+			rays.to.push_back(target);
+		}
+
+		g++;
+	}
+
+	return rays;
+}
+
+void ZoneCLI::BenchmarkRaycast(int argc, char **argv, argh::parser &cmd, std::string &description)
+{
+	description = "Benchmark the flattened BVH raycasts against the pointer tree and brute force on real map files.";
+
+	if (cmd[{"-h", "--help"}]) {
+		std::cout << "Usage: benchmark:raycast [--zones=qeynos2,freporte,crushbone] [--groups=2500] [--group-size=40] "
+					 "[--brute-rays=500] [--seed=1]\n";
+		return;
+	}
+
+	std::string zones      = "qeynos2,freporte,crushbone";
+	uint32      groups     = 2500;
+	uint32      group_size = 40;
+	uint32      brute_rays = 500;
+	uint32      seed       = 1;
+	if (!cmd("--zones").str().empty()) {
+		zones = cmd("--zones").str();
+	}
+	cmd("--groups", groups) >> groups;
+	cmd("--group-size", group_size) >> group_size;
+	cmd("--brute-rays", brute_rays) >> brute_rays;
+	cmd("--seed", seed) >> seed;
+
+	if (group_size == 0) {
+		return;
+	}
+
+	using clock = std::chrono::steady_clock;
+	auto ns_per_ray = [](clock::time_point start, clock::time_point end, size_t rays) {
+		return rays ? std::chrono::duration<double, std::nano>(end - start).count() / rays : 0.0;
+	};
+
+	for (const auto &zone_name : Strings::Split(zones, ',')) {
+		EQEmuLogSys::Instance()->SilenceConsoleLogging();
+		Map *m = Map::LoadMapFile(zone_name);
+		EQEmuLogSys::Instance()->EnableConsoleLogging();
+
+		std::cout << Strings::Repeat("-", 70) << "\n";
+		if (!m || !m->GetRaycastMesh()) {
+			std::cout << "⚠️  No map file for [" << zone_name << "], skipping\n";
+			safe_delete(m);
+			continue;
+		}
+
+		RaycastMesh *rm   = m->GetRaycastMesh();
+		auto         rays = GenerateRaycastBenchmarkRays(m, groups, group_size, seed);
+		const size_t n    = rays.from.size();
+
+		std::cout << "🗺️  " << zone_name << " | " << Strings::Commify(n) << " rays in groups of " << group_size << "\n";
+		std::cout << Strings::Repeat("-", 70) << "\n";
+
+		std::vector<bool>  tree_hit(n), flat_hit(n), occluded(n), batch_visible;
+		std::vector<float> tree_distance(n, 0.0f), flat_distance(n, 0.0f);
+
+		auto start = clock::now();
+		for (size_t i = 0; i < n; i++) {
+			tree_hit[i] = rm->treeRaycast(
+				(const RmReal *) &rays.from[i],
+				(const RmReal *) &rays.to[i],
+				nullptr,
+				nullptr,
+				&tree_distance[i]
+			);
+		}
+		const double tree_ns = ns_per_ray(start, clock::now(), n);
+
+		start = clock::now();
+		for (size_t i = 0; i < n; i++) {
+			flat_hit[i] = rm->raycast(
+				(const RmReal *) &rays.from[i],
+				(const RmReal *) &rays.to[i],
+				nullptr,
+				nullptr,
+				&flat_distance[i]
+			);
+		}
+		const double flat_ns = ns_per_ray(start, clock::now(), n);
+
+		start = clock::now();
+		for (size_t i = 0; i < n; i++) {
+			occluded[i] = rm->occluded((const RmReal *) &rays.from[i], (const RmReal *) &rays.to[i]);
+		}
+		const double occluded_ns = ns_per_ray(start, clock::now(), n);
+
+		// one CheckLoSBatch per caster, the way an AE resolves its targets
+		std::vector<bool>      group_visible;
+		std::vector<glm::vec3> targets;
+		start = clock::now();
+		for (size_t g = 0; g < n; g += group_size) {
+			targets.assign(rays.to.begin() + g, rays.to.begin() + g + group_size);
+			m->CheckLoSBatch(rays.from[g], targets, group_visible);
+			batch_visible.insert(batch_visible.end(), group_visible.begin(), group_visible.end());
+		}
+		const double batch_ns = ns_per_ray(start, clock::now(), n);
+
+		const size_t brute_n     = std::min<size_t>(brute_rays, n);
+		size_t       brute_diffs = 0;
+		start = clock::now();
+		for (size_t i = 0; i < brute_n; i++) {
+			float distance = 0.0f;
+			bool  hit      = rm->bruteForceRaycast(
+				(const RmReal *) &rays.from[i],
+				(const RmReal *) &rays.to[i],
+				nullptr,
+				nullptr,
+				&distance
+			);
+			if (hit != flat_hit[i] || (hit && distance != flat_distance[i])) {
+				brute_diffs++;
+			}
+		}
+		const double brute_ns = ns_per_ray(start, clock::now(), brute_n);
+
+		size_t hits = 0, tree_diffs = 0, occluded_diffs = 0, batch_diffs = 0;
+		for (size_t i = 0; i < n; i++) {
+			hits += flat_hit[i];
+			if (tree_hit[i] != flat_hit[i] || (tree_hit[i] && tree_distance[i] != flat_distance[i])) {
+				tree_diffs++;
+			}
+			if (occluded[i] != flat_hit[i]) {
+				occluded_diffs++;
+			}
+			if (batch_visible[i] != !flat_hit[i]) {
+				batch_diffs++;
+			}
+		}
+
+		std::cout << fmt::format("{:<32} {:>12} {:>10}\n", "Query", "ns / ray", "vs tree");
+		std::cout << fmt::format("{:<32} {:>12.1f} {:>10}\n", "bruteForceRaycast", brute_ns, "-");
+		std::cout << fmt::format("{:<32} {:>12.1f} {:>10}\n", "treeRaycast (pointer tree)", tree_ns, "1.00x");
+		std::cout << fmt::format("{:<32} {:>12.1f} {:>9.2f}x\n", "raycast (flat BVH)", flat_ns, tree_ns / flat_ns);
+		std::cout << fmt::format("{:<32} {:>12.1f} {:>9.2f}x\n", "occluded", occluded_ns, tree_ns / occluded_ns);
+		std::cout << fmt::format("{:<32} {:>12.1f} {:>9.2f}x\n", "CheckLoSBatch", batch_ns, tree_ns / batch_ns);
+		std::cout << "\n";
+		std::cout << "Blocked rays [" << Strings::Commify(hits) << "] of [" << Strings::Commify(n) << "]\n";
+		std::cout << (tree_diffs ? "❌" : "✅") << " raycast vs tree mismatches [" << tree_diffs << "]\n";
+		std::cout << (brute_diffs ? "❌" : "✅") << " raycast vs brute force mismatches [" << brute_diffs << "] of [" << brute_n << "]\n";
+		std::cout << (occluded_diffs ? "❌" : "✅") << " occluded mismatches [" << occluded_diffs << "]\n";
+		std::cout << (batch_diffs ? "❌" : "✅") << " CheckLoSBatch mismatches [" << batch_diffs << "]\n";
+
+		safe_delete(m);
+	}
+
+	std::cout << Strings::Repeat("-", 70) << "\n";
+}
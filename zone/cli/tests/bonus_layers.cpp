@@ -0,0 +1,245 @@
+#include <random>
+#include "../../common/eqemu_logsys.h"
+#include "../../zone.h"
+#include "../../client.h"
+
+extern Zone *zone;
+
+struct BonusLayerSnapshot {
+	StatBonuses items;
+	StatBonuses spells;
+	StatBonuses aas;
+	int64       max_hp;
+	int64       max_mana;
+	int64       max_endurance;
+	int32       ac;
+	int32       str;
+	int32       sta;
+	int32       mr;
+	bool        rooted;
+};
+
+inline BonusLayerSnapshot TakeBonusLayerSnapshot(Client *c)
+{
+	BonusLayerSnapshot s{};
+	memcpy(&s.items, c->GetItemBonusesPtr(), sizeof(StatBonuses));
+	memcpy(&s.spells, c->GetSpellBonusesPtr(), sizeof(StatBonuses));
+	memcpy(&s.aas, c->GetAABonusesPtr(), sizeof(StatBonuses));
+	s.max_hp        = c->GetMaxHP();
+	s.max_mana      = c->GetMaxMana();
+	s.max_endurance = c->GetMaxEndurance();
+	s.ac            = c->GetAC();
+	s.str           = c->GetSTR();
+	s.sta           = c->GetSTA();
+	s.mr            = c->GetMR();
+	s.rooted        = c->IsRooted();
+
+	return s;
+}
+
+// runs the incremental CalcBonuses, then forces a full rebuild and checks both agree
+inline void CheckBonusLayers(Client *c, const std::string &step)
+{
+	const int32 atk_cap_before = c->GetSpellBonusesPtr()->ItemATKCap + c->GetAABonusesPtr()->ItemATKCap;
+
+	c->CalcBonuses();
+
+	// the item pass clamps against the caps going in, so a step that moves them lags one pass in a full rebuild too
+	if (c->GetSpellBonusesPtr()->ItemATKCap + c->GetAABonusesPtr()->ItemATKCap != atk_cap_before) {
+		c->CalcBonuses();
+	}
+
+	const auto incremental = TakeBonusLayerSnapshot(c);
+
+	c->SetBonusesDirty(BonusLayer::All);
+	c->CalcBonuses();
+	const auto full = TakeBonusLayerSnapshot(c);
+
+	RunTest(step + " item layer", true, memcmp(&incremental.items, &full.items, sizeof(StatBonuses)) == 0);
+	RunTest(step + " spell layer", true, memcmp(&incremental.spells, &full.spells, sizeof(StatBonuses)) == 0);
+	RunTest(step + " aa layer", true, memcmp(&incremental.aas, &full.aas, sizeof(StatBonuses)) == 0);
+	RunTest(step + " max hp", std::to_string(full.max_hp), std::to_string(incremental.max_hp));
+	RunTest(step + " max mana", std::to_string(full.max_mana), std::to_string(incremental.max_mana));
+	RunTest(step + " max endurance", std::to_string(full.max_endurance), std::to_string(incremental.max_endurance));
+	RunTest(step + " ac", full.ac, incremental.ac);
+	RunTest(step + " str", full.str, incremental.str);
+	RunTest(step + " sta", full.sta, incremental.sta);
+	RunTest(step + " mr", full.mr, incremental.mr);
+	RunTest(step + " rooted", full.rooted, incremental.rooted);
+}
+
+// rescales an item in place, the inventory revision does not change so the item layer has to be marked by the caller
+inline void CheckItemScaleBonuses(Client *c, const std::vector<uint32> &item_ids)
+{
+	const EQ::ItemData *item = nullptr;
+	for (const auto id : item_ids) {
+		const auto d = database.GetItem(id);
+		if (d && d->HP >= 10) {
+			item = d;
+			break;
+		}
+	}
+
+	if (!item) {
+		std::cout << "No item with HP sampled, skipping item scale check\n";
+		return;
+	}
+
+	const auto slot = EQ::invslot::GUILD_TRIBUTE_BEGIN;
+	const auto inst = database.CreateItem(item->ID);
+	c->GetInv().PutItem(slot, *inst);
+	safe_delete(inst);
+	c->CalcBonuses();
+
+	const int64 hp_before = c->GetItemBonusesPtr()->HP;
+
+	auto scaled = c->GetInv().GetItem(slot);
+	scaled->SetExp(5000);
+	c->SendItemScale(scaled);
+
+	const int64 hp_expected = hp_before - item->HP + static_cast<int32>(static_cast<float>(item->HP) * 0.5f);
+	RunTest("item scale reaches item bonuses", std::to_string(hp_expected), std::to_string(c->GetItemBonusesPtr()->HP));
+
+	c->GetInv().DeleteItem(slot);
+	c->CalcBonuses();
+}
+
+void ZoneCLI::TestBonusLayers(int argc, char **argv, argh::parser &cmd, std::string &description)
+{
+	description = "Checks incremental bonus layer recalculation against a full rebuild on randomized state";
+
+	if (cmd[{"-h", "--help"}]) {
+		return;
+	}
+
+	uint32 seed  = 1;
+	uint32 steps = 200;
+	cmd("--seed", seed) >> seed;
+	cmd("--steps", steps) >> steps;
+
+	SetupZone("qrg");
+
+	std::cout << "===========================================\n";
+	std::cout << "⚙️> Running Bonus Layer Tests... (seed " << seed << ")\n";
+	std::cout << "===========================================\n\n";
+
+	std::mt19937 rng(seed);
+
+	int32  item_count  = 0;
+	uint32 max_item_id = 0;
+	database.GetItemsCount(item_count, max_item_id);
+
+	std::vector<uint32> item_ids;
+	for (int i = 0; i < 5000 && item_ids.size() < 200 && max_item_id > 0; i++) {
+		const uint32 id   = std::uniform_int_distribution<uint32>(1, max_item_id)(rng);
+		const auto   item = database.GetItem(id);
+		if (item && item->IsClassCommon()) {
+			item_ids.push_back(id);
+		}
+	}
+
+	std::vector<uint16> spell_ids;
+	for (int i = 0; i < 5000 && spell_ids.size() < 200 && SPDAT_RECORDS > 2; i++) {
+		const uint16 id = std::uniform_int_distribution<int>(2, SPDAT_RECORDS - 1)(rng);
+		if (IsValidSpell(id) && IsBeneficialSpell(id) && spells[id].buff_duration > 0 && !IsBardSong(id)) {
+			spell_ids.push_back(id);
+		}
+	}
+
+	std::vector<uint32> aa_rank_ids;
+	for (const auto &a : zone->aa_abilities) {
+		if (a.second->first_rank_id > 0) {
+			aa_rank_ids.push_back(a.second->first_rank_id);
+		}
+	}
+
+	std::cout << "Sampled " << item_ids.size() << " items, " << spell_ids.size() << " buffs, "
+		<< aa_rank_ids.size() << " AAs\n\n";
+
+	// tribute slots skip the race and class checks, so the classless test client still picks up their stats
+	const std::vector<int16> item_slots = {
+		EQ::invslot::slotHead,
+		EQ::invslot::slotChest,
+		EQ::invslot::slotPrimary,
+		EQ::invslot::GUILD_TRIBUTE_BEGIN,
+		EQ::invslot::GUILD_TRIBUTE_BEGIN + 1,
+		EQ::invslot::GENERAL_BEGIN,
+	};
+
+	Client *c = new Client();
+	c->SetCharacterId(1);
+	CheckBonusLayers(c, "initial state");
+	CheckItemScaleBonuses(c, item_ids);
+
+	auto pick = [&](size_t size) {
+		return std::uniform_int_distribution<size_t>(0, size - 1)(rng);
+	};
+
+	for (uint32 step = 0; step < steps; step++) {
+		const int op = std::uniform_int_distribution<int>(0, 5)(rng);
+
+		std::string name;
+		switch (op) {
+			case 0:
+				if (item_ids.empty()) {
+					continue;
+				}
+				{
+					const auto slot = item_slots[pick(item_slots.size())];
+					const auto inst = database.CreateItem(item_ids[pick(item_ids.size())]);
+					if (inst) {
+						c->GetInv().PutItem(slot, *inst);
+						safe_delete(inst);
+					}
+					name = fmt::format("step {} put item slot {}", step, slot);
+				}
+				break;
+			case 1:
+				{
+					const auto slot = item_slots[pick(item_slots.size())];
+					c->GetInv().DeleteItem(slot);
+					name = fmt::format("step {} remove item slot {}", step, slot);
+				}
+				break;
+			case 2:
+				if (spell_ids.empty()) {
+					continue;
+				}
+				{
+					const auto spell_id = spell_ids[pick(spell_ids.size())];
+					c->AddBuff(c, spell_id);
+					name = fmt::format("step {} add buff {}", step, spell_id);
+				}
+				break;
+			case 3:
+				{
+					const auto slot = static_cast<int>(pick(c->GetMaxBuffSlots()));
+					c->BuffFadeBySlot(slot, false);
+					name = fmt::format("step {} fade buff slot {}", step, slot);
+				}
+				break;
+			case 4:
+				if (aa_rank_ids.empty()) {
+					continue;
+				}
+				{
+					const auto rank_id = aa_rank_ids[pick(aa_rank_ids.size())];
+					c->SetAA(rank_id, 1);
+					name = fmt::format("step {} set aa rank {}", step, rank_id);
+				}
+				break;
+			case 5:
+				c->BuffProcess();
+				name = fmt::format("step {} buff tick", step);
+				break;
+		}
+
+		CheckBonusLayers(c, name);
+	}
+
+	safe_delete(c);
+
+	std::cout << "\n===========================================\n";
+	std::cout << "✅ All Bonus Layer Tests Completed!\n";
+	std::cout << "===========================================\n";
+}
@@ -4,6 +4,7 @@ extern Zone *zone;
 #include <cereal/types/map.hpp>
 #include "../../common/repositories/npc_types_repository.h"
 #include "../../corpse.h"
+#include "../../zone_save_state.h"
 #include "../../../common/repositories/respawn_times_repository.h"
 
 inline void ClearState()
@@ -100,18 +101,8 @@ inline std::map<std::string, std::string> GetVariablesDeserialized(const std::st
 		return deserialized_map;
 	}
 
-	if (!Strings::IsValidJson(entity_variables)) {
-		LogZoneState("Invalid JSON data for entity variables");
-		return deserialized_map;
-	}
-
 	try {
-		std::stringstream ss;
-		{
-			ss << entity_variables;
-			cereal::JSONInputArchive ar(ss);
-			ar(deserialized_map);
-		}
+		DeserializeZoneStateVariables(entity_variables, deserialized_map);
 	} catch (const std::exception &e) {
 		LogZoneState("Failed to load entity variables [{}]", e.what());
 	}
@@ -1105,6 +1096,74 @@ inline void TestLoot()
 	RunTest("Loot > No duplicates added when adding item to Corpse", false, duplicates_corpse);
 }
 
+inline void TestStateEncoding()
+{
+	LootStateData loot{};
+	loot.copper   = 1;
+	loot.platinum = 12345;
+	loot.entries  = {
+		{.item_id = 11621, .lootdrop_id = 100, .charges = 0},
+		{.item_id = 1001, .lootdrop_id = 0, .charges = 5},
+	};
+
+	std::map<std::string, std::string> variables = {
+		{"test_variable", "test_value"},
+		{"quoted", "a \"b\" c"},
+	};
+
+	std::vector<Buffs_Struct> buffs(1);
+	buffs[0].spellid       = 278;
+	buffs[0].ticsremaining = 42;
+	strcpy(buffs[0].caster_name, "Soandso");
+
+	for (const bool as_json: {false, true}) {
+		const std::string format = as_json ? "JSON" : "binary";
+		RuleManager::Instance()->SetRule("Zone:StateSaveAsJson", as_json ? "true" : "false");
+
+		const auto loot_data = SerializeZoneStateLoot(loot);
+		RunTest("Encoding > (" + format + ") loot is tagged as " + format, !as_json, IsZoneStateBinary(loot_data));
+
+		LootStateData loot_out{};
+		DeserializeZoneStateLoot(loot_data, loot_out);
+		RunTest("Encoding > (" + format + ") loot platinum round trips", 12345, (int) loot_out.platinum);
+		RunTest("Encoding > (" + format + ") loot entries round trip", 2, (int) loot_out.entries.size());
+		RunTest("Encoding > (" + format + ") loot entry charges round trip", 5, (int) loot_out.entries[1].charges);
+
+		std::map<std::string, std::string> variables_out;
+		DeserializeZoneStateVariables(SerializeZoneStateVariables(variables), variables_out);
+		RunTest("Encoding > (" + format + ") variables round trip", variables["quoted"], variables_out["quoted"]);
+
+		std::vector<Buffs_Struct> buffs_out;
+		DeserializeZoneStateBuffs(SerializeZoneStateBuffs(buffs), buffs_out);
+		RunTest("Encoding > (" + format + ") buff spell round trips", 278, buffs_out.empty() ? 0 : (int) buffs_out[0].spellid);
+		RunTest(
+			"Encoding > (" + format + ") buff caster round trips",
+			std::string("Soandso"),
+			std::string(buffs_out.empty() ? "" : buffs_out[0].caster_name)
+		);
+	}
+
+	RuleManager::Instance()->SetRule("Zone:StateSaveAsJson", "false");
+
+	const auto binary_size = SerializeZoneStateLoot(loot).size();
+	RuleManager::Instance()->SetRule("Zone:StateSaveAsJson", "true");
+	const auto json_size = SerializeZoneStateLoot(loot).size();
+	RuleManager::Instance()->SetRule("Zone:StateSaveAsJson", "false");
+
+	RunTest("Encoding > binary loot is smaller than JSON", true, binary_size < json_size);
+
+	bool threw = false;
+	try {
+		LootStateData bad{};
+		DeserializeZoneStateLoot("{not json", bad);
+	}
+	catch (const std::exception &) {
+		threw = true;
+	}
+
+	RunTest("Encoding > malformed data throws", true, threw);
+}
+
 void ZoneCLI::TestZoneState(int argc, char **argv, argh::parser &cmd, std::string &description)
 {
 	if (cmd[{"-h", "--help"}]) {
@@ -1119,6 +1178,7 @@ void ZoneCLI::TestZoneState(int argc, char **argv, argh::parser &cmd, std::strin
 	std::cout << "⚙\uFE0F> Running Zone State Tests... (soldungb)\n";
 	std::cout << "===========================================\n\n";
 
+	TestStateEncoding();
 	TestZoneVariables();
 	TestHpManaEnd();
 	TestBuffs();
@@ -37,6 +37,7 @@ extern volatile bool RunLoops;
 #include "../common/guilds.h"
 #include "../common/rulesys.h"
 #include "../common/strings.h"
+#include "../common/timer_wheel.h"
 #include "../common/data_verification.h"
 #include "../common/profanity_manager.h"
 #include "../common/data_bucket.h"
@@ -58,6 +59,7 @@ extern volatile bool RunLoops;
 #include "mob_movement_manager.h"
 #include "cheat_manager.h"
 #include "lua_parser.h"
+#include "character_save_queue.h"
 
 #include "../common/repositories/character_alternate_abilities_repository.h"
 #include "../common/repositories/character_expedition_lockouts_repository.h"
@@ -197,6 +199,11 @@ Client::Client() : Mob(
 	}
 
 	cheat_manager.SetClient(this);
+	qglobal_purge_timer.Attach(TimerWheel::Instance(), [this]() {
+		if (qGlobals) {
+			qGlobals->PurgeExpiredGlobals();
+		}
+	});
 	mMovementManager->AddClient(this);
 	character_id = 0;
 	conn_state = NoPacketsReceived;
@@ -322,6 +329,10 @@ Client::Client() : Mob(
 
 	InitializeBuffSlots();
 
+	memset(&m_item_bonus_cache, 0, sizeof(StatBonuses));
+	memset(&m_spell_bonus_cache, 0, sizeof(StatBonuses));
+	memset(&m_aa_bonus_cache, 0, sizeof(StatBonuses));
+
 	adventure_request_timer = nullptr;
 	adventure_create_timer = nullptr;
 	adventure_leave_timer = nullptr;
@@ -504,6 +515,11 @@ Client::Client(EQStreamInterface *ieqs) : Mob(
 	}
 
 	cheat_manager.SetClient(this);
+	qglobal_purge_timer.Attach(TimerWheel::Instance(), [this]() {
+		if (qGlobals) {
+			qGlobals->PurgeExpiredGlobals();
+		}
+	});
 	mMovementManager->AddClient(this);
 	character_id = 0;
 	conn_state = NoPacketsReceived;
@@ -633,6 +649,10 @@ Client::Client(EQStreamInterface *ieqs) : Mob(
 
 	InitializeBuffSlots();
 
+	memset(&m_item_bonus_cache, 0, sizeof(StatBonuses));
+	memset(&m_spell_bonus_cache, 0, sizeof(StatBonuses));
+	memset(&m_aa_bonus_cache, 0, sizeof(StatBonuses));
+
 	adventure_request_timer = nullptr;
 	adventure_create_timer = nullptr;
 	adventure_leave_timer = nullptr;
@@ -997,6 +1017,14 @@ bool Client::Save(uint8 iCommitNow) {
 
 	BenchTimer timer;
 
+	// hand the bulk of the writes off to the save worker unless this is a sync save (camp/zone-out)
+	auto save_queue   = CharacterSaveQueue::Instance();
+	bool write_behind = iCommitNow != 2 && save_queue->IsRunning() && RuleB(Character, AsyncSaves);
+	if (!write_behind && save_queue->IsRunning() && !save_queue->Flush(CharacterID())) {
+		// a write for us is stuck in flight, queueing behind it is the only way to stay ordered after it
+		write_behind = true;
+	}
+
 	/* Wrote current basics to PP for saves */
 	if (!m_lock_save_position) {
 		m_pp.x       = m_Position.x;
@@ -1024,16 +1052,22 @@ bool Client::Save(uint8 iCommitNow) {
 		m_pp.endurance = current_endurance;
 	}
 
-	/* Save Character Currency */
-	database.SaveCharacterCurrency(CharacterID(), &m_pp);
+	if (write_behind) {
+		// currency is clamped in place on save, keep doing that on the zone thread
+		database.ZeroPlayerProfileCurrency(&m_pp);
+	}
+	else {
+		/* Save Character Currency */
+		database.SaveCharacterCurrency(CharacterID(), &m_pp);
 
-	// save character binds
-	// this may not need to be called in Save() but it's here for now
-	// to maintain the current behavior
-	database.SaveCharacterBinds(this);
+		// save character binds
+		// this may not need to be called in Save() but it's here for now
+		// to maintain the current behavior
+		database.SaveCharacterBinds(this);
 
-	/* Save Character Buffs */
-	database.SaveBuffs(this);
+		/* Save Character Buffs */
+		database.SaveBuffs(this);
+	}
 
 	/* Total Time Played */
 	TotalSecondsPlayed += (time(nullptr) - m_pp.lastlogin);
@@ -1067,7 +1101,9 @@ bool Client::Save(uint8 iCommitNow) {
 	} else {
 		memset(&m_petinfo, 0, sizeof(struct PetInfo));
 	}
-	database.SavePetInfo(this);
+	if (!write_behind) {
+		database.SavePetInfo(this);
+	}
 
 	if(tribute_timer.Enabled()) {
 		m_pp.tribute_time_remaining = tribute_timer.GetRemainingTime();
@@ -1084,7 +1120,10 @@ bool Client::Save(uint8 iCommitNow) {
 
 	p_timers.Store(&database);
 
-	database.SaveCharacterTribute(this);
+	if (!write_behind) {
+		database.SaveCharacterTribute(this);
+	}
+
 	SaveTaskState(); /* Save Character Task */
 
 	LogFood("Client::Save - hunger_level: [{}] thirst_level: [{}]", m_pp.hunger_level, m_pp.thirst_level);
@@ -1099,7 +1138,26 @@ bool Client::Save(uint8 iCommitNow) {
 		}
 	}
 
-	database.SaveCharacterData(this, &m_pp, &m_epp); /* Save Character Data */
+	if (write_behind) {
+		auto state = std::make_unique<CharacterSaveState>();
+
+		state->character_id   = CharacterID();
+		state->account_id     = AccountID();
+		state->name           = GetCleanName();
+		state->pp             = m_pp;
+		state->epp            = m_epp;
+		state->exp_enabled    = IsEXPEnabled();
+		state->mail_key       = GetMailKeyFull();
+		state->illusion_block = GetIllusionBlock();
+		state->buffs.assign(GetBuffs(), GetBuffs() + GetMaxBuffSlots());
+		state->pet            = m_petinfo;
+		state->suspended_pet  = m_suspendedminion;
+
+		save_queue->Enqueue(std::move(state));
+	}
+	else {
+		database.SaveCharacterData(this, &m_pp, &m_epp); /* Save Character Data */
+	}
 
 	database.SaveCharacterEXPModifier(this);
 
@@ -1112,6 +1170,15 @@ bool Client::Save(uint8 iCommitNow) {
 	return true;
 }
 
+bool Client::SaveCurrency()
+{
+	if (!CharacterSaveQueue::Instance()->Flush(CharacterID())) {
+		return false;
+	}
+
+	return database.SaveCharacterCurrency(CharacterID(), &m_pp);
+}
+
 CLIENTPACKET::CLIENTPACKET()
 {
 	app = nullptr;
@@ -1171,27 +1238,46 @@ bool Client::SendAllPackets() {
 }
 
 void Client::QueuePacket(const EQApplicationPacket* app, bool ack_req, CLIENT_CONN_STATUS required_state, eqFilterType filter) {
-	if (filter != FilterNone && GetFilter(filter) == FilterHide) {
+	if (DeferOrDropPacket(app, ack_req, required_state, filter)) {
 		return;
 	}
 
-	if (RuleB(Character, AutoIdleFilterPackets) && m_is_idle && IsFilteredAFKPacket(app)) {
+	if (eqs) {
+		eqs->QueuePacket(app, ack_req);
+	}
+}
+
+void Client::QueuePacket(EQBroadcastPacket &broadcast, CLIENT_CONN_STATUS required_state, eqFilterType filter) {
+	if (DeferOrDropPacket(broadcast.GetPacket(), broadcast.IsAckRequired(), required_state, filter)) {
 		return;
 	}
 
+	broadcast.QueueTo(eqs);
+}
+
+// returns true when the packet should not go out on the stream right now, either filtered or held until connected
+bool Client::DeferOrDropPacket(const EQApplicationPacket* app, bool ack_req, CLIENT_CONN_STATUS required_state, eqFilterType filter) {
+	if (filter != FilterNone && GetFilter(filter) == FilterHide) {
+		return true;
+	}
+
+	if (RuleB(Character, AutoIdleFilterPackets) && m_is_idle && IsFilteredAFKPacket(app)) {
+		return true;
+	}
+
 	if (client_state != CLIENT_CONNECTED && required_state == CLIENT_CONNECTED) {
 		AddPacket(app, ack_req);
-		return;
+		return true;
 	}
 
 	// if the program doesnt care about the status or if the status isnt what we requested
 	if (required_state != CLIENT_CONNECTINGALL && client_state != required_state) {
 		// todo: save packets for later use
 		AddPacket(app, ack_req);
+		return true;
 	}
-	else if (eqs) {
-		eqs->QueuePacket(app, ack_req);
-	}
+
+	return false;
 }
 
 void Client::FastQueuePacket(EQApplicationPacket** app, bool ack_req, CLIENT_CONN_STATUS required_state) {
@@ -8660,6 +8746,7 @@ void Client::SendItemScale(EQ::ItemInstance *inst) {
 	if(slot != -1) {
 		inst->ScaleItem();
 		SendItemPacket(slot, inst, ItemPacketCharmUpdate);
+		SetBonusesDirty(BonusLayer::Items);
 		CalcBonuses();
 	}
 }
@@ -44,6 +44,7 @@ namespace EQ
 #include "../common/eq_packet_structs.h"
 #include "../common/emu_constants.h"
 #include "../common/eq_stream_intf.h"
+#include "../common/eq_broadcast_packet.h"
 #include "../common/eq_packet.h"
 #include "../common/linked_list.h"
 #include "../common/extprofile.h"
@@ -455,6 +456,7 @@ public:
 	bool ShouldISpawnFor(Client *c) { return !GMHideMe(c) && !IsHoveringForRespawn(); }
 	virtual bool Process();
 	void QueuePacket(const EQApplicationPacket* app, bool ack_req = true, CLIENT_CONN_STATUS = CLIENT_CONNECTINGALL, eqFilterType filter=FilterNone);
+	void QueuePacket(EQBroadcastPacket &broadcast, CLIENT_CONN_STATUS = CLIENT_CONNECTINGALL, eqFilterType filter=FilterNone);
 	void FastQueuePacket(EQApplicationPacket** app, bool ack_req = true, CLIENT_CONN_STATUS = CLIENT_CONNECTINGALL);
 	void ChannelMessageReceived(uint8 chan_num, uint8 language, uint8 lang_skill, const char* orig_message, const char* targetname = nullptr, bool is_silent = false);
 	void ChannelMessageSend(const char* from, const char* to, uint8 channel_id, uint8 language_id, uint8 language_skill, const char* message, ...);
@@ -489,7 +491,7 @@ public:
 	};
 
 	/* New PP Save Functions */
-	bool SaveCurrency(){ return database.SaveCharacterCurrency(this->CharacterID(), &m_pp); }
+	bool SaveCurrency();
 	bool SaveAA();
 	void RemoveExpendedAA(int aa_id);
 
@@ -1966,6 +1968,14 @@ public:
 protected:
 	friend class Mob;
 	void CalcEdibleBonuses(StatBonuses* newbon);
+
+	// last computed bonus layers, CalcBonuses copies these back instead of rebuilding clean layers
+	StatBonuses m_item_bonus_cache;
+	StatBonuses m_spell_bonus_cache;
+	StatBonuses m_aa_bonus_cache;
+	uint32      m_item_bonus_revision   = 0; // m_inv revision the item layer was built from
+	int32       m_item_bonus_atk_cap    = 0; // spell + AA ItemATKCap the item layer was capped with
+	uint32      m_bonus_generation      = 0;
 	void MakeBuffFadePacket(uint16 spell_id, int slot_id, bool send_message = true);
 	bool client_data_loaded;
 
@@ -2160,6 +2170,7 @@ private:
 	void SendZoneInPackets();
 	bool AddPacket(const EQApplicationPacket *, bool);
 	bool AddPacket(EQApplicationPacket**, bool);
+	bool DeferOrDropPacket(const EQApplicationPacket *app, bool ack_req, CLIENT_CONN_STATUS required_state, eqFilterType filter);
 	bool SendAllPackets();
 	std::deque<std::unique_ptr<CLIENTPACKET>> clientpackets;
 
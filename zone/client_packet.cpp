@@ -3258,6 +3258,7 @@ void Client::Handle_OP_AugmentItem(const EQApplicationPacket *app)
 					) {
 						old_aug = tobe_auged->RemoveAugment(in_augment->augment_index);
 						if (old_aug) { // An old augment was removed in order to be replaced with the new one (augment_action 2)
+							SetBonusesDirty(BonusLayer::Items); // augments change in place on the item instance
 							CalcBonuses();
 
 							std::vector<std::any> args;
@@ -3357,6 +3358,7 @@ void Client::Handle_OP_AugmentItem(const EQApplicationPacket *app)
 							}
 
 							if (PutItemInInventory(item_slot, *item_one_to_push, true)) { // Successfully added an augment to the item
+								SetBonusesDirty(BonusLayer::Items);
 								CalcBonuses();
 								if (material != EQ::textures::materialInvalid) { // Visible item augged while equipped. Send WC in case ornamentation changed.
 									SendWearChange(material);
@@ -3428,6 +3430,7 @@ void Client::Handle_OP_AugmentItem(const EQApplicationPacket *app)
 						Message(Chat::Yellow, "Error: Failed to return item after de-augmentation!");
 					}
 
+					SetBonusesDirty(BonusLayer::Items);
 					CalcBonuses();
 
 					if (material != EQ::textures::materialInvalid) {
@@ -3499,6 +3502,7 @@ void Client::Handle_OP_AugmentItem(const EQApplicationPacket *app)
 					}
 				}
 
+				SetBonusesDirty(BonusLayer::Items);
 				CalcBonuses();
 
 				if (material != EQ::textures::materialInvalid) {
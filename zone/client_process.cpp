@@ -269,12 +269,6 @@ bool Client::Process() {
 			}
 		}
 
-		if (qGlobals) {
-			if (qglobal_purge_timer.Check()) {
-				qGlobals->PurgeExpiredGlobals();
-			}
-		}
-
 		if (RuleB(Character, ActiveInvSnapshots) && time(nullptr) >= GetNextInvSnapshotTime()) {
 			if (database.SaveCharacterInvSnapshot(CharacterID())) {
 				SetNextInvSnapshot(RuleI(Character, InvSnapshotMinIntervalM));
@@ -561,10 +555,6 @@ bool Client::Process() {
 			{
 				ItemTimerCheck();
 			}
-
-			if (m_clear_wearchange_cache_timer.Check()) {
-				m_last_seen_wearchange.clear();
-			}
 		}
 	}
 
@@ -1126,7 +1126,32 @@ void EntityList::AESpell(
 		distance
 	);
 	auto list = caster_mob->GetCloseMobList(distance);
+
+	// line of sight from the center to everything in the AE's footprint, traced together up front
+	std::vector<bool> center_los;
+	if (center_mob && is_detrimental_spell && !spells[spell_id].npc_no_los) {
+		std::vector<Mob *> los_targets;
+		los_targets.reserve(list.size());
+		for (auto &it: list) {
+			Mob *m = it.second;
+			if (
+				m &&
+				IsWithinAxisAlignedBox(static_cast<glm::vec2>(m->GetPosition()), min, max) &&
+				DistanceSquared(m->GetPosition(), cast_target_position) <= distance_squared
+			) {
+				los_targets.push_back(m);
+			} else {
+				los_targets.push_back(nullptr);
+			}
+		}
+
+		center_mob->CheckLosFN(los_targets, center_los);
+	}
+
+	size_t list_index = 0;
 	for (auto& it: list) {
+		const size_t los_index = list_index++;
+
 		current_mob = it.second;
 		if (!current_mob) {
 			continue;
@@ -1202,7 +1227,7 @@ void EntityList::AESpell(
 				continue;
 			}
 
-			if (center_mob && !spells[spell_id].npc_no_los && !center_mob->CheckLosFN(current_mob)) {
+			if (center_mob && !spells[spell_id].npc_no_los && !center_los[los_index]) {
 				continue;
 			}
 
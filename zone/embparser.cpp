@@ -229,6 +229,10 @@ PerlembParser::PerlembParser() : perl(nullptr)
 
 PerlembParser::~PerlembParser()
 {
+	if (perl) {
+		ClearPackageVars();
+	}
+
 	safe_delete(perl);
 }
 
@@ -243,6 +247,7 @@ void PerlembParser::ReloadQuests()
 		if (!perl) {
 			perl = new Embperl;
 		} else {
+			ClearPackageVars();
 			perl->Reinit();
 		}
 
@@ -358,26 +363,26 @@ int PerlembParser::EventCommon(
 	}
 
 	if (quest_type == QuestType::Player || quest_type == QuestType::PlayerGlobal) {
-		return SendCommands(package_name.c_str(), QuestEventSubroutines[event_id], 0, mob, mob, nullptr, nullptr, nullptr);
+		return SendCommands(package_name.c_str(), event_id, 0, mob, mob, nullptr, nullptr, nullptr);
 	} else if (
 		quest_type == QuestType::Bot ||
 		quest_type == QuestType::BotGlobal ||
 		quest_type == QuestType::Merc ||
 		quest_type == QuestType::MercGlobal
 	) {
-		return SendCommands(package_name.c_str(), QuestEventSubroutines[event_id], 0, npc_mob, mob, nullptr, nullptr, nullptr);
+		return SendCommands(package_name.c_str(), event_id, 0, npc_mob, mob, nullptr, nullptr, nullptr);
 	} else if (quest_type == QuestType::Item || quest_type == QuestType::ItemGlobal) {
-		return SendCommands(package_name.c_str(), QuestEventSubroutines[event_id], 0, mob, mob, inst, nullptr, nullptr);
+		return SendCommands(package_name.c_str(), event_id, 0, mob, mob, inst, nullptr, nullptr);
 	} else if (quest_type == QuestType::Spell || quest_type == QuestType::SpellGlobal) {
 		if (mob) {
-			return SendCommands(package_name.c_str(), QuestEventSubroutines[event_id], 0, mob, mob, nullptr, spell, nullptr);
+			return SendCommands(package_name.c_str(), event_id, 0, mob, mob, nullptr, spell, nullptr);
 		} else {
-			return SendCommands(package_name.c_str(), QuestEventSubroutines[event_id], 0, npc_mob, mob, nullptr, spell, nullptr);
+			return SendCommands(package_name.c_str(), event_id, 0, npc_mob, mob, nullptr, spell, nullptr);
 		}
 	} else if (quest_type == QuestType::NPC || quest_type == QuestType::NPCGlobal) {
 		return SendCommands(
 			package_name.c_str(),
-			QuestEventSubroutines[event_id],
+			event_id,
 			object_id,
 			npc_mob,
 			mob,
@@ -388,7 +393,7 @@ int PerlembParser::EventCommon(
 	} else if (quest_type == QuestType::Zone || quest_type == QuestType::ZoneGlobal) {
 		return SendCommands(
 			package_name.c_str(),
-			QuestEventSubroutines[event_id],
+			event_id,
 			0,
 			nullptr,
 			nullptr,
@@ -403,7 +408,7 @@ int PerlembParser::EventNPC(
 	QuestEventID event_id,
 	NPC* npc,
 	Mob* mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -427,7 +432,7 @@ int PerlembParser::EventGlobalNPC(
 	QuestEventID event_id,
 	NPC* npc,
 	Mob* mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -450,7 +455,7 @@ int PerlembParser::EventGlobalNPC(
 int PerlembParser::EventPlayer(
 	QuestEventID event_id,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -473,7 +478,7 @@ int PerlembParser::EventPlayer(
 int PerlembParser::EventGlobalPlayer(
 	QuestEventID event_id,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -498,7 +503,7 @@ int PerlembParser::EventItem(
 	Client* client,
 	EQ::ItemInstance* inst,
 	Mob* mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -527,7 +532,7 @@ int PerlembParser::EventSpell(
 	Mob* mob,
 	Client* client,
 	uint32 spell_id,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -842,14 +847,7 @@ void PerlembParser::ExportHash(const char* prefix, const char* hash_name, std::m
 	}
 
 	try {
-		perl->sethash(
-			fmt::format(
-				"{}::{}",
-				prefix,
-				hash_name
-			).c_str(),
-			vals
-		);
+		perl->sethash(GetPackageHV(GetPackageVars(prefix), hash_name), vals);
 	} catch (std::string e) {
 		AddError(
 			fmt::format(
@@ -867,14 +865,7 @@ void PerlembParser::ExportVar(const char* prefix, const char* variable_name, int
 	}
 
 	try {
-		perl->seti(
-			fmt::format(
-				"{}::{}",
-				prefix,
-				variable_name
-			).c_str(),
-			value
-		);
+		perl->seti(GetPackageSV(GetPackageVars(prefix), variable_name), value);
 	} catch (std::string e) {
 		AddError(
 			fmt::format(
@@ -892,14 +883,7 @@ void PerlembParser::ExportVar(const char* prefix, const char* variable_name, uns
 	}
 
 	try {
-		perl->seti(
-			fmt::format(
-				"{}::{}",
-				prefix,
-				variable_name
-			).c_str(),
-			value
-		);
+		perl->seti(GetPackageSV(GetPackageVars(prefix), variable_name), value);
 	} catch (std::string e) {
 		AddError(
 			fmt::format(
@@ -917,14 +901,7 @@ void PerlembParser::ExportVar(const char* prefix, const char* variable_name, flo
 	}
 
 	try {
-		perl->setd(
-			fmt::format(
-				"{}::{}",
-				prefix,
-				variable_name
-			).c_str(),
-			value
-		);
+		perl->setd(GetPackageSV(GetPackageVars(prefix), variable_name), value);
 	} catch (std::string e) {
 		AddError(
 			fmt::format(
@@ -942,14 +919,7 @@ void PerlembParser::ExportVar(const char* prefix, const char* variable_name, con
 	}
 
 	try {
-		perl->setstr(
-			fmt::format(
-				"{}::{}",
-				prefix,
-				variable_name
-			).c_str(),
-			value
-		);
+		perl->setstr(GetPackageSV(GetPackageVars(prefix), variable_name), value);
 	} catch (std::string e) {
 		AddError(
 			fmt::format(
@@ -968,15 +938,7 @@ void PerlembParser::ExportVar(const char* prefix, const char* variable_name, con
 	}
 
 	try {
-		perl->setptr(
-			fmt::format(
-				"{}::{}",
-				prefix,
-				variable_name
-			).c_str(),
-			class_name,
-			value
-		);
+		perl->setptr(GetPackageSV(GetPackageVars(prefix), variable_name), class_name, value);
 	} catch (std::string e) {
 		AddError(fmt::format("Error exporting Perl variable [{}]", e));
 	}
@@ -984,7 +946,7 @@ void PerlembParser::ExportVar(const char* prefix, const char* variable_name, con
 
 int PerlembParser::SendCommands(
 	const char* prefix,
-	const char* event_id,
+	QuestEventID event_id,
 	uint32 object_id,
 	Mob* other,
 	Mob* mob,
@@ -1014,38 +976,15 @@ int PerlembParser::SendCommands(
 
 	quest_manager.StartQuest(q);
 
-	try {
-		perl->eval(fmt::format("package {};", prefix).c_str());
+	auto& vars = GetPackageVars(prefix);
 
+	try {
 #ifdef EMBPERL_XS_CLASSES
 		dTHX;
-		{
-			const std::vector<std::string>& suffixes = {
-				"bot",
-				"client",
-				"entity_list",
-				"merc",
-				"npc",
-				"questitem",
-				"spell",
-				"zone"
-			};
-
-			for (const auto& suffix : suffixes) {
-				const std::string& key = fmt::format("${}::{}", prefix, suffix);
-				if (clear_vars_.find(suffix) != clear_vars_.end()) {
-					auto e = fmt::format("{} = undef;", key);
-					perl->eval(e.c_str());
-				}
-			}
-		}
-
-		std::string buf;
 
 		//init a couple special vars: client, npc, entity_list
 		Client* c = quest_manager.GetInitiator();
-		buf = fmt::format("{}::client", prefix);
-		SV* client = get_sv(buf.c_str(), true);
+		SV* client = GetPackageSV(vars, "client");
 		if (c) {
 			sv_setref_pv(client, "Client", c);
 		} else {
@@ -1056,65 +995,37 @@ int PerlembParser::SendCommands(
 		if (other) {
 			if (other->IsBot()) {
 				Bot* b = quest_manager.GetBot();
-				buf = fmt::format("{}::bot", prefix);
-				SV* bot = get_sv(buf.c_str(), true);
-				sv_setref_pv(bot, "Bot", b);
+				sv_setref_pv(GetPackageSV(vars, "bot"), "Bot", b);
 			} else if (other->IsMerc()) {
 				Merc* m = quest_manager.GetMerc();
-				buf = fmt::format("{}::merc", prefix);
-				SV* merc = get_sv(buf.c_str(), true);
-				sv_setref_pv(merc, "Merc", m);
+				sv_setref_pv(GetPackageSV(vars, "merc"), "Merc", m);
 			} else if (other->IsNPC()) {
 				NPC* n = quest_manager.GetNPC();
-				buf = fmt::format("{}::npc", prefix);
-				SV* npc = get_sv(buf.c_str(), true);
-				sv_setref_pv(npc, "NPC", n);
+				sv_setref_pv(GetPackageSV(vars, "npc"), "NPC", n);
 			}
 		}
 
 		//only export QuestItem if it's an inst quest
 		if (inst) {
 			auto i = quest_manager.GetQuestItem();
-			buf = fmt::format("{}::questitem", prefix);
-			SV* questitem = get_sv(buf.c_str(), true);
-			sv_setref_pv(questitem, "QuestItem", i);
+			sv_setref_pv(GetPackageSV(vars, "questitem"), "QuestItem", i);
 		}
 
 		if (spell) {
 			const auto current_spell = quest_manager.GetQuestSpell();
 			auto       real_spell    = const_cast<SPDat_Spell_Struct*>(current_spell);
-			buf = fmt::format("{}::spell", prefix);
-			SV* spell = get_sv(buf.c_str(), true);
-			sv_setref_pv(spell, "Spell", (void*) real_spell);
+			sv_setref_pv(GetPackageSV(vars, "spell"), "Spell", (void*) real_spell);
 		}
 
-
-		buf = fmt::format("{}::entity_list", prefix);
-		SV* el = get_sv(buf.c_str(), true);
-		sv_setref_pv(el, "EntityList", &entity_list);
+		sv_setref_pv(GetPackageSV(vars, "entity_list"), "EntityList", &entity_list);
 #endif
 
 		//now call the requested sub
-		const std::string& sub_key = fmt::format("{}::{}", prefix, event_id);
-		ret_value = perl->dosub(sub_key.c_str());
+		ret_value = perl->dosub(GetPackageSub(vars, event_id));
 
 #ifdef EMBPERL_XS_CLASSES
-		{
-			const std::vector<std::string>& suffixes = {
-				"bot",
-				"client",
-				"entity_list",
-				"merc",
-				"npc",
-				"questitem",
-				"spell",
-				"zone"
-			};
-
-			for (const auto& suffix : suffixes) {
-				const std::string& key = fmt::format("${}::{}", prefix, suffix);
-				clear_vars_[key] = 1;
-			}
+		for (const auto& suffix : { "bot", "client", "entity_list", "merc", "npc", "questitem", "spell", "zone" }) {
+			clear_vars_.push_back(GetPackageSV(vars, suffix));
 		}
 #endif
 
@@ -1123,7 +1034,7 @@ int PerlembParser::SendCommands(
 			fmt::format(
 				"Script Error | Package [{}] Event [{}] Error [{}]",
 				prefix,
-				event_id,
+				QuestEventSubroutines[event_id],
 				Strings::Trim(e)
 			)
 		);
@@ -1133,29 +1044,93 @@ int PerlembParser::SendCommands(
 
 #ifdef EMBPERL_XS_CLASSES
 	if (!quest_manager.QuestsRunning()) {
-		std::string eval_str;
-		for (const auto& v: clear_vars_) {
-			eval_str += fmt::format("{} = undef;", v.first);
+		dTHX;
+		for (auto sv : clear_vars_) {
+			sv_setsv(sv, &PL_sv_undef);
 		}
 
 		clear_vars_.clear();
-
-		try {
-			perl->eval(eval_str.c_str());
-		} catch (std::string e) {
-			AddError(
-				fmt::format(
-					"Script Clear Error | Error [{}]",
-					e
-				)
-			);
-		}
 	}
 #endif
 
 	return ret_value;
 }
 
+PerlembParser::PackageVars& PerlembParser::GetPackageVars(const char* prefix)
+{
+	// consecutive exports almost always target the same package
+	if (last_package_vars_ && last_package_vars_->package == prefix) {
+		return *last_package_vars_;
+	}
+
+	auto& p = package_vars_[prefix];
+	if (p.package.empty()) {
+		p.package = prefix;
+	}
+
+	last_package_vars_ = &p;
+
+	return p;
+}
+
+SV* PerlembParser::GetPackageSV(PackageVars& p, const char* variable_name)
+{
+	auto e = p.scalars.find(variable_name);
+	if (e != p.scalars.end()) {
+		return e->second;
+	}
+
+	dTHX;
+	SV* sv = get_sv(fmt::format("{}::{}", p.package, variable_name).c_str(), GV_ADD);
+	SvREFCNT_inc_simple_void_NN(sv);
+	p.scalars.emplace(variable_name, sv);
+
+	return sv;
+}
+
+HV* PerlembParser::GetPackageHV(PackageVars& p, const char* hash_name)
+{
+	auto e = p.hashes.find(hash_name);
+	if (e != p.hashes.end()) {
+		return e->second;
+	}
+
+	dTHX;
+	HV* hv = get_hv(fmt::format("{}::{}", p.package, hash_name).c_str(), GV_ADD);
+	SvREFCNT_inc_simple_void_NN((SV*) hv);
+	p.hashes.emplace(hash_name, hv);
+
+	return hv;
+}
+
+const char* PerlembParser::GetPackageSub(PackageVars& p, QuestEventID event_id)
+{
+	auto& sub = p.subs[event_id];
+	if (sub.empty()) {
+		sub = fmt::format("{}::{}", p.package, QuestEventSubroutines[event_id]);
+	}
+
+	return sub.c_str();
+}
+
+void PerlembParser::ClearPackageVars()
+{
+	dTHX;
+	for (auto& e : package_vars_) {
+		for (auto& sv : e.second.scalars) {
+			SvREFCNT_dec(sv.second);
+		}
+
+		for (auto& hv : e.second.hashes) {
+			SvREFCNT_dec((SV*) hv.second);
+		}
+	}
+
+	package_vars_.clear();
+	last_package_vars_ = nullptr;
+	clear_vars_.clear();
+}
+
 void PerlembParser::MapFunctions()
 {
 	dTHX;
@@ -1517,25 +1492,31 @@ void PerlembParser::ExportZoneVariables(std::string& package_name)
 
 void PerlembParser::ExportItemVariables(std::string& package_name, Mob* mob)
 {
+	dTHX;
+
 	if (mob && mob->IsClient()) {
-		perl->eval(fmt::format("%{}::hasitem = ();", package_name).c_str());
+		auto& vars    = GetPackageVars(package_name.c_str());
+		HV*   hasitem = GetPackageHV(vars, "hasitem");
+
+		hv_clear(hasitem);
 
 		for (int slot = EQ::invslot::EQUIPMENT_BEGIN; slot <= EQ::invslot::GENERAL_END; slot++) {
 			int item_id = mob->CastToClient()->GetItemIDAt(slot);
 			if (item_id != -1 && item_id != 0) {
-				auto hi_decl = fmt::format("push (@{{${0}::hasitem{{{1}}}}},{2});", package_name, item_id, slot);
-				perl->eval(hi_decl.c_str());
+				perl->pushhasharray(hasitem, item_id, slot);
 			}
 		}
 	}
 
 	if (mob && mob->IsClient()) {
-		perl->eval(fmt::format("%{}::oncursor = ();", package_name).c_str());
+		auto& vars     = GetPackageVars(package_name.c_str());
+		HV*   oncursor = GetPackageHV(vars, "oncursor");
+
+		hv_clear(oncursor);
 
 		int item_id = mob->CastToClient()->GetItemIDAt(EQ::invslot::slotCursor);
 		if (item_id != -1 && item_id != 0) {
-			auto hi_decl = fmt::format("push (@{{${0}::oncursor{{{1}}}}},{2});", package_name, item_id, EQ::invslot::slotCursor);
-			perl->eval(hi_decl.c_str());
+			perl->pushhasharray(oncursor, item_id, EQ::invslot::slotCursor);
 		}
 	}
 }
@@ -1633,8 +1614,9 @@ void PerlembParser::ExportEventVariables(
 		}
 
 		case EVENT_HP: {
-			ExportVar(package_name.c_str(), "hpevent", extra_data ? "-1" : data);
-			ExportVar(package_name.c_str(), "inchpevent", extra_data ? data : "-1");
+			const int hp_event = extra_pointers && !extra_pointers->empty() ? std::any_cast<int>(extra_pointers->at(0)) : -1;
+			ExportVar(package_name.c_str(), "hpevent", extra_data ? -1 : hp_event);
+			ExportVar(package_name.c_str(), "inchpevent", extra_data ? hp_event : -1);
 			break;
 		}
 
@@ -1672,7 +1654,8 @@ void PerlembParser::ExportEventVariables(
 		}
 
 		case EVENT_COMBAT: {
-			ExportVar(package_name.c_str(), "combat_state", data);
+			const bool joined = extra_pointers && !extra_pointers->empty() && std::any_cast<bool>(extra_pointers->at(0));
+			ExportVar(package_name.c_str(), "combat_state", joined ? 1 : 0);
 			break;
 		}
 
@@ -2386,19 +2369,24 @@ void PerlembParser::ExportEventVariables(
 
 		case EVENT_DAMAGE_GIVEN:
 		case EVENT_DAMAGE_TAKEN: {
-			Seperator sep(data);
-			ExportVar(package_name.c_str(), "entity_id", sep.arg[0]);
-			ExportVar(package_name.c_str(), "damage", sep.arg[1]);
-			ExportVar(package_name.c_str(), "spell_id", sep.arg[2]);
-			ExportVar(package_name.c_str(), "skill_id", sep.arg[3]);
-			ExportVar(package_name.c_str(), "is_damage_shield", sep.arg[4]);
-			ExportVar(package_name.c_str(), "is_avoidable", sep.arg[5]);
-			ExportVar(package_name.c_str(), "buff_slot", sep.arg[6]);
-			ExportVar(package_name.c_str(), "is_buff_tic", sep.arg[7]);
-			ExportVar(package_name.c_str(), "special_attack", sep.arg[8]);
+			if (!extra_pointers || extra_pointers->size() < 2) {
+				break;
+			}
+
+			const auto *d = std::any_cast<QuestDamageEvent*>(extra_pointers->at(1));
+			ExportVar(package_name.c_str(), "entity_id", static_cast<uint32>(d->entity_id));
+			// ExportVar has no 64-bit overload
+			ExportVar(package_name.c_str(), "damage", std::to_string(d->damage).c_str());
+			ExportVar(package_name.c_str(), "spell_id", static_cast<uint32>(d->spell_id));
+			ExportVar(package_name.c_str(), "skill_id", d->skill_id);
+			ExportVar(package_name.c_str(), "is_damage_shield", d->is_damage_shield ? 1 : 0);
+			ExportVar(package_name.c_str(), "is_avoidable", d->is_avoidable ? 1 : 0);
+			ExportVar(package_name.c_str(), "buff_slot", static_cast<int32>(d->buff_slot));
+			ExportVar(package_name.c_str(), "is_buff_tic", d->is_buff_tic ? 1 : 0);
+			ExportVar(package_name.c_str(), "special_attack", d->special_attack);
 
-			if (IsValidSpell(Strings::ToUnsignedInt(sep.arg[2]))) {
-				ExportVar(package_name.c_str(), "spell", "Spell", (void*) &spells[Strings::ToUnsignedInt(sep.arg[2])]);
+			if (IsValidSpell(d->spell_id)) {
+				ExportVar(package_name.c_str(), "spell", "Spell", (void*) &spells[d->spell_id]);
 			}
 
 			break;
@@ -2623,7 +2611,7 @@ int PerlembParser::EventBot(
 	QuestEventID event_id,
 	Bot* bot,
 	Mob* mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -2647,7 +2635,7 @@ int PerlembParser::EventGlobalBot(
 	QuestEventID event_id,
 	Bot* bot,
 	Mob* mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -2745,7 +2733,7 @@ int PerlembParser::EventMerc(
 	QuestEventID event_id,
 	Merc* merc,
 	Mob* mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -2769,7 +2757,7 @@ int PerlembParser::EventGlobalMerc(
 	QuestEventID event_id,
 	Merc* merc,
 	Mob* mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -2866,7 +2854,7 @@ bool PerlembParser::GlobalZoneHasQuestSub(QuestEventID event_id)
 int PerlembParser::EventZone(
 	QuestEventID event_id,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -2889,7 +2877,7 @@ int PerlembParser::EventZone(
 int PerlembParser::EventGlobalZone(
 	QuestEventID event_id,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -22,9 +22,11 @@
 
 #include "quest_parser_collection.h"
 #include "quest_interface.h"
+#include <array>
 #include <string>
 #include <queue>
 #include <map>
+#include <unordered_map>
 #include "embperl.h"
 
 class Mob;
@@ -67,7 +69,7 @@ public:
 		QuestEventID event_id,
 		NPC* npc,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -76,7 +78,7 @@ public:
 		QuestEventID event_id,
 		NPC* npc,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -84,7 +86,7 @@ public:
 	virtual int EventPlayer(
 		QuestEventID event_id,
 		Client* client,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -92,7 +94,7 @@ public:
 	virtual int EventGlobalPlayer(
 		QuestEventID event_id,
 		Client* client,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -102,7 +104,7 @@ public:
 		Client* client,
 		EQ::ItemInstance* item,
 		Mob* mob,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -112,7 +114,7 @@ public:
 		Mob* mob,
 		Client* client,
 		uint32 spell_id,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -121,7 +123,7 @@ public:
 		QuestEventID event_id,
 		Bot* bot,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -130,7 +132,7 @@ public:
 		QuestEventID event_id,
 		Bot* bot,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -139,7 +141,7 @@ public:
 		QuestEventID event_id,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -148,7 +150,7 @@ public:
 		QuestEventID event_id,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -156,7 +158,7 @@ public:
 	virtual int EventZone(
 		QuestEventID event_id,
 		Zone* zone,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -164,7 +166,7 @@ public:
 	virtual int EventGlobalZone(
 		QuestEventID event_id,
 		Zone* zone,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -227,7 +229,7 @@ private:
 
 	int SendCommands(
 		const char* prefix,
-		const char* event,
+		QuestEventID event_id,
 		uint32 spell_id,
 		Mob* other,
 		Mob* mob,
@@ -303,10 +305,30 @@ private:
 	PerlQuestStatus zone_quest_status_;
 	PerlQuestStatus global_zone_quest_status_;
 
+	/**
+	 * Handles to the variables exported into one quest package, resolved the first time each name is exported so
+	 * later events assign them directly instead of going through the symbol table. Every handle holds a reference,
+	 * dropped again in ClearPackageVars
+	 */
+	struct PackageVars {
+		std::string                              package;
+		std::unordered_map<std::string, SV*>     scalars;
+		std::unordered_map<std::string, HV*>     hashes;
+		std::array<std::string, _LargestEventID> subs; // fully qualified sub names, built on first call
+	};
+
+	PackageVars& GetPackageVars(const char* prefix);
+	SV* GetPackageSV(PackageVars& p, const char* variable_name);
+	HV* GetPackageHV(PackageVars& p, const char* hash_name);
+	const char* GetPackageSub(PackageVars& p, QuestEventID event_id);
+	void ClearPackageVars();
+
 	SV* _empty_sv;
 
-	std::map<std::string, std::string> vars_;
-	std::map<std::string, int>         clear_vars_;
+	std::map<std::string, std::string>           vars_;
+	std::unordered_map<std::string, PackageVars> package_vars_;
+	PackageVars*                                 last_package_vars_ = nullptr;
+	std::vector<SV*>                             clear_vars_; // blessed handles to undef once no quest is running
 };
 
 #endif
@@ -2473,7 +2473,9 @@ void Perl__UpdateZoneHeader(std::string key, std::string value)
 
 void Perl__set_rule(const char* rule_name, const char* rule_value)
 {
-	RuleManager::Instance()->SetRule(rule_name, rule_value);
+	if (RuleManager::Instance()->SetRule(rule_name, rule_value)) {
+		Mob::InvalidateAllBonusLayers();
+	}
 }
 
 std::string Perl__get_rule(const char* rule_name)
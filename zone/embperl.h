@@ -95,38 +95,58 @@ public:
 	//put an integer into a perl varable
 	void seti(const char* variable_name, int val) const
 	{
-		SV* t = get_sv(variable_name, true);
+		seti(get_sv(variable_name, true), val);
+	}
+
+	void seti(SV* t, int val) const
+	{
 		sv_setiv(t, val);
 	}
 
 	//put a real into a perl varable
 	void setd(const char* variable_name, float val) const
 	{
-		SV* t = get_sv(variable_name, true);
+		setd(get_sv(variable_name, true), val);
+	}
+
+	void setd(SV* t, float val) const
+	{
 		sv_setnv(t, val);
 	}
 
 	//put a string into a perl varable
 	void setstr(const char* variable_name, const char* val) const
 	{
-		SV* t = get_sv(variable_name, true);
+		setstr(get_sv(variable_name, true), val);
+	}
+
+	void setstr(SV* t, const char* val) const
+	{
 		sv_setpv(t, val);
 	}
 
 	// put a pointer into a blessed perl variable
 	void setptr(const char* variable_name, const char* class_name, void* val) const
 	{
-		SV* t = get_sv(variable_name, GV_ADD);
+		setptr(get_sv(variable_name, GV_ADD), class_name, val);
+	}
+
+	void setptr(SV* t, const char* class_name, void* val) const
+	{
 		sv_setref_pv(t, class_name, val);
 	}
 
 	// put key-value pairs in hash
 	void sethash(const char* variable_name, std::map<std::string, std::string>& vals)
+	{
+		sethash(get_hv(variable_name, TRUE), vals);
+	}
+
+	void sethash(HV* hv, std::map<std::string, std::string>& vals)
 	{
 		std::map<std::string, std::string>::iterator it;
 
-		// Get hash and clear it.
-		HV* hv = get_hv(variable_name, TRUE);
+		// Clear the hash
 		hv_clear(hv);
 
 		// Iterate through key-value pairs, storing them in hash
@@ -142,6 +162,26 @@ public:
 		}
 	}
 
+	// push val onto the array ref stored at hv{key}, creating the array the first time
+	void pushhasharray(HV* hv, int key, int val) const
+	{
+		char key_buf[16];
+		const int key_length = snprintf(key_buf, sizeof(key_buf), "%d", key);
+
+		SV** e = hv_fetch(hv, key_buf, key_length, TRUE);
+		if (!e) {
+			return;
+		}
+
+		if (!SvROK(*e) || SvTYPE(SvRV(*e)) != SVt_PVAV) {
+			SV* rv = newRV_noinc((SV*) newAV());
+			sv_setsv(*e, rv);
+			SvREFCNT_dec(rv);
+		}
+
+		av_push((AV*) SvRV(*e), newSViv(val));
+	}
+
 	//loads a file and compiles it into our interpreter (assuming it hasn't already been read in)
 	//idea borrowed from perlembed
 	int eval_file(const char* package_name, const char* filename);
@@ -328,6 +328,7 @@ void EntityList::AddClient(Client *client)
 	client->SetID(GetFreeID());
 	client_list.emplace(std::pair<uint16, Client *>(client->GetID(), client));
 	mob_list.emplace(std::pair<uint16, Mob *>(client->GetID(), client));
+	UpdateMobGrid(client->GetID(), client);
 }
 
 
@@ -539,6 +540,10 @@ void EntityList::MobProcess()
 			mob_dead = !mob->Process();
 		}
 
+		if (!mob_dead) {
+			UpdateMobGrid(id, mob);
+		}
+
 		size_t a_sz = mob_list.size();
 
 		if (a_sz > sz) {
@@ -695,6 +700,7 @@ void EntityList::AddNPC(NPC *npc, bool send_spawn_packet, bool dont_queue)
 
 	npc_list.emplace(std::pair<uint16, NPC *>(npc->GetID(), npc));
 	mob_list.emplace(std::pair<uint16, Mob *>(npc->GetID(), npc));
+	UpdateMobGrid(npc->GetID(), npc);
 
 	entity_list.ScanCloseMobs(npc);
 
@@ -781,6 +787,7 @@ void EntityList::AddMerc(Merc *merc, bool SendSpawnPacket, bool dontqueue)
 
 		merc_list.emplace(std::pair<uint16, Merc *>(merc->GetID(), merc));
 		mob_list.emplace(std::pair<uint16, Mob *>(merc->GetID(), merc));
+		UpdateMobGrid(merc->GetID(), merc);
 
 		if (parse->MercHasQuestSub(EVENT_SPAWN)) {
 			parse->EventMerc(EVENT_SPAWN, merc, nullptr, "", 0);
@@ -1517,56 +1524,74 @@ void EntityList::ReplaceWithTarget(Mob *pOldMob, Mob *pNewTarget)
 
 void EntityList::RemoveFromTargets(Mob *mob, bool RemoveFromXTargets)
 {
-	auto it = mob_list.begin();
-	while (it != mob_list.end()) {
-		Mob *m = it->second;
-		++it;
-
-		if (!m) {
-			continue;
-		}
+	RemoveFromTargetsWhere(mob, RemoveFromXTargets, [](Mob *) { return true; });
+}
 
-		if (RemoveFromXTargets && mob) {
-			if (m->IsClient() && (mob->CheckAggro(m) || mob->IsOnFeignMemory(m))) {
-				m->CastToClient()->RemoveXTarget(mob, false);
-			// FadingMemories calls this function passing the client.
-			} else if (mob->IsClient() && (m->CheckAggro(mob) || m->IsOnFeignMemory(mob))) {
-				mob->CastToClient()->RemoveXTarget(m, false);
+void EntityList::RemoveFromTargetsFadingMemories(Mob *spell_target, bool RemoveFromXTargets, uint32 max_level)
+{
+	RemoveFromTargetsWhere(
+		spell_target,
+		RemoveFromXTargets,
+		[max_level](Mob *m) {
+			if (max_level && m->GetLevel() > max_level) {
+				return false;
 			}
-		}
 
-		m->RemoveFromHateList(mob);
-		m->RemoveFromRampageList(mob);
-	}
+			return !m->GetSpecialAbility(SpecialAbility::MemoryFadeImmunity);
+		}
+	);
 }
 
-void EntityList::RemoveFromTargetsFadingMemories(Mob *spell_target, bool RemoveFromXTargets, uint32 max_level)
+void EntityList::RemoveFromTargetsWhere(Mob *mob, bool RemoveFromXTargets, const std::function<bool(Mob *)> &affected)
 {
-	for (auto &e : mob_list) {
-		auto &mob = e.second;
+	if (!mob) {
+		return;
+	}
 
-		if (!mob) {
-			continue;
+	// clients the mob has on its own lists
+	if (RemoveFromXTargets) {
+		std::vector<Client *> clients;
+		for (const auto &e : mob->GetHateList()) {
+			if (e->entity_on_hatelist && e->entity_on_hatelist->IsClient()) {
+				clients.push_back(e->entity_on_hatelist->CastToClient());
+			}
 		}
 
-		if (max_level && mob->GetLevel() > max_level) {
-			continue;
+		for (const auto &id : mob->GetFeignMemoryList()) {
+			Mob *m = GetMob(id);
+			if (m && m->IsClient()) {
+				clients.push_back(m->CastToClient());
+			}
+		}
+
+		for (auto c : clients) {
+			if (affected(c)) {
+				c->RemoveXTarget(mob, false);
+			}
 		}
+	}
 
-		if (mob->GetSpecialAbility(SpecialAbility::MemoryFadeImmunity)) {
+	// everything holding the mob on a hate, rampage or feign memory list
+	for (auto m : mob->GetAggroHolders()) {
+		if (!affected(m)) {
 			continue;
 		}
 
-		if (RemoveFromXTargets && spell_target) {
-			if (mob->IsClient() && (spell_target->CheckAggro(mob) || spell_target->IsOnFeignMemory(mob))) {
-				mob->CastToClient()->RemoveXTarget(spell_target, false);
-			} else if (spell_target->IsClient() && (mob->CheckAggro(spell_target) || mob->IsOnFeignMemory(spell_target))) {
-				spell_target->CastToClient()->RemoveXTarget(mob, false);
-			}
+		// FadingMemories passes the client
+		if (RemoveFromXTargets && mob->IsClient() && (m->CheckAggro(mob) || m->IsOnFeignMemory(mob))) {
+			mob->CastToClient()->RemoveXTarget(m, false);
 		}
 
-		mob->RemoveFromHateList(spell_target);
-		mob->RemoveFromRampageList(spell_target);
+		m->RemoveFromHateList(mob);
+		m->RemoveFromRampageList(mob);
+	}
+
+	// anything else still pointing at the mob drops it as a target, copied since that retargets out of the set
+	const std::vector<Mob *> targeted_by(mob->GetTargetedBy().begin(), mob->GetTargetedBy().end());
+	for (auto m : targeted_by) {
+		if (affected(m)) {
+			m->RemoveFromHateList(mob);
+		}
 	}
 }
 
@@ -1632,72 +1657,75 @@ void EntityList::RefreshClientXTargets(Client *c)
 	}
 }
 
-void EntityList::QueueClientsByTarget(Mob *sender, const EQApplicationPacket *app,
-		bool iSendToSender, Mob *SkipThisMob, bool ackreq, bool HoTT, uint32 ClientVersionBits, bool inspect_buffs, bool clear_target_window)
+// whether a client targeting sender gets a buff window packet, GMs and group inspect buffs leadership see the full window
+static bool CanInspectTargetBuffs(Client *c)
 {
-	auto it = client_list.begin();
-	while (it != client_list.end()) {
-		Client *c = it->second;
-		++it;
+	if (c->GetGM() || RuleB(Spells, AlwaysSendTargetsBuffs)) {
+		if (c->GetGM()) {
+			if (!c->EntityVariableExists(SEE_BUFFS_FLAG)) {
+				c->Message(Chat::White, "Your GM flag allows you to always see your targets' buffs.");
+				c->SetEntityVariable(SEE_BUFFS_FLAG, "1");
+			}
+		}
 
-		Mob *Target = c->GetTarget();
+		return true;
+	}
 
-		if (!Target)
-			continue;
+	if (c->IsRaidGrouped()) {
+		Raid *raid = c->GetRaid();
+		if (raid) {
+			uint32 gid = raid->GetGroup(c);
+			if (gid < MAX_RAID_GROUPS && raid->GroupCount(gid) >= 3) {
+				return raid->GetLeadershipAA(groupAAInspectBuffs, gid);
+			}
+		}
+
+		return false;
+	}
+
+	Group *group = c->GetGroup();
+	return group && group->GroupCount() >= 3 && group->GetLeadershipAA(groupAAInspectBuffs);
+}
 
-		Mob *TargetsTarget = nullptr;
+// Only clients targeting sender, or with HoTT targeting a mob that targets sender, can be interested, so those are
+// reached through the targeted-by sets instead of walking every client
+void EntityList::QueueClientsByTarget(Mob *sender, const EQApplicationPacket *app,
+		bool iSendToSender, Mob *SkipThisMob, bool ackreq, bool HoTT, uint32 ClientVersionBits, bool inspect_buffs, bool clear_target_window)
+{
+	if (!sender) {
+		return;
+	}
 
-		TargetsTarget = Target->GetTarget();
+	auto queue = [&](Client *c) {
+		if (c != SkipThisMob && (c->ClientVersionBit() & ClientVersionBits)) {
+			c->QueuePacket(app, ackreq);
+		}
+	};
 
-		bool Send = false;
+	// the sender only hears its own updates while it has a target
+	if (iSendToSender && sender->IsClient() && sender->GetTarget()) {
+		queue(sender->CastToClient());
+	}
 
-		if (c == SkipThisMob)
-			continue;
+	for (auto m : sender->GetTargetedBy()) {
+		if (m != sender && m->IsClient()) {
+			Client *c = m->CastToClient();
 
-		if (iSendToSender)
-			if (c == sender)
-				Send = true;
-
-		if (c != sender) {
-			if (Target == sender) {
-				if (inspect_buffs) { // if inspect_buffs is true we're sending a mob's buffs to those with the LAA
-					Send = clear_target_window;
-					if (c->GetGM() || RuleB(Spells, AlwaysSendTargetsBuffs)) {
-						if (c->GetGM()) {
-							if (!c->EntityVariableExists(SEE_BUFFS_FLAG)) {
-								c->Message(Chat::White, "Your GM flag allows you to always see your targets' buffs.");
-								c->SetEntityVariable(SEE_BUFFS_FLAG, "1");
-							}
-						}
-
-						Send = !clear_target_window;
-					} else if (c->IsRaidGrouped()) {
-						Raid *raid = c->GetRaid();
-						if (raid) {
-							uint32 gid = raid->GetGroup(c);
-							if (gid < MAX_RAID_GROUPS && raid->GroupCount(gid) >= 3) {
-								if (raid->GetLeadershipAA(groupAAInspectBuffs, gid))
-									Send = !clear_target_window;
-							}
-						}
-					} else {
-						Group *group = c->GetGroup();
-						if (group && group->GroupCount() >= 3) {
-							if (group->GetLeadershipAA(groupAAInspectBuffs)) {
-								Send = !clear_target_window;
-							}
-						}
-					}
-				} else {
-					Send = true;
-				}
-			} else if (HoTT && TargetsTarget == sender) {
-				Send = true;
+			// if inspect_buffs is true we're sending a mob's buffs to those with the LAA
+			if (!inspect_buffs || CanInspectTargetBuffs(c) != clear_target_window) {
+				queue(c);
 			}
 		}
 
-		if (Send && (c->ClientVersionBit() & ClientVersionBits)) {
-			c->QueuePacket(app, ackreq);
+		if (!HoTT) {
+			continue;
+		}
+
+		// a client targeting the sender was handled above, even when the sender is its own target
+		for (auto watcher : m->GetTargetedBy()) {
+			if (watcher != sender && watcher->IsClient() && watcher->GetTarget() != sender) {
+				queue(watcher->CastToClient());
+			}
 		}
 	}
 }
@@ -1742,14 +1770,17 @@ void EntityList::QueueCloseClients(
 	}
 
 	float distance_squared = distance * distance;
-	for (auto &e : sender->GetCloseMobList(distance)) {
-		Mob *mob = e.second;
+
+	// encoded once per client version and shared by every recipient on it
+	EQBroadcastPacket broadcast(app, is_ack_required);
+
+	auto queue_to = [&](Mob *mob) {
 		if (!mob) {
-			continue;
+			return;
 		}
 
 		if (!mob->IsClient()) {
-			continue;
+			return;
 		}
 
 		Client *client = mob->CastToClient();
@@ -1757,11 +1788,11 @@ void EntityList::QueueCloseClients(
 		if ((!ignore_sender || client != sender) && (client != skipped_mob)) {
 
 			if (DistanceSquared(client->GetPosition(), sender->GetPosition()) >= distance_squared) {
-				continue;
+				return;
 			}
 
 			if (!client->Connected()) {
-				continue;
+				return;
 			}
 
 			eqFilterMode client_filter = client->GetFilter(filter);
@@ -1771,9 +1802,19 @@ void EntityList::QueueCloseClients(
 				 (sender == client || (client->GetGroup() && client->GetGroup()->IsGroupMember(sender)))) ||
 				(client_filter == FilterShowSelfOnly && client == sender)
 				) {
-				client->QueuePacket(app, is_ack_required, Client::CLIENT_CONNECTED);
+				client->QueuePacket(broadcast, Client::CLIENT_CONNECTED);
 			}
 		}
+	};
+
+	// beyond the close list range we go to the grid rather than walking the whole mob_list
+	if (distance <= RuleI(Range, MobCloseScanDistance)) {
+		for (auto &e : sender->m_close_mobs) {
+			queue_to(e.second);
+		}
+	}
+	else {
+		m_mob_grid.ForEachInRange(sender->GetX(), sender->GetY(), distance, queue_to);
 	}
 }
 
@@ -1783,12 +1824,14 @@ void EntityList::QueueClients(
 	bool ignore_sender, bool ackreq
 )
 {
+	EQBroadcastPacket broadcast(app, ackreq);
+
 	auto it = client_list.begin();
 	while (it != client_list.end()) {
 		Client *ent = it->second;
 
 		if ((!ignore_sender || ent != sender))
-			ent->QueuePacket(app, ackreq, Client::CLIENT_CONNECTED);
+			ent->QueuePacket(broadcast, Client::CLIENT_CONNECTED);
 
 		++it;
 	}
@@ -2654,6 +2697,8 @@ void EntityList::RemoveAllMobs()
 			++it;
 			continue;
 		}
+		m_mob_grid.Remove(it->first);
+		m_wide_aggro_mobs.erase(it->first);
 		safe_delete(it->second);
 		free_ids.push(it->first);
 		it = mob_list.erase(it);
@@ -2800,6 +2845,8 @@ bool EntityList::RemoveMob(uint16 delete_id)
 		else if (client_list.count(delete_id)) {
 			entity_list.RemoveClient(delete_id);
 		}
+		m_mob_grid.Remove(delete_id);
+		m_wide_aggro_mobs.erase(delete_id);
 		safe_delete(it->second);
 		if (!corpse_list.count(delete_id)) {
 			free_ids.push(it->first);
@@ -2910,9 +2957,32 @@ void EntityList::RemoveAuraFromMobs(Mob *aura)
 // All of the above makes a tremendous impact on the bottom line of cpu cycle performance because we run an order of magnitude
 // less checks by focusing our hot path logic down to a very small subset of relevant entities instead of looping an entire
 // entity list (zone wide)
+//
+// Candidates for a scan come from m_mob_grid, a uniform spatial hash with cells sized off Range:MobCloseScanDistance,
+// so a scan only visits the 3x3 block of cells around the scanning mob instead of every mob in the zone. Grid cells are
+// refreshed from MobProcess as entities move; mobs whose aggro range covers the scan distance are tracked separately
+// in m_wide_aggro_mobs since they belong on every close list regardless of where they stand
 
 BenchTimer g_scan_bench_timer;
 
+void EntityList::UpdateMobGrid(uint16 id, Mob *mob)
+{
+	if (!mob) {
+		return;
+	}
+
+	// rule can be reloaded at runtime, re-bins the grid only when it actually changed
+	m_mob_grid.SetCellSize(RuleI(Range, MobCloseScanDistance));
+	m_mob_grid.Update(id, mob, mob->GetX(), mob->GetY());
+
+	if (mob->GetAggroRange() >= RuleI(Range, MobCloseScanDistance)) {
+		m_wide_aggro_mobs[id] = mob;
+	}
+	else if (!m_wide_aggro_mobs.empty()) {
+		m_wide_aggro_mobs.erase(id);
+	}
+}
+
 void EntityList::ScanCloseMobs(Mob *scanning_mob)
 {
 	if (!scanning_mob) {
@@ -2927,30 +2997,38 @@ void EntityList::ScanCloseMobs(Mob *scanning_mob)
 
 	float scan_range = RuleI(Range, MobCloseScanDistance);
 
-	// Reserve memory in m_close_mobs to avoid frequent re-allocations if not already reserved.
-	// Assuming mob_list.size() as an upper bound for reservation.
-	if (scanning_mob->m_close_mobs.bucket_count() < mob_list.size()) {
-		scanning_mob->m_close_mobs.reserve(mob_list.size());
-	}
+	UpdateMobGrid(scanning_mob->GetID(), scanning_mob);
 
 	scanning_mob->m_close_mobs.clear();
 
-	for (auto &e : mob_list) {
-		auto mob = e.second;
+	const auto &scan_position = scanning_mob->GetPosition();
 
-		if (mob && (mob->GetID() <= 0 || mob->IsZoneController())) {
-			continue;
+	auto add_close_mob = [&](Mob *mob) {
+		if (!mob || mob->GetID() <= 0 || mob->IsZoneController()) {
+			return;
+		}
+
+		// add mob to scanning_mob's close list and vice versa
+		// check if the mob is already in the close mobs list before inserting
+		if (mob->m_close_mobs.find(scanning_mob->GetID()) == mob->m_close_mobs.end()) {
+			mob->m_close_mobs[scanning_mob->GetID()] = scanning_mob;
 		}
+		scanning_mob->m_close_mobs[mob->GetID()] = mob;
+	};
 
-		float distance = Distance(scanning_mob->GetPosition(), mob->GetPosition());
-		if (distance <= scan_range || mob->GetAggroRange() >= scan_range) {
-			// add mob to scanning_mob's close list and vice versa
-			// check if the mob is already in the close mobs list before inserting
-			if (mob->m_close_mobs.find(scanning_mob->GetID()) == mob->m_close_mobs.end()) {
-				mob->m_close_mobs[scanning_mob->GetID()] = scanning_mob;
+	m_mob_grid.ForEachInRange(
+		scan_position.x,
+		scan_position.y,
+		scan_range,
+		[&](Mob *mob) {
+			if (mob && Distance(scan_position, mob->GetPosition()) <= scan_range) {
+				add_close_mob(mob);
 			}
-			scanning_mob->m_close_mobs[mob->GetID()] = mob;
 		}
+	);
+
+	for (auto &e : m_wide_aggro_mobs) {
+		add_close_mob(e.second);
 	}
 
 	LogAIScanClose(
@@ -3204,20 +3282,20 @@ void EntityList::SendTraders(Client *client)
 
 void EntityList::RemoveFromHateLists(Mob *mob, bool settoone)
 {
-	auto it = npc_list.begin();
-	while (it != npc_list.end()) {
-		if (it->second->CheckAggro(mob)) {
-			if (!settoone) {
-				it->second->RemoveFromHateList(mob);
-				it->second->RemoveFromRampageList(mob);
-				if (mob->IsClient()) {
-					mob->CastToClient()->RemoveXTarget(it->second, false); // gotta do book keeping
-				}
-			} else {
-				it->second->SetHateAmountOnEnt(mob, 1);
+	for (auto m : mob->GetAggroHolders(AggroHolder::HateList)) {
+		if (!m->IsNPC() || !m->CheckAggro(mob)) {
+			continue;
+		}
+
+		if (!settoone) {
+			m->RemoveFromHateList(mob);
+			m->RemoveFromRampageList(mob);
+			if (mob->IsClient()) {
+				mob->CastToClient()->RemoveXTarget(m, false); // gotta do book keeping
 			}
+		} else {
+			m->SetHateAmountOnEnt(mob, 1);
 		}
-		++it;
 	}
 }
 
@@ -3567,26 +3645,30 @@ void EntityList::ClearAggro(Mob* targ, bool clear_caster_id)
 		c = targ->CastToClient();
 	}
 
-	auto it = npc_list.begin();
-	while (it != npc_list.end()) {
-		if (clear_caster_id) {
-			it->second->BuffDetachCaster(targ);
+	if (clear_caster_id) {
+		for (auto &e : npc_list) {
+			e.second->BuffDetachCaster(targ);
 		}
+	}
 
-		if (it->second->CheckAggro(targ)) {
+	for (auto m : targ->GetAggroHolders()) {
+		if (!m->IsNPC()) {
+			continue;
+		}
+
+		if (m->CheckAggro(targ)) {
 			if (c) {
-				c->RemoveXTarget(it->second, false);
+				c->RemoveXTarget(m, false);
 			}
 
-			it->second->RemoveFromHateList(targ);
-			it->second->RemoveFromRampageList(targ, true);
+			m->RemoveFromHateList(targ);
+			m->RemoveFromRampageList(targ, true);
 		}
 
-		if (c && it->second->IsOnFeignMemory(c)) {
-			it->second->RemoveFromFeignMemory(c); //just in case we feigned
-			c->RemoveXTarget(it->second, false);
+		if (c && m->IsOnFeignMemory(c)) {
+			m->RemoveFromFeignMemory(c); //just in case we feigned
+			c->RemoveXTarget(m, false);
 		}
-		++it;
 	}
 }
 
@@ -3597,80 +3679,79 @@ void EntityList::ClearWaterAggro(Mob* targ)
 	if (targ->IsClient()) {
 		c = targ->CastToClient();
 	}
-	auto it = npc_list.begin();
-	while (it != npc_list.end()) {
-		if (it->second->IsUnderwaterOnly()) {
-			if (it->second->CheckAggro(targ)) {
-				if (c) {
-					c->RemoveXTarget(it->second, false);
-				}
-				it->second->RemoveFromHateList(targ);
-				it->second->RemoveFromRampageList(targ);
-			}
-			if (c && it->second->IsOnFeignMemory(c)) {
-				it->second->RemoveFromFeignMemory(c); //just in case we feigned
-				c->RemoveXTarget(it->second, false);
+
+	for (auto m : targ->GetAggroHolders()) {
+		if (!m->IsNPC() || !m->IsUnderwaterOnly()) {
+			continue;
+		}
+
+		if (m->CheckAggro(targ)) {
+			if (c) {
+				c->RemoveXTarget(m, false);
 			}
+			m->RemoveFromHateList(targ);
+			m->RemoveFromRampageList(targ);
+		}
+		if (c && m->IsOnFeignMemory(c)) {
+			m->RemoveFromFeignMemory(c); //just in case we feigned
+			c->RemoveXTarget(m, false);
 		}
-	++it;
 	}
 }
 
 
 void EntityList::ClearFeignAggro(Mob *targ)
 {
-	auto it = npc_list.begin();
-	while (it != npc_list.end()) {
+	// a copy, AddFeignMemory below moves holders between lists
+	for (auto m : targ->GetAggroHolders()) {
+		if (!m->IsNPC()) {
+			continue;
+		}
+
 		// add Feign Memory check because sometimes weird stuff happens
-		if (it->second->CheckAggro(targ) || (targ->IsClient() && it->second->IsOnFeignMemory(targ))) {
-			if (it->second->GetSpecialAbility(SpecialAbility::FeignDeathImmunity)) {
-				++it;
+		if (m->CheckAggro(targ) || (targ->IsClient() && m->IsOnFeignMemory(targ))) {
+			if (m->GetSpecialAbility(SpecialAbility::FeignDeathImmunity)) {
 				continue;
 			}
 
 			if (targ->IsClient()) {
 				if (parse->PlayerHasQuestSub(EVENT_FEIGN_DEATH)) {
-					std::vector<std::any> args = { it->second };
+					std::vector<std::any> args = { m->CastToNPC() };
 
 					int i = parse->EventPlayer(EVENT_FEIGN_DEATH, targ->CastToClient(), "", 0, &args);
 					if (i != 0) {
-						++it;
 						continue;
 					}
 				}
 
-				if (it->second->IsNPC()) {
-					if (parse->HasQuestSub(it->second->GetNPCTypeID(), EVENT_FEIGN_DEATH)) {
-						int i = parse->EventNPC(EVENT_FEIGN_DEATH, it->second->CastToNPC(), targ, "", 0);
-						if (i != 0) {
-							++it;
-							continue;
-						}
+				if (parse->HasQuestSub(m->GetNPCTypeID(), EVENT_FEIGN_DEATH)) {
+					int i = parse->EventNPC(EVENT_FEIGN_DEATH, m->CastToNPC(), targ, "", 0);
+					if (i != 0) {
+						continue;
 					}
 				}
 			}
 
-			it->second->RemoveFromHateList(targ);
+			m->RemoveFromHateList(targ);
 
-			if (it->second->GetSpecialAbility(SpecialAbility::Rampage)) {
-				it->second->RemoveFromRampageList(targ, true);
+			if (m->GetSpecialAbility(SpecialAbility::Rampage)) {
+				m->RemoveFromRampageList(targ, true);
 			}
 
 			if (targ->IsClient()) {
-				if (it->second->GetLevel() >= 35 && zone->random.Roll(60)) {
-					it->second->AddFeignMemory(targ);
+				if (m->GetLevel() >= 35 && zone->random.Roll(60)) {
+					m->AddFeignMemory(targ);
 				}
 				else {
-					targ->CastToClient()->RemoveXTarget(it->second, false);
+					targ->CastToClient()->RemoveXTarget(m, false);
 				}
 			}
 			else if (targ->IsPet()){
-				if (it->second->GetLevel() >= 35 && zone->random.Roll(60)) {
-					it->second->AddFeignMemory(targ);
+				if (m->GetLevel() >= 35 && zone->random.Roll(60)) {
+					m->AddFeignMemory(targ);
 				}
 			}
 		}
-		++it;
 	}
 }
 
@@ -3865,17 +3946,43 @@ void EntityList::SendAlarm(Trap *trap, Mob *currenttarget, uint8 kos)
 	}
 }
 
-void EntityList::AddProximity(NPC *proximity_for)
+void EntityList::AddProximity(
+	NPC *proximity_for,
+	float min_x,
+	float max_x,
+	float min_y,
+	float max_y,
+	float min_z,
+	float max_z,
+	bool say
+)
 {
 	RemoveProximity(proximity_for->GetID());
 
 	proximity_list.push_back(proximity_for);
 
-	proximity_for->proximity = new NPCProximity; // deleted in NPC::~NPC
+	if (!proximity_for->proximity) {
+		proximity_for->proximity = new NPCProximity; // deleted in NPC::~NPC
+	}
+
+	auto p = proximity_for->proximity;
+
+	p->min_x         = min_x;
+	p->max_x         = max_x;
+	p->min_y         = min_y;
+	p->max_y         = max_y;
+	p->min_z         = min_z;
+	p->max_z         = max_z;
+	p->say           = say;
+	p->proximity_set = true;
+
+	m_proximity_grid.Add(proximity_for->GetID(), 0, min_x, max_x, min_y, max_y, min_z, max_z);
 }
 
 bool EntityList::RemoveProximity(uint16 delete_npc_id)
 {
+	m_proximity_grid.Remove(delete_npc_id);
+
 	auto it = std::find_if(proximity_list.begin(), proximity_list.end(),
 			[delete_npc_id](const NPC *a) { return a->GetID() == delete_npc_id; });
 	if (it == proximity_list.end())
@@ -3888,6 +3995,7 @@ bool EntityList::RemoveProximity(uint16 delete_npc_id)
 void EntityList::RemoveAllLocalities()
 {
 	proximity_list.clear();
+	m_proximity_grid.Clear();
 }
 
 struct quest_proximity_event {
@@ -3896,91 +4004,63 @@ struct quest_proximity_event {
 	NPC *npc;
 	int area_id;
 	int area_type;
+	uint32 sequence;
 };
 
+// events fire in the order their boxes were added, same as the old list walks
+static void SortProximityEvents(std::vector<quest_proximity_event> &events, size_t first)
+{
+	if (events.size() - first > 1) {
+		std::sort(
+			events.begin() + first,
+			events.end(),
+			[](const quest_proximity_event &a, const quest_proximity_event &b) { return a.sequence < b.sequence; }
+		);
+	}
+}
+
 void EntityList::ProcessMove(Client *c, const glm::vec3& location)
 {
-	float last_x = c->ProximityX();
-	float last_y = c->ProximityY();
-	float last_z = c->ProximityZ();
+	const glm::vec3 last(c->ProximityX(), c->ProximityY(), c->ProximityZ());
 
-	std::list<quest_proximity_event> events;
-	for (auto iter = proximity_list.begin(); iter != proximity_list.end(); ++iter) {
-		NPC *d = (*iter);
-		NPCProximity *l = d->proximity;
-		if (l == nullptr)
-			continue;
+	// only the boxes around the old and new positions are tested, nothing is allocated unless a boundary was crossed
+	std::vector<quest_proximity_event> events;
 
-		//check both bounding boxes, if either coords pairs
-		//cross a boundary, send the event.
-		bool old_in = true;
-		bool new_in = true;
-		if (last_x < l->min_x || last_x > l->max_x ||
-				last_y < l->min_y || last_y > l->max_y ||
-				last_z < l->min_z || last_z > l->max_z) {
-			old_in = false;
-		}
-		if (location.x < l->min_x || location.x > l->max_x ||
-				location.y < l->min_y || location.y > l->max_y ||
-				location.z < l->min_z || location.z > l->max_z) {
-			new_in = false;
-		}
-
-		if (old_in && !new_in) {
-			quest_proximity_event evt;
-			evt.event_id = EVENT_EXIT;
-			evt.client = c;
-			evt.npc = d;
-			evt.area_id = 0;
-			evt.area_type = 0;
-			events.push_back(evt);
-		} else if (new_in && !old_in) {
-			quest_proximity_event evt;
-			evt.event_id = EVENT_ENTER;
-			evt.client = c;
-			evt.npc = d;
-			evt.area_id = 0;
-			evt.area_type = 0;
-			events.push_back(evt);
-		}
-	}
-
-	for (auto iter = area_list.begin(); iter != area_list.end(); ++iter) {
-		Area& a = (*iter);
-		bool old_in = true;
-		bool new_in = true;
-		if (last_x < a.min_x || last_x > a.max_x ||
-				last_y < a.min_y || last_y > a.max_y ||
-				last_z < a.min_z || last_z > a.max_z) {
-			old_in = false;
-		}
-
-		if (location.x < a.min_x || location.x > a.max_x ||
-				location.y < a.min_y || location.y > a.max_y ||
-				location.z < a.min_z || location.z > a.max_z ) {
-			new_in = false;
-		}
-
-		if (old_in && !new_in) {
-			//were in but are no longer.
-			quest_proximity_event evt;
-			evt.event_id = EVENT_LEAVE_AREA;
-			evt.client = c;
-			evt.npc = nullptr;
-			evt.area_id = a.id;
-			evt.area_type = a.type;
-			events.push_back(evt);
-		} else if (!old_in && new_in) {
-			//were not in but now are
-			quest_proximity_event evt;
-			evt.event_id = EVENT_ENTER_AREA;
-			evt.client = c;
-			evt.npc = nullptr;
-			evt.area_id = a.id;
-			evt.area_type = a.type;
-			events.push_back(evt);
+	m_proximity_grid.ForEachCrossed(
+		last,
+		location,
+		[&](const TriggerGrid::Box &b, bool entered) {
+			NPC *n = GetNPCByID(b.id);
+			if (!n || !n->proximity) {
+				return;
+			}
+
+			events.push_back(quest_proximity_event{entered ? EVENT_ENTER : EVENT_EXIT, c, n, 0, 0, b.sequence});
 		}
-	}
+	);
+
+	SortProximityEvents(events, 0);
+
+	const size_t area_events = events.size();
+
+	m_area_grid.ForEachCrossed(
+		last,
+		location,
+		[&](const TriggerGrid::Box &b, bool entered) {
+			events.push_back(
+				quest_proximity_event{
+					entered ? EVENT_ENTER_AREA : EVENT_LEAVE_AREA,
+					c,
+					nullptr,
+					b.id,
+					b.type,
+					b.sequence
+				}
+			);
+		}
+	);
+
+	SortProximityEvents(events, area_events);
 
 	for (auto iter = events.begin(); iter != events.end(); ++iter) {
 		quest_proximity_event& evt = (*iter);
@@ -4028,52 +4108,26 @@ void EntityList::ProcessMove(Client *c, const glm::vec3& location)
 }
 
 void EntityList::ProcessMove(NPC *n, float x, float y, float z) {
-	float last_x = n->GetX();
-	float last_y = n->GetY();
-	float last_z = n->GetZ();
-
-	std::list<quest_proximity_event> events;
-
-	for (const auto& a : area_list) {
-		bool old_in = true;
-		bool new_in = true;
-		if (
-			!EQ::ValueWithin(last_x, a.min_x, a.max_x) ||
-			!EQ::ValueWithin(last_y, a.min_y, a.max_y) ||
-			!EQ::ValueWithin(last_z, a.min_z, a.max_z)
-		) {
-			old_in = false;
+	std::vector<quest_proximity_event> events;
+
+	m_area_grid.ForEachCrossed(
+		glm::vec3(n->GetX(), n->GetY(), n->GetZ()),
+		glm::vec3(x, y, z),
+		[&](const TriggerGrid::Box &b, bool entered) {
+			events.push_back(
+				quest_proximity_event{
+					entered ? EVENT_ENTER_AREA : EVENT_LEAVE_AREA,
+					nullptr,
+					n,
+					b.id,
+					b.type,
+					b.sequence
+				}
+			);
 		}
+	);
 
-		if (
-			!EQ::ValueWithin(x, a.min_x, a.max_x) ||
-			!EQ::ValueWithin(y, a.min_y, a.max_y) ||
-			!EQ::ValueWithin(z, a.min_z, a.max_z)
-		) {
-			new_in = false;
-		}
-
-		if (old_in && !new_in) {
-			//were in but are no longer.
-			quest_proximity_event evt;
-			evt.event_id  = EVENT_LEAVE_AREA;
-			evt.client    = nullptr;
-			evt.npc       = n;
-			evt.area_id   = a.id;
-			evt.area_type = a.type;
-			events.emplace_back(evt);
-		}
-		else if (!old_in && new_in) {
-			//were not in but now are
-			quest_proximity_event evt;
-			evt.event_id  = EVENT_ENTER_AREA;
-			evt.client    = nullptr;
-			evt.npc       = n;
-			evt.area_id   = a.id;
-			evt.area_type = a.type;
-			events.emplace_back(evt);
-		}
-	}
+	SortProximityEvents(events, 0);
 
 	for (const auto& evt : events) {
 		std::vector<std::any> args = { &evt.area_id, &evt.area_type };
@@ -4130,10 +4184,13 @@ void EntityList::AddArea(int id, int type, float min_x, float max_x, float min_y
 	}
 
 	area_list.push_back(a);
+	m_area_grid.Add(a.id, a.type, a.min_x, a.max_x, a.min_y, a.max_y, a.min_z, a.max_z);
 }
 
 void EntityList::RemoveArea(int id)
 {
+	m_area_grid.Remove(id);
+
 	auto it = std::find_if(area_list.begin(), area_list.end(),
 			[id](const Area &a) { return a.id == id; });
 	if (it == area_list.end())
@@ -4145,6 +4202,7 @@ void EntityList::RemoveArea(int id)
 void EntityList::ClearAreas()
 {
 	area_list.clear();
+	m_area_grid.Clear();
 }
 
 void EntityList::ProcessProximitySay(const char *message, Client *c, uint8 language)
@@ -4322,18 +4380,19 @@ bool EntityList::LimitCheckName(const char *npc_name)
 
 void EntityList::UpdateHoTT(Mob *target)
 {
-	auto it = client_list.begin();
-	while (it != client_list.end()) {
-		Client *c = it->second;
-		if (c->GetTarget() == target) {
-			if (target->GetTarget())
-				c->SetHoTT(target->GetTarget()->GetID());
-			else
-				c->SetHoTT(0);
+	for (auto m : target->GetTargetedBy()) {
+		if (!m->IsClient()) {
+			continue;
+		}
 
-			c->UpdateXTargetType(TargetsTarget, target->GetTarget());
+		Client *c = m->CastToClient();
+		if (target->GetTarget()) {
+			c->SetHoTT(target->GetTarget()->GetID());
+		} else {
+			c->SetHoTT(0);
 		}
-		++it;
+
+		c->UpdateXTargetType(TargetsTarget, target->GetTarget());
 	}
 }
 
@@ -18,6 +18,7 @@
 #ifndef ENTITY_H
 #define ENTITY_H
 
+#include <functional>
 #include <unordered_map>
 #include <queue>
 
@@ -29,6 +30,8 @@
 #include "../common/emu_constants.h"
 
 #include "position.h"
+#include "mob_grid.h"
+#include "trigger_grid.h"
 #include "zonedump.h"
 #include "common.h"
 
@@ -297,7 +300,7 @@ public:
 	void	AddTrap(Trap* trap);
 	void	AddBeacon(Beacon *beacon);
 	void	AddEncounter(Encounter *encounter);
-	void	AddProximity(NPC *proximity_for);
+	void	AddProximity(NPC *proximity_for, float min_x, float max_x, float min_y, float max_y, float min_z, float max_z, bool say);
 	void	Clear();
 	bool	RemoveMob(uint16 delete_id);
 	bool	RemoveClient(uint16 delete_id);
@@ -559,6 +562,7 @@ public:
 	inline const std::unordered_map<uint16, Doors *> &GetDoorsList() { return door_list; }
 
 	std::unordered_map<uint16, Mob *> &GetCloseMobList(Mob *mob, float distance = 0.0f);
+	inline const MobGrid &GetMobGrid() const { return m_mob_grid; }
 
 	std::vector<NPC*> GetNPCsByIDs(std::vector<uint32> npc_ids);
 	std::vector<NPC*> GetExcludedNPCsByIDs(std::vector<uint32> npc_ids);
@@ -570,6 +574,7 @@ public:
 	void RefreshClientXTargets(Client *c);
 	void SendAlternateAdvancementStats();
 	void ScanCloseMobs(Mob *scanning_mob);
+	void UpdateMobGrid(uint16 id, Mob *mob);
 
 	void GetTrapInfo(Client* c);
 	bool IsTrapGroupSpawned(uint32 trap_id, uint8 group);
@@ -590,6 +595,7 @@ protected:
 private:
 	void	AddToSpawnQueue(uint16 entityid, NewSpawn_Struct** app);
 	void	CheckSpawnQueue();
+	void	RemoveFromTargetsWhere(Mob *mob, bool RemoveFromXTargets, const std::function<bool(Mob *)> &affected);
 
 	//used for limiting spawns
 	class SpawnLimitRecord { public: uint32 spawngroup_id; uint32 npc_type; };
@@ -615,6 +621,14 @@ private:
 	std::list<Area> area_list;
 	std::queue<uint16> free_ids;
 
+	// spatial index over mob_list, see EntityList::ScanCloseMobs
+	MobGrid                           m_mob_grid;
+	std::unordered_map<uint16, Mob *> m_wide_aggro_mobs;
+
+	// proximity boxes keyed by npc entity id and quest areas keyed by area id, see EntityList::ProcessMove
+	TriggerGrid m_proximity_grid;
+	TriggerGrid m_area_grid;
+
 	Timer object_timer;
 	Timer door_timer;
 	Timer corpse_timer;
@@ -971,6 +971,7 @@ void Client::SetLevel(uint8 set_level, bool command)
 
 	LogInfo("Setting Level for [{}] to [{}]", GetName(), set_level);
 
+	SetBonusesDirty();
 	CalcBonuses();
 
 	if (!RuleB(Character, HealOnLevel)) {
@@ -90,6 +90,7 @@ void command_rules(Client *c, const Seperator *sep)
 		);
 	} else if (is_reload) {
 		RuleManager::Instance()->LoadRules(&database, RuleManager::Instance()->GetActiveRuleset(), true);
+		Mob::InvalidateAllBonusLayers();
 		c->Message(
 			Chat::White,
 			fmt::format(
@@ -118,6 +119,7 @@ void command_rules(Client *c, const Seperator *sep)
 		}
 
 		RuleManager::Instance()->LoadRules(&database, sep->arg[2], true);
+		Mob::InvalidateAllBonusLayers();
 
 		c->Message(
 			Chat::White,
@@ -139,6 +141,7 @@ void command_rules(Client *c, const Seperator *sep)
 		}
 
 		RuleManager::Instance()->LoadRules(&database, sep->arg[2], true);
+		Mob::InvalidateAllBonusLayers();
 		c->Message(
 			Chat::White,
 			fmt::format(
@@ -184,6 +187,7 @@ void command_rules(Client *c, const Seperator *sep)
 		}
 	} else if (is_reset) {
 		RuleManager::Instance()->ResetRules(true);
+		Mob::InvalidateAllBonusLayers();
 		c->Message(
 			Chat::White,
 			fmt::format(
@@ -229,6 +233,8 @@ void command_rules(Client *c, const Seperator *sep)
 					).c_str()
 				);
 			} else {
+				// same as the world reload path, cached bonus layers may depend on the rule
+				Mob::InvalidateAllBonusLayers();
 				c->Message(
 					Chat::White,
 					fmt::format(
@@ -254,6 +260,7 @@ void command_rules(Client *c, const Seperator *sep)
 					).c_str()
 				);
 			} else {
+				Mob::InvalidateAllBonusLayers();
 				c->Message(
 					Chat::White,
 					fmt::format(
@@ -29,7 +29,9 @@
 #include "show/proximity.cpp"
 #include "show/quest_errors.cpp"
 #include "show/quest_globals.cpp"
+#include "show/quest_stats.cpp"
 #include "show/recipe.cpp"
+#include "show/save_queue.cpp"
 #include "show/server_info.cpp"
 #include "show/skills.cpp"
 #include "show/spawn_status.cpp"
@@ -37,6 +39,7 @@
 #include "show/spells.cpp"
 #include "show/spells_list.cpp"
 #include "show/stats.cpp"
+#include "show/timer_wheel.cpp"
 #include "show/timers.cpp"
 #include "show/traps.cpp"
 #include "show/uptime.cpp"
@@ -92,7 +95,9 @@ void command_show(Client *c, const Seperator *sep)
 		Cmd{.cmd = "proximity", .u = "proximity", .fn = ShowProximity, .a = {"#proximity"}},
 		Cmd{.cmd = "quest_errors", .u = "quest_errors", .fn = ShowQuestErrors, .a = {"#questerrors"}},
 		Cmd{.cmd = "quest_globals", .u = "quest_globals", .fn = ShowQuestGlobals, .a = {"#globalview"}},
+		Cmd{.cmd = "quest_stats", .u = "quest_stats [reset|Amount] (Amount defaults to 10)", .fn = ShowQuestStats},
 		Cmd{.cmd = "recipe", .u = "recipe [Recipe ID]", .fn = ShowRecipe, .a = {"#viewrecipe"}},
+		Cmd{.cmd = "save_queue", .u = "save_queue", .fn = ShowSaveQueue},
 		Cmd{.cmd = "server_info", .u = "server_info", .fn = ShowServerInfo, .a = {"#serverinfo"}},
 		Cmd{.cmd = "skills", .u = "skills", .fn = ShowSkills, .a = {"#showskills"}},
 		Cmd{.cmd = "spawn_status", .u = "spawn_status [all|disabled|enabled|Spawn ID]", .fn = ShowSpawnStatus, .a = {"#spawnstatus"}},
@@ -100,6 +105,7 @@ void command_show(Client *c, const Seperator *sep)
 		Cmd{.cmd = "spells", .u = "spells [disciplines|spells]", .fn = ShowSpells, .a = {"#showspells"}},
 		Cmd{.cmd = "spells_list", .u = "spells_list", .fn = ShowSpellsList, .a = {"#showspellslist"}},
 		Cmd{.cmd = "stats", .u = "stats", .fn = ShowStats, .a = {"#showstats"}},
+		Cmd{.cmd = "timer_wheel", .u = "timer_wheel", .fn = ShowTimerWheel},
 		Cmd{.cmd = "timers", .u = "timers", .fn = ShowTimers, .a = {"#timers"}},
 		Cmd{.cmd = "traps", .u = "traps", .fn = ShowTraps, .a = {"#trapinfo"}},
 		Cmd{.cmd = "uptime", .u = "uptime [Zone Server ID] (Zone Server ID is optional)", .fn = ShowUptime, .a = {"#uptime"}},
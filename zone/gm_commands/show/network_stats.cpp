@@ -65,6 +65,38 @@ void ShowNetworkStats(Client *c, const Seperator *sep)
 		)
 	);
 
+	popup_table += DialogueWindow::TableRow(
+		DialogueWindow::TableCell("Compressed Packets") +
+		DialogueWindow::TableCell(Strings::Commify(stats.compressed_packets)) +
+		DialogueWindow::TableCell("Sent Stored") +
+		DialogueWindow::TableCell(Strings::Commify(stats.compress_skipped))
+	);
+
+	popup_table += DialogueWindow::TableRow(
+		DialogueWindow::TableCell("Compression Saved Bytes") +
+		DialogueWindow::TableCell(
+			fmt::format(
+				"{} of {}",
+				Strings::Commify(stats.compress_bytes_saved),
+				Strings::Commify(stats.compress_bytes_in)
+			)
+		) +
+		DialogueWindow::TableCell("Saved Per CPU ms") +
+		DialogueWindow::TableCell(
+			fmt::format(
+				"{:.0f}",
+				stats.compress_ns ? stats.compress_bytes_saved / (stats.compress_ns / 1000000.0) : 0.0
+			)
+		)
+	);
+
+	popup_table += DialogueWindow::TableRow(
+		DialogueWindow::TableCell("Compress Time") +
+		DialogueWindow::TableCell(fmt::format("{:.2f} ms", stats.compress_ns / 1000000.0)) +
+		DialogueWindow::TableCell("Decompress Time") +
+		DialogueWindow::TableCell(fmt::format("{:.2f} ms", stats.decompress_ns / 1000000.0))
+	);
+
 	popup_table += DialogueWindow::Break(2);
 
 	popup_table += DialogueWindow::TableRow(
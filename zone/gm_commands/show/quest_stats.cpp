@@ -0,0 +1,75 @@
+#include "../../client.h"
+#include "../../quest_parser_collection.h"
+
+#ifdef LUA_EQEMU
+extern const char *LuaEvents[_LargestEventID];
+#endif
+
+void ShowQuestStats(Client *c, const Seperator *sep)
+{
+	if (sep->argnum >= 2 && !strcasecmp(sep->arg[2], "reset")) {
+		parse->ResetEventStats();
+		c->Message(Chat::White, "Quest event stats have been reset.");
+		return;
+	}
+
+	const uint32 limit = sep->IsNumber(2) ? Strings::ToUnsignedInt(sep->arg[2]) : 10;
+
+	const auto &stats = parse->GetEventStats();
+
+	std::vector<int> events;
+	for (int i = 0; i < _LargestEventID; i++) {
+		if (stats[i].calls) {
+			events.push_back(i);
+		}
+	}
+
+	if (events.empty()) {
+		c->Message(Chat::White, "No quest events have been dispatched since the last reset.");
+		return;
+	}
+
+	std::sort(
+		events.begin(),
+		events.end(),
+		[&](int a, int b) { return stats[a].total_ns > stats[b].total_ns; }
+	);
+
+	c->Message(
+		Chat::White,
+		fmt::format(
+			"Quest events by total time, showing {} of {} | Buckets: <1us <10us <100us <1ms <10ms 10ms+",
+			std::min(static_cast<size_t>(limit), events.size()),
+			events.size()
+		).c_str()
+	);
+
+	uint32 shown = 0;
+	for (const auto &e : events) {
+		if (shown++ >= limit) {
+			break;
+		}
+
+		const auto &s = stats[e];
+
+		std::string name = std::to_string(e);
+#ifdef LUA_EQEMU
+		if (LuaEvents[e]) {
+			name = LuaEvents[e];
+		}
+#endif
+
+		c->Message(
+			Chat::White,
+			fmt::format(
+				"{} | Calls: {} Total: {:.2f} ms Average: {:.2f} us Max: {:.2f} us | {}",
+				name,
+				Strings::Commify(s.calls),
+				s.total_ns / 1000000.0,
+				s.total_ns / 1000.0 / s.calls,
+				s.max_ns / 1000.0,
+				fmt::join(s.buckets, " ")
+			).c_str()
+		);
+	}
+}
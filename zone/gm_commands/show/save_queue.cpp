@@ -0,0 +1,37 @@
+#include "../../client.h"
+#include "../../character_save_queue.h"
+
+void ShowSaveQueue(Client *c, const Seperator *sep)
+{
+	auto save_queue = CharacterSaveQueue::Instance();
+	if (!save_queue->IsRunning()) {
+		c->Message(Chat::White, "Character save worker is not running, saves are written synchronously.");
+		return;
+	}
+
+	const auto s = save_queue->GetStats();
+
+	c->Message(
+		Chat::White,
+		fmt::format(
+			"Save Queue | Depth: {} Queued: {} Coalesced: {} Written: {} Failed: {} Dropped: {}",
+			Strings::Commify(static_cast<uint64>(s.queue_depth)),
+			Strings::Commify(s.queued),
+			Strings::Commify(s.coalesced),
+			Strings::Commify(s.written),
+			Strings::Commify(s.failed),
+			Strings::Commify(s.dropped)
+		).c_str()
+	);
+
+	c->Message(
+		Chat::White,
+		fmt::format(
+			"Save Latency | Last: {:.2f}ms Average: {:.2f}ms Max: {:.2f}ms Average Write: {:.2f}ms",
+			s.last_latency_ms,
+			s.average_latency_ms,
+			s.max_latency_ms,
+			s.average_write_ms
+		).c_str()
+	);
+}
@@ -0,0 +1,29 @@
+#include "../../client.h"
+#include "../../../common/timer_wheel.h"
+
+void ShowTimerWheel(Client *c, const Seperator *sep)
+{
+	const auto s = TimerWheel::Instance()->GetStats();
+
+	c->Message(
+		Chat::White,
+		fmt::format(
+			"Timer Wheel | Registered: {} Scheduled: {} Fired: {} (Last Tick: {})",
+			Strings::Commify(static_cast<uint64>(s.registered)),
+			Strings::Commify(static_cast<uint64>(s.scheduled)),
+			Strings::Commify(s.fired),
+			s.last_tick_fired
+		).c_str()
+	);
+
+	c->Message(
+		Chat::White,
+		fmt::format(
+			"Timer Checks Per Tick | Last: {} Average: {:.2f} Max: {} over {} ticks",
+			Strings::Commify(s.last_tick_checks),
+			s.average_tick_checks,
+			Strings::Commify(s.max_tick_checks),
+			Strings::Commify(s.ticks)
+		).c_str()
+	);
+}
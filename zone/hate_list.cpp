@@ -29,7 +29,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 #include "zone.h"
 #include "water_map.h"
 
-#include <list>
+#include <vector>
 
 extern Zone *zone;
 
@@ -40,12 +40,38 @@ HateList::HateList()
 
 HateList::~HateList()
 {
+	for (auto e : list) {
+		delete e;
+	}
+}
+
+// quest events fired from here can add to the list, so callers walk it by position rather than by iterator
+void HateList::EraseEntry(size_t position)
+{
+	struct_HateList *e = list[position];
+
+	if (e->entity_on_hatelist) {
+		m_positions.erase(e->entity_on_hatelist);
+
+		if (hate_owner) {
+			e->entity_on_hatelist->RemoveAggroHolder(hate_owner, AggroHolder::HateList);
+		}
+	}
+
+	list.erase(list.begin() + position);
+	for (size_t i = position; i < list.size(); ++i) {
+		if (list[i]->entity_on_hatelist) {
+			m_positions[list[i]->entity_on_hatelist] = i;
+		}
+	}
+
+	delete e;
 }
 
 void HateList::WipeHateList(bool npc_only) {
-	auto iterator = list.begin();
-	while (iterator != list.end()) {
-		Mob *m = (*iterator)->entity_on_hatelist;
+	size_t i = 0;
+	while (i < list.size()) {
+		Mob *m = list[i]->entity_on_hatelist;
 		if (
 			m &&
 			(
@@ -54,7 +80,7 @@ void HateList::WipeHateList(bool npc_only) {
 			) &&
 			npc_only
 		) {
-			iterator++;
+			i++;
 		} else {
 			if (m) {
 				if (parse->HasQuestSub(hate_owner->GetNPCTypeID(), EVENT_HATE_LIST)) {
@@ -66,8 +92,12 @@ void HateList::WipeHateList(bool npc_only) {
 					m->CastToClient()->RemoveXTarget(hate_owner, true);
 				}
 
-				delete (*iterator);
-				iterator = list.erase(iterator);
+				// the event may have moved things around
+				if (i < list.size() && list[i]->entity_on_hatelist == m) {
+					EraseEntry(i);
+				}
+			} else {
+				i++;
 			}
 		}
 	}
@@ -84,13 +114,12 @@ struct_HateList* HateList::Find(Mob* m)
 		return nullptr;
 	}
 
-	for (auto e : list) {
-		if (e->entity_on_hatelist && e->entity_on_hatelist == m) {
-			return e;
-		}
+	auto it = m_positions.find(m);
+	if (it == m_positions.end()) {
+		return nullptr;
 	}
 
-	return nullptr;
+	return list[it->second];
 }
 
 void HateList::SetHateAmountOnEnt(Mob* other, int64 in_hate, uint64 in_damage)
@@ -242,8 +271,13 @@ void HateList::AddEntToHateList(Mob *in_entity, int64 in_hate, int64 in_damage,
 		entity->is_entity_frenzy = in_is_entity_frenzied;
 		entity->oor_count = 0;
 		entity->last_modified = Timer::GetCurrentTime();
+		m_positions[in_entity] = list.size();
 		list.push_back(entity);
 
+		if (hate_owner) {
+			in_entity->AddAggroHolder(hate_owner, AggroHolder::HateList);
+		}
+
 		if (parse->HasQuestSub(hate_owner->GetNPCTypeID(), EVENT_HATE_LIST)) {
 			parse->EventNPC(EVENT_HATE_LIST, hate_owner->CastToNPC(), in_entity, "1", 0);
 		}
@@ -260,30 +294,22 @@ bool HateList::RemoveEntFromHateList(Mob *in_entity)
 		return false;
 	}
 
-	bool is_found = false;
-	auto iterator = list.begin();
-
-	while (iterator != list.end()) {
-		if ((*iterator)->entity_on_hatelist == in_entity) {
-			is_found = true;
+	auto it = m_positions.find(in_entity);
+	if (it == m_positions.end()) {
+		return false;
+	}
 
-			if (in_entity && in_entity->IsClient()) {
-				in_entity->CastToClient()->DecrementAggroCount();
-			}
+	if (in_entity->IsClient()) {
+		in_entity->CastToClient()->DecrementAggroCount();
+	}
 
-			delete (*iterator);
-			iterator = list.erase(iterator);
+	EraseEntry(it->second);
 
-			if (in_entity) {
-				if (parse->HasQuestSub(hate_owner->GetNPCTypeID(), EVENT_HATE_LIST)) {
-					parse->EventNPC(EVENT_HATE_LIST, hate_owner->CastToNPC(), in_entity, "0", 0);
-				}
-			}
-		} else {
-			++iterator;
-		}
+	if (parse->HasQuestSub(hate_owner->GetNPCTypeID(), EVENT_HATE_LIST)) {
+		parse->EventNPC(EVENT_HATE_LIST, hate_owner->CastToNPC(), in_entity, "0", 0);
 	}
-	return is_found;
+
+	return true;
 }
 
 // so if faction_id and faction_value are set, we do RewardFaction, otherwise old stuff
@@ -816,7 +842,7 @@ void HateList::SpellCast(Mob *caster, uint32 spell_id, float range, Mob* ae_cent
 	//crashes when people kick the bucket in the middle of this call
 	//that invalidates our iterator but there's no way to know sadly
 	//So keep a list of entity ids and look up after
-	std::list<uint32> id_list;
+	std::vector<uint32> id_list;
 	range = range * range;
 	float min_range2 = spells[spell_id].min_range * spells[spell_id].min_range;
 	float dist_targ = 0;
@@ -855,28 +881,28 @@ void HateList::SpellCast(Mob *caster, uint32 spell_id, float range, Mob* ae_cent
 
 void HateList::RemoveStaleEntries(int time_ms, float dist)
 {
-	auto it = list.begin();
-
 	auto cur_time = Timer::GetCurrentTime();
 
 	auto dist2 = dist * dist;
 
-	while (it != list.end()) {
-		auto m = (*it)->entity_on_hatelist;
+	size_t i = 0;
+	while (i < list.size()) {
+		auto e = list[i];
+		auto m = e->entity_on_hatelist;
 		if (m) {
 			bool remove = false;
 
-			if (cur_time - (*it)->last_modified > time_ms) {
+			if (cur_time - e->last_modified > time_ms) {
 				remove = true;
 			}
 
 			if (!remove && DistanceSquaredNoZ(hate_owner->GetPosition(), m->GetPosition()) > dist2) {
-				(*it)->oor_count++;
-				if ((*it)->oor_count == 2) {
+				e->oor_count++;
+				if (e->oor_count == 2) {
 					remove = true;
 				}
-			} else if ((*it)->oor_count != 0) {
-				(*it)->oor_count = 0;
+			} else if (e->oor_count != 0) {
+				e->oor_count = 0;
 			}
 
 			if (remove) {
@@ -889,12 +915,13 @@ void HateList::RemoveStaleEntries(int time_ms, float dist)
 					m->CastToClient()->RemoveXTarget(hate_owner, true);
 				}
 
-				delete (*it);
-				it = list.erase(it);
-				continue;
+				if (i < list.size() && list[i] == e) {
+					EraseEntry(i);
+					continue;
+				}
 			}
 		}
-		++it;
+		++i;
 	}
 }
 
@@ -917,9 +944,10 @@ void HateList::DamageHateList(int64 damage, uint32 distance, EntityFilterType fi
 	}
 }
 
-std::list<struct_HateList*> HateList::GetFilteredHateList(EntityFilterType filter_type, uint32 distance)
+std::vector<struct_HateList*> HateList::GetFilteredHateList(EntityFilterType filter_type, uint32 distance)
 {
-	std::list<struct_HateList*> l;
+	std::vector<struct_HateList*> l;
+	l.reserve(list.size());
 	const auto squared_distance = (distance * distance);
 	for (auto h : list) {
 		auto e = h->entity_on_hatelist;
@@ -21,6 +21,9 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 
 #include "../common/emu_constants.h"
 
+#include <unordered_map>
+#include <vector>
+
 class Client;
 class Group;
 class Mob;
@@ -36,6 +39,14 @@ struct struct_HateList {
 	uint32 last_modified; // we need to remove this if it gets higher than 10 mins
 };
 
+// what a holder keeps the mob on, for the reverse index each Mob carries (see Mob::GetAggroHolders)
+namespace AggroHolder {
+	constexpr uint8 HateList    = (1 << 0);
+	constexpr uint8 Rampage     = (1 << 1);
+	constexpr uint8 FeignMemory = (1 << 2);
+	constexpr uint8 All         = (HateList | Rampage | FeignMemory);
+}
+
 enum class HateListCountType {
 	Bot    = 0,
 	Client = 1,
@@ -66,9 +77,9 @@ public:
 
 	int64 GetEntHateAmount(Mob *ent, bool in_damage = false);
 
-	std::list<struct_HateList *> &GetHateList() { return list; }
+	std::vector<struct_HateList *> &GetHateList() { return list; }
 
-	std::list<struct_HateList *> GetFilteredHateList(
+	std::vector<struct_HateList *> GetFilteredHateList(
 		EntityFilterType filter_type = EntityFilterType::All,
 		uint32 distance = 0
 	);
@@ -99,8 +110,12 @@ public:
 protected:
 	struct_HateList* Find(Mob* m);
 private:
-	std::list<struct_HateList *> list;
-	Mob                          *hate_owner;
+	void EraseEntry(size_t position);
+
+	// entries stay in insertion order, ties in the top hate scans go to whoever got on the list first
+	std::vector<struct_HateList *>          list;
+	std::unordered_map<const Mob *, size_t> m_positions;
+	Mob                                     *hate_owner;
 };
 
 #endif
@@ -923,7 +923,9 @@ std::string lua_say_link(std::string text, bool silent, std::string link_name) {
 }
 
 void lua_set_rule(std::string rule_name, std::string rule_value) {
-	RuleManager::Instance()->SetRule(rule_name, rule_value);
+	if (RuleManager::Instance()->SetRule(rule_name, rule_value)) {
+		Mob::InvalidateAllBonusLayers();
+	}
 }
 
 std::string lua_get_rule(std::string rule_name) {
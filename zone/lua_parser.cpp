@@ -212,6 +212,40 @@ static void PushErrorHandler(lua_State* L)
 	lua_remove(L, -2);
 }
 
+static constexpr int MAX_SELF_WRAPPER_CACHE = 4096;
+
+// pushes the script side wrapper for self, reusing the one made for the same entity on an earlier event. wrappers only
+// hold the pointer, so one that outlives its entity is simply rebuilt for whatever gets allocated at that address
+template<typename W, typename T>
+static void PushSelfWrapper(lua_State *L, const char *cache_name, T *self, int &cache_size)
+{
+	lua_getfield(L, LUA_REGISTRYINDEX, cache_name);
+	if (!lua_istable(L, -1) || cache_size >= MAX_SELF_WRAPPER_CACHE) {
+		lua_pop(L, 1);
+		lua_createtable(L, 0, 64);
+		lua_pushvalue(L, -1);
+		lua_setfield(L, LUA_REGISTRYINDEX, cache_name);
+		cache_size = 0;
+	}
+
+	lua_pushlightuserdata(L, self);
+	lua_rawget(L, -2);
+	if (lua_isnil(L, -1)) {
+		lua_pop(L, 1);
+
+		luabind::adl::object o = luabind::adl::object(L, W(self));
+		lua_pushlightuserdata(L, self);
+		o.push(L);
+		lua_rawset(L, -3);
+
+		lua_pushlightuserdata(L, self);
+		lua_rawget(L, -2);
+		cache_size++;
+	}
+
+	lua_remove(L, -2);
+}
+
 LuaParser::LuaParser() {
 	for (int i = 0; i < _LargestEventID; ++i) {
 		NPCArgumentDispatch[i]       = handle_npc_null;
@@ -239,7 +273,7 @@ LuaParser::LuaParser() {
 	NPCArgumentDispatch[EVENT_WAYPOINT_ARRIVE]        = handle_npc_waypoint;
 	NPCArgumentDispatch[EVENT_WAYPOINT_DEPART]        = handle_npc_waypoint;
 	NPCArgumentDispatch[EVENT_HATE_LIST]              = handle_npc_hate;
-	NPCArgumentDispatch[EVENT_COMBAT]                 = handle_npc_hate;
+	NPCArgumentDispatch[EVENT_COMBAT]                 = handle_npc_combat;
 	NPCArgumentDispatch[EVENT_SIGNAL]                 = handle_npc_signal;
 	NPCArgumentDispatch[EVENT_TIMER]                  = handle_npc_timer;
 	NPCArgumentDispatch[EVENT_DEATH]                  = handle_npc_death;
@@ -445,7 +479,7 @@ LuaParser::~LuaParser() {
 	}
 }
 
-int LuaParser::EventNPC(QuestEventID evt, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+int LuaParser::EventNPC(QuestEventID evt, NPC* npc, Mob *init, const std::string &data, uint32 extra_data,
 						std::vector<std::any> *extra_pointers) {
 	evt = ConvertLuaEvent(evt);
 	if(evt >= _LargestEventID) {
@@ -464,7 +498,7 @@ int LuaParser::EventNPC(QuestEventID evt, NPC* npc, Mob *init, std::string data,
 	return _EventNPC(package_name, evt, npc, init, data, extra_data, extra_pointers);
 }
 
-int LuaParser::EventGlobalNPC(QuestEventID evt, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+int LuaParser::EventGlobalNPC(QuestEventID evt, NPC* npc, Mob *init, const std::string &data, uint32 extra_data,
 							  std::vector<std::any> *extra_pointers) {
 	evt = ConvertLuaEvent(evt);
 	if(evt >= _LargestEventID) {
@@ -482,7 +516,7 @@ int LuaParser::EventGlobalNPC(QuestEventID evt, NPC* npc, Mob *init, std::string
 	return _EventNPC("global_npc", evt, npc, init, data, extra_data, extra_pointers);
 }
 
-int LuaParser::_EventNPC(std::string package_name, QuestEventID evt, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+int LuaParser::_EventNPC(std::string package_name, QuestEventID evt, NPC* npc, Mob *init, const std::string &data, uint32 extra_data,
 						 std::vector<std::any> *extra_pointers, luabind::adl::object *l_func) {
 	const char *sub_name = LuaEvents[evt];
 
@@ -499,11 +533,9 @@ int LuaParser::_EventNPC(std::string package_name, QuestEventID evt, NPC* npc, M
 			npop = 3;
 		}
 
-		lua_createtable(L, 0, 0);
+		lua_createtable(L, 0, 8);
 		//always push self
-		Lua_NPC l_npc(npc);
-		luabind::adl::object l_npc_o = luabind::adl::object(L, l_npc);
-		l_npc_o.push(L);
+		PushSelfWrapper<Lua_NPC>(L, "eqemu_npc_self", npc, m_npc_self_cache_size);
 		lua_setfield(L, -2, "self");
 
 		auto arg_function = NPCArgumentDispatch[evt];
@@ -547,7 +579,7 @@ int LuaParser::_EventNPC(std::string package_name, QuestEventID evt, NPC* npc, M
 	return 0;
 }
 
-int LuaParser::EventPlayer(QuestEventID evt, Client *client, std::string data, uint32 extra_data,
+int LuaParser::EventPlayer(QuestEventID evt, Client *client, const std::string &data, uint32 extra_data,
 		std::vector<std::any> *extra_pointers) {
 	evt = ConvertLuaEvent(evt);
 	if(evt >= _LargestEventID) {
@@ -565,7 +597,7 @@ int LuaParser::EventPlayer(QuestEventID evt, Client *client, std::string data, u
 	return _EventPlayer("player", evt, client, data, extra_data, extra_pointers);
 }
 
-int LuaParser::EventGlobalPlayer(QuestEventID evt, Client *client, std::string data, uint32 extra_data,
+int LuaParser::EventGlobalPlayer(QuestEventID evt, Client *client, const std::string &data, uint32 extra_data,
 		std::vector<std::any> *extra_pointers) {
 	evt = ConvertLuaEvent(evt);
 	if(evt >= _LargestEventID) {
@@ -583,7 +615,7 @@ int LuaParser::EventGlobalPlayer(QuestEventID evt, Client *client, std::string d
 	return _EventPlayer("global_player", evt, client, data, extra_data, extra_pointers);
 }
 
-int LuaParser::_EventPlayer(std::string package_name, QuestEventID evt, Client *client, std::string data, uint32 extra_data,
+int LuaParser::_EventPlayer(std::string package_name, QuestEventID evt, Client *client, const std::string &data, uint32 extra_data,
 							std::vector<std::any> *extra_pointers, luabind::adl::object *l_func) {
 	const char *sub_name = LuaEvents[evt];
 	int start = lua_gettop(L);
@@ -599,11 +631,9 @@ int LuaParser::_EventPlayer(std::string package_name, QuestEventID evt, Client *
 			npop = 3;
 		}
 
-		lua_createtable(L, 0, 0);
+		lua_createtable(L, 0, 8);
 		//push self
-		Lua_Client l_client(client);
-		luabind::adl::object l_client_o = luabind::adl::object(L, l_client);
-		l_client_o.push(L);
+		PushSelfWrapper<Lua_Client>(L, "eqemu_client_self", client, m_client_self_cache_size);
 		lua_setfield(L, -2, "self");
 
 		auto arg_function = PlayerArgumentDispatch[evt];
@@ -646,7 +676,7 @@ int LuaParser::_EventPlayer(std::string package_name, QuestEventID evt, Client *
 	return 0;
 }
 
-int LuaParser::EventItem(QuestEventID evt, Client *client, EQ::ItemInstance *item, Mob *mob, std::string data, uint32 extra_data,
+int LuaParser::EventItem(QuestEventID evt, Client *client, EQ::ItemInstance *item, Mob *mob, const std::string &data, uint32 extra_data,
 		std::vector<std::any> *extra_pointers) {
 	evt = ConvertLuaEvent(evt);
 	if(evt >= _LargestEventID) {
@@ -667,7 +697,7 @@ int LuaParser::EventItem(QuestEventID evt, Client *client, EQ::ItemInstance *ite
 }
 
 int LuaParser::_EventItem(std::string package_name, QuestEventID evt, Client *client, EQ::ItemInstance *item, Mob *mob,
-						  std::string data, uint32 extra_data, std::vector<std::any> *extra_pointers, luabind::adl::object *l_func) {
+						  const std::string &data, uint32 extra_data, std::vector<std::any> *extra_pointers, luabind::adl::object *l_func) {
 	const char *sub_name = LuaEvents[evt];
 
 	int start = lua_gettop(L);
@@ -683,7 +713,7 @@ int LuaParser::_EventItem(std::string package_name, QuestEventID evt, Client *cl
 			npop = 3;
 		}
 
-		lua_createtable(L, 0, 0);
+		lua_createtable(L, 0, 8);
 		//always push self
 		Lua_ItemInst l_item(item);
 		luabind::adl::object l_item_o = luabind::adl::object(L, l_item);
@@ -738,7 +768,7 @@ int LuaParser::_EventItem(std::string package_name, QuestEventID evt, Client *cl
 	return 0;
 }
 
-int LuaParser::EventSpell(QuestEventID evt, Mob* mob, Client *client, uint32 spell_id, std::string data, uint32 extra_data,
+int LuaParser::EventSpell(QuestEventID evt, Mob* mob, Client *client, uint32 spell_id, const std::string &data, uint32 extra_data,
 						  std::vector<std::any> *extra_pointers) {
 	evt = ConvertLuaEvent(evt);
 	if(evt >= _LargestEventID) {
@@ -754,7 +784,7 @@ int LuaParser::EventSpell(QuestEventID evt, Mob* mob, Client *client, uint32 spe
 	return _EventSpell(package_name, evt, mob, client, spell_id, data, extra_data, extra_pointers);
 }
 
-int LuaParser::_EventSpell(std::string package_name, QuestEventID evt, Mob* mob, Client *client, uint32 spell_id, std::string data, uint32 extra_data,
+int LuaParser::_EventSpell(std::string package_name, QuestEventID evt, Mob* mob, Client *client, uint32 spell_id, const std::string &data, uint32 extra_data,
 						   std::vector<std::any> *extra_pointers, luabind::adl::object *l_func) {
 	const char *sub_name = LuaEvents[evt];
 
@@ -771,7 +801,7 @@ int LuaParser::_EventSpell(std::string package_name, QuestEventID evt, Mob* mob,
 			npop = 3;
 		}
 
-		lua_createtable(L, 0, 0);
+		lua_createtable(L, 0, 8);
 
 		//always push self even if invalid
 		if(IsValidSpell(spell_id)) {
@@ -826,7 +856,7 @@ int LuaParser::_EventSpell(std::string package_name, QuestEventID evt, Mob* mob,
 	return 0;
 }
 
-int LuaParser::EventEncounter(QuestEventID evt, std::string encounter_name, std::string data, uint32 extra_data, std::vector<std::any> *extra_pointers) {
+int LuaParser::EventEncounter(QuestEventID evt, std::string encounter_name, const std::string &data, uint32 extra_data, std::vector<std::any> *extra_pointers) {
 	evt = ConvertLuaEvent(evt);
 	if(evt >= _LargestEventID) {
 		return 0;
@@ -841,7 +871,7 @@ int LuaParser::EventEncounter(QuestEventID evt, std::string encounter_name, std:
 	return _EventEncounter(package_name, evt, encounter_name, data, extra_data, extra_pointers);
 }
 
-int LuaParser::_EventEncounter(std::string package_name, QuestEventID evt, std::string encounter_name, std::string data, uint32 extra_data,
+int LuaParser::_EventEncounter(std::string package_name, QuestEventID evt, std::string encounter_name, const std::string &data, uint32 extra_data,
 							   std::vector<std::any> *extra_pointers) {
 	const char *sub_name = LuaEvents[evt];
 
@@ -1393,7 +1423,7 @@ void LuaParser::MapFunctions(lua_State *L) {
 	}
 }
 
-int LuaParser::DispatchEventNPC(QuestEventID evt, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+int LuaParser::DispatchEventNPC(QuestEventID evt, NPC* npc, Mob *init, const std::string &data, uint32 extra_data,
 								 std::vector<std::any> *extra_pointers) {
 	evt = ConvertLuaEvent(evt);
 	if(evt >= _LargestEventID) {
@@ -1439,7 +1469,7 @@ int LuaParser::DispatchEventNPC(QuestEventID evt, NPC* npc, Mob *init, std::stri
     return ret;
 }
 
-int LuaParser::DispatchEventPlayer(QuestEventID evt, Client *client, std::string data, uint32 extra_data,
+int LuaParser::DispatchEventPlayer(QuestEventID evt, Client *client, const std::string &data, uint32 extra_data,
 									std::vector<std::any> *extra_pointers) {
 	evt = ConvertLuaEvent(evt);
 	if(evt >= _LargestEventID) {
@@ -1468,7 +1498,7 @@ int LuaParser::DispatchEventPlayer(QuestEventID evt, Client *client, std::string
     return ret;
 }
 
-int LuaParser::DispatchEventItem(QuestEventID evt, Client *client, EQ::ItemInstance *item, Mob *mob, std::string data, uint32 extra_data,
+int LuaParser::DispatchEventItem(QuestEventID evt, Client *client, EQ::ItemInstance *item, Mob *mob, const std::string &data, uint32 extra_data,
 								  std::vector<std::any> *extra_pointers) {
 	evt = ConvertLuaEvent(evt);
 	if(evt >= _LargestEventID) {
@@ -1514,7 +1544,7 @@ int LuaParser::DispatchEventItem(QuestEventID evt, Client *client, EQ::ItemInsta
     return ret;
 }
 
-int LuaParser::DispatchEventSpell(QuestEventID evt, Mob* mob, Client *client, uint32 spell_id, std::string data, uint32 extra_data,
+int LuaParser::DispatchEventSpell(QuestEventID evt, Mob* mob, Client *client, uint32 spell_id, const std::string &data, uint32 extra_data,
 								   std::vector<std::any> *extra_pointers) {
 	evt = ConvertLuaEvent(evt);
 	if(evt >= _LargestEventID) {
@@ -1731,7 +1761,7 @@ int LuaParser::EventBot(
 	QuestEventID evt,
 	Bot *bot,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1755,7 +1785,7 @@ int LuaParser::EventGlobalBot(
 	QuestEventID evt,
 	Bot *bot,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1780,7 +1810,7 @@ int LuaParser::_EventBot(
 	QuestEventID evt,
 	Bot *bot,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers,
 	luabind::adl::object *l_func
@@ -1799,7 +1829,7 @@ int LuaParser::_EventBot(
 			npop = 3;
 		}
 
-		lua_createtable(L, 0, 0);
+		lua_createtable(L, 0, 8);
 		//push self
 		Lua_Bot l_bot(bot);
 		luabind::adl::object l_bot_o = luabind::adl::object(L, l_bot);
@@ -1851,7 +1881,7 @@ int LuaParser::DispatchEventBot(
 	QuestEventID evt,
 	Bot *bot,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1916,7 +1946,7 @@ int LuaParser::EventMerc(
 	QuestEventID evt,
 	Merc *merc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1940,7 +1970,7 @@ int LuaParser::EventGlobalMerc(
 	QuestEventID evt,
 	Merc *merc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1965,7 +1995,7 @@ int LuaParser::_EventMerc(
 	QuestEventID evt,
 	Merc *merc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers,
 	luabind::adl::object *l_func
@@ -1984,7 +2014,7 @@ int LuaParser::_EventMerc(
 			npop = 3;
 		}
 
-		lua_createtable(L, 0, 0);
+		lua_createtable(L, 0, 8);
 		//push self
 		Lua_Merc l_merc(merc);
 		luabind::adl::object l_merc_o = luabind::adl::object(L, l_merc);
@@ -2044,7 +2074,7 @@ int LuaParser::DispatchEventMerc(
 	QuestEventID evt,
 	Merc *merc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2108,7 +2138,7 @@ void LuaParser::LoadGlobalMercScript(std::string filename) {
 int LuaParser::EventZone(
 	QuestEventID evt,
 	Zone *zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2131,7 +2161,7 @@ int LuaParser::EventZone(
 int LuaParser::EventGlobalZone(
 	QuestEventID evt,
 	Zone *zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2155,7 +2185,7 @@ int LuaParser::_EventZone(
 	std::string package_name,
 	QuestEventID evt,
 	Zone *zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers,
 	luabind::adl::object *l_func
@@ -2231,7 +2261,7 @@ int LuaParser::_EventZone(
 int LuaParser::DispatchEventZone(
 	QuestEventID evt,
 	Zone *zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
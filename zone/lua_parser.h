@@ -42,7 +42,7 @@ public:
 		QuestEventID evt,
 		NPC* npc,
 		Mob *init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -50,21 +50,21 @@ public:
 		QuestEventID evt,
 		NPC* npc,
 		Mob *init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
 	virtual int EventPlayer(
 		QuestEventID evt,
 		Client *client,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
 	virtual int EventGlobalPlayer(
 		QuestEventID evt,
 		Client *client,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -73,7 +73,7 @@ public:
 		Client *client,
 		EQ::ItemInstance *item,
 		Mob *mob,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -82,14 +82,14 @@ public:
 		Mob* mob,
 		Client *client,
 		uint32 spell_id,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
 	virtual int EventEncounter(
 		QuestEventID evt,
 		std::string encounter_name,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -97,7 +97,7 @@ public:
 		QuestEventID evt,
 		Bot *bot,
 		Mob *init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -105,7 +105,7 @@ public:
 		QuestEventID evt,
 		Bot *bot,
 		Mob *init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -113,7 +113,7 @@ public:
 		QuestEventID evt,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -121,21 +121,21 @@ public:
 		QuestEventID evt,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
 	virtual int EventZone(
 		QuestEventID evt,
 		Zone* zone,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
 	virtual int EventGlobalZone(
 		QuestEventID evt,
 		Zone* zone,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -180,14 +180,14 @@ public:
 		QuestEventID evt,
 		NPC* npc,
 		Mob *init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
 	virtual int DispatchEventPlayer(
 		QuestEventID evt,
 		Client *client,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -196,7 +196,7 @@ public:
 		Client *client,
 		EQ::ItemInstance *item,
 		Mob *mob,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -205,7 +205,7 @@ public:
 		Mob* mob,
 		Client *client,
 		uint32 spell_id,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -213,7 +213,7 @@ public:
 		QuestEventID evt,
 		Bot *bot,
 		Mob *init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -221,14 +221,14 @@ public:
 		QuestEventID evt,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
 	virtual int DispatchEventZone(
 		QuestEventID evt,
 		Zone* zone,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -268,7 +268,7 @@ private:
 		QuestEventID evt,
 		NPC* npc,
 		Mob *init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers,
 		luabind::adl::object *l_func = nullptr
@@ -277,7 +277,7 @@ private:
 		std::string package_name,
 		QuestEventID evt,
 		Client *client,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers,
 		luabind::adl::object *l_func = nullptr
@@ -288,7 +288,7 @@ private:
 		Client *client,
 		EQ::ItemInstance *item,
 		Mob *mob,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers,
 		luabind::adl::object *l_func = nullptr
@@ -299,7 +299,7 @@ private:
 		Mob* mob,
 		Client *client,
 		uint32 spell_id,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers,
 		luabind::adl::object *l_func = nullptr
@@ -308,7 +308,7 @@ private:
 		std::string package_name,
 		QuestEventID evt,
 		std::string encounter_name,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -317,7 +317,7 @@ private:
 		QuestEventID evt,
 		Bot *bot,
 		Mob *init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers,
 		luabind::adl::object *l_func = nullptr
@@ -327,7 +327,7 @@ private:
 		QuestEventID evt,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers,
 		luabind::adl::object* l_func = nullptr
@@ -336,7 +336,7 @@ private:
 		std::string package_name,
 		QuestEventID evt,
 		Zone* zone,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers,
 		luabind::adl::object* l_func = nullptr
@@ -351,6 +351,10 @@ private:
 	std::vector<LuaMod> mods_;
 	lua_State *L;
 
+	// entries in the self wrapper caches, the caches are dropped and rebuilt once they reach MAX_SELF_WRAPPER_CACHE
+	int m_npc_self_cache_size    = 0;
+	int m_client_self_cache_size = 0;
+
 	NPCArgumentHandler       NPCArgumentDispatch[_LargestEventID];
 	PlayerArgumentHandler    PlayerArgumentDispatch[_LargestEventID];
 	ItemArgumentHandler      ItemArgumentDispatch[_LargestEventID];
@@ -23,13 +23,50 @@
 #include "zone.h"
 #include "lua_parser_events.h"
 
+// EVENT_DAMAGE_GIVEN and EVENT_DAMAGE_TAKEN, shared by the npc, player and bot handlers
+static void push_damage_event(lua_State* L, std::vector<std::any> *extra_pointers)
+{
+	if (!extra_pointers || extra_pointers->size() < 2) {
+		return;
+	}
+
+	const auto *d = std::any_cast<QuestDamageEvent *>(extra_pointers->at(1));
+
+	lua_pushnumber(L, d->entity_id);
+	lua_setfield(L, -2, "entity_id");
+
+	lua_pushnumber(L, d->damage);
+	lua_setfield(L, -2, "damage");
+
+	lua_pushnumber(L, d->spell_id);
+	lua_setfield(L, -2, "spell_id");
+
+	lua_pushnumber(L, d->skill_id);
+	lua_setfield(L, -2, "skill_id");
+
+	lua_pushboolean(L, d->is_damage_shield);
+	lua_setfield(L, -2, "is_damage_shield");
+
+	lua_pushboolean(L, d->is_avoidable);
+	lua_setfield(L, -2, "is_avoidable");
+
+	lua_pushnumber(L, d->buff_slot);
+	lua_setfield(L, -2, "buff_slot");
+
+	lua_pushboolean(L, d->is_buff_tic);
+	lua_setfield(L, -2, "is_buff_tic");
+
+	lua_pushnumber(L, d->special_attack);
+	lua_setfield(L, -2, "special_attack");
+}
+
 //NPC
 void handle_npc_event_say(
 	QuestInterface *parse,
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -52,7 +89,7 @@ void handle_npc_event_trade(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -123,19 +160,21 @@ void handle_npc_event_hp(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
+	const int hp_event = extra_pointers && !extra_pointers->empty() ? std::any_cast<int>(extra_pointers->at(0)) : -1;
+
 	if(extra_data == 1) {
 		lua_pushinteger(L, -1);
 		lua_setfield(L, -2, "hp_event");
-		lua_pushinteger(L, Strings::ToInt(data));
+		lua_pushinteger(L, hp_event);
 		lua_setfield(L, -2, "inc_hp_event");
 	}
 	else
 	{
-		lua_pushinteger(L, Strings::ToInt(data));
+		lua_pushinteger(L, hp_event);
 		lua_setfield(L, -2, "hp_event");
 		lua_pushinteger(L, -1);
 		lua_setfield(L, -2, "inc_hp_event");
@@ -147,7 +186,7 @@ void handle_npc_single_mob(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -162,7 +201,7 @@ void handle_npc_single_client(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -177,7 +216,7 @@ void handle_npc_task_accepted(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -195,7 +234,7 @@ void handle_npc_popup(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -213,7 +252,7 @@ void handle_npc_waypoint(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -231,7 +270,7 @@ void handle_npc_hate(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -244,13 +283,31 @@ void handle_npc_hate(
 	lua_setfield(L, -2, "joined");
 }
 
+void handle_npc_combat(
+	QuestInterface *parse,
+	lua_State* L,
+	NPC* npc,
+	Mob *init,
+	const std::string &data,
+	uint32 extra_data,
+	std::vector<std::any> *extra_pointers
+) {
+	Lua_Mob l_mob(init);
+	luabind::adl::object l_mob_o = luabind::adl::object(L, l_mob);
+	l_mob_o.push(L);
+	lua_setfield(L, -2, "other");
+
+	lua_pushboolean(L, extra_pointers && !extra_pointers->empty() && std::any_cast<bool>(extra_pointers->at(0)));
+	lua_setfield(L, -2, "joined");
+}
+
 
 void handle_npc_signal(
 	QuestInterface *parse,
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -263,7 +320,7 @@ void handle_npc_payload(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -281,7 +338,7 @@ void handle_npc_timer(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -294,7 +351,7 @@ void handle_npc_death(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -362,7 +419,7 @@ void handle_npc_cast(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -396,7 +453,7 @@ void handle_npc_area(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -412,7 +469,7 @@ void handle_npc_null(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -423,7 +480,7 @@ void handle_npc_loot_zone(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -448,7 +505,7 @@ void handle_npc_spawn_zone(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -463,7 +520,7 @@ void handle_npc_despawn_zone(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -478,38 +535,11 @@ void handle_npc_damage(
 	lua_State* L,
 	NPC* npc,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
-	Seperator sep(data.c_str());
-
-	lua_pushnumber(L, Strings::ToUnsignedInt(sep.arg[0]));
-	lua_setfield(L, -2, "entity_id");
-
-	lua_pushnumber(L, Strings::ToBigInt(sep.arg[1]));
-	lua_setfield(L, -2, "damage");
-
-	lua_pushnumber(L, Strings::ToInt(sep.arg[2]));
-	lua_setfield(L, -2, "spell_id");
-
-	lua_pushnumber(L, Strings::ToInt(sep.arg[3]));
-	lua_setfield(L, -2, "skill_id");
-
-	lua_pushboolean(L, Strings::ToBool(sep.arg[4]));
-	lua_setfield(L, -2, "is_damage_shield");
-
-	lua_pushboolean(L, Strings::ToBool(sep.arg[5]));
-	lua_setfield(L, -2, "is_avoidable");
-
-	lua_pushnumber(L, Strings::ToInt(sep.arg[6]));
-	lua_setfield(L, -2, "buff_slot");
-
-	lua_pushboolean(L, Strings::ToBool(sep.arg[7]));
-	lua_setfield(L, -2, "is_buff_tic");
-
-	lua_pushnumber(L, Strings::ToInt(sep.arg[8]));
-	lua_setfield(L, -2, "special_attack");
+	push_damage_event(L, extra_pointers);
 
 	Lua_Mob l_mob(init);
 	luabind::adl::object l_mob_o = luabind::adl::object(L, l_mob);
@@ -522,7 +552,7 @@ void handle_npc_loot_added(
 	lua_State* L,
 	NPC* npc,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -579,7 +609,7 @@ void handle_npc_timer_pause_resume_start(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -597,7 +627,7 @@ void handle_npc_timer_stop(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -610,7 +640,7 @@ void handle_npc_entity_variable(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 )
@@ -640,7 +670,7 @@ void handle_npc_spell_blocked(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 )
@@ -673,7 +703,7 @@ void handle_npc_pet_command(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 )
@@ -690,7 +720,7 @@ void handle_player_say(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -705,7 +735,7 @@ void handle_player_environmental_damage(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -724,7 +754,7 @@ void handle_player_death(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -778,7 +808,7 @@ void handle_player_timer(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -790,7 +820,7 @@ void handle_player_discover_item(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -812,7 +842,7 @@ void handle_player_fish_forage_success(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -826,7 +856,7 @@ void handle_player_click_object(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -840,7 +870,7 @@ void handle_player_click_door(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -854,7 +884,7 @@ void handle_player_signal(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -866,7 +896,7 @@ void handle_player_payload(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -883,7 +913,7 @@ void handle_player_popup_response(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -895,7 +925,7 @@ void handle_player_pick_up(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -909,7 +939,7 @@ void handle_player_cast(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -949,7 +979,7 @@ void handle_player_task_fail(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -961,7 +991,7 @@ void handle_player_zone(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -990,7 +1020,7 @@ void handle_player_duel_win(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1004,7 +1034,7 @@ void handle_player_duel_loss(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1018,7 +1048,7 @@ void handle_player_loot(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1037,7 +1067,7 @@ void handle_player_task_stage_complete(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1053,7 +1083,7 @@ void handle_player_task_accepted(
 	QuestInterface* parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 ) {
@@ -1065,7 +1095,7 @@ void handle_player_task_update(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1084,7 +1114,7 @@ void handle_player_command(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1109,7 +1139,7 @@ void handle_player_combine(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1124,7 +1154,7 @@ void handle_player_feign(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1138,7 +1168,7 @@ void handle_player_area(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1153,7 +1183,7 @@ void handle_player_respawn(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1168,7 +1198,7 @@ void handle_player_packet(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1185,7 +1215,7 @@ void handle_player_null(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1195,7 +1225,7 @@ void handle_player_use_skill(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1211,7 +1241,7 @@ void handle_test_buff(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1221,7 +1251,7 @@ void handle_player_combine_validate(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1252,7 +1282,7 @@ void handle_player_bot_command(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1277,7 +1307,7 @@ void handle_player_warp(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1296,7 +1326,7 @@ void handle_player_quest_combine(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1308,7 +1338,7 @@ void handle_player_consider(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1327,7 +1357,7 @@ void handle_player_consider_corpse(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1346,7 +1376,7 @@ void handle_player_inspect(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1360,7 +1390,7 @@ void handle_player_aa_buy(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1382,7 +1412,7 @@ void handle_player_aa_gain(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1394,7 +1424,7 @@ void handle_player_aa_exp_gain(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1406,7 +1436,7 @@ void handle_player_exp_gain(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1418,7 +1448,7 @@ void handle_player_level_up(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1430,7 +1460,7 @@ void handle_player_level_down(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1442,7 +1472,7 @@ void handle_player_gm_command(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1454,7 +1484,7 @@ void handle_player_bot_create(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1479,38 +1509,11 @@ void handle_player_damage(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
-	Seperator sep(data.c_str());
-
-	lua_pushnumber(L, Strings::ToUnsignedInt(sep.arg[0]));
-	lua_setfield(L, -2, "entity_id");
-
-	lua_pushnumber(L, Strings::ToBigInt(sep.arg[1]));
-	lua_setfield(L, -2, "damage");
-
-	lua_pushnumber(L, Strings::ToInt(sep.arg[2]));
-	lua_setfield(L, -2, "spell_id");
-
-	lua_pushnumber(L, Strings::ToInt(sep.arg[3]));
-	lua_setfield(L, -2, "skill_id");
-
-	lua_pushboolean(L, Strings::ToBool(sep.arg[4]));
-	lua_setfield(L, -2, "is_damage_shield");
-
-	lua_pushboolean(L, Strings::ToBool(sep.arg[5]));
-	lua_setfield(L, -2, "is_avoidable");
-
-	lua_pushnumber(L, Strings::ToInt(sep.arg[6]));
-	lua_setfield(L, -2, "buff_slot");
-
-	lua_pushboolean(L, Strings::ToBool(sep.arg[7]));
-	lua_setfield(L, -2, "is_buff_tic");
-
-	lua_pushnumber(L, Strings::ToInt(sep.arg[8]));
-	lua_setfield(L, -2, "special_attack");
+	push_damage_event(L, extra_pointers);
 
 	if (extra_pointers && extra_pointers->size() >= 1) {
 		Lua_Mob l_mob(std::any_cast<Mob*>(extra_pointers->at(0)));
@@ -1524,7 +1527,7 @@ void handle_player_item_click(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1552,7 +1555,7 @@ void handle_player_destroy_item(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1578,7 +1581,7 @@ void handle_player_drop_item(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1611,7 +1614,7 @@ void handle_player_target_change(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1627,7 +1630,7 @@ void handle_player_memorize_scribe_spell(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1656,7 +1659,7 @@ void handle_player_ldon_points_gain_loss(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1673,7 +1676,7 @@ void handle_player_crystal_gain_loss(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1693,7 +1696,7 @@ void handle_player_alt_currency_gain_loss(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1713,7 +1716,7 @@ void handle_player_entity_variable(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 )
@@ -1742,7 +1745,7 @@ void handle_player_aa_loss(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 )
@@ -1755,7 +1758,7 @@ void handle_player_spell_blocked(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 )
@@ -1787,7 +1790,7 @@ void handle_player_read_item(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 )
@@ -1830,7 +1833,7 @@ void handle_player_connect(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 )
@@ -1850,7 +1853,7 @@ void handle_player_pet_command(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 )
@@ -1869,7 +1872,7 @@ void handle_item_click(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1883,7 +1886,7 @@ void handle_item_timer(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1897,7 +1900,7 @@ void handle_item_proc(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1925,7 +1928,7 @@ void handle_item_loot(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1948,7 +1951,7 @@ void handle_item_equip(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1962,7 +1965,7 @@ void handle_item_augment(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -1981,7 +1984,7 @@ void handle_item_augment_insert(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2000,7 +2003,7 @@ void handle_item_augment_remove(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2022,7 +2025,7 @@ void handle_item_null(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2034,7 +2037,7 @@ void handle_item_timer_pause_resume_start(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2053,7 +2056,7 @@ void handle_item_timer_stop(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2068,7 +2071,7 @@ void handle_spell_event(
 	Mob* mob,
 	Client* client,
 	uint32 spell_id,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2117,7 +2120,7 @@ void handle_translocate_finish(
 	Mob* mob,
 	Client* client,
 	uint32 spell_id,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2142,7 +2145,7 @@ void handle_player_equip_item(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2169,7 +2172,7 @@ void handle_spell_null(
 	Mob* mob,
 	Client* client,
 	uint32 spell_id,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2179,7 +2182,7 @@ void handle_encounter_timer(
 	QuestInterface *parse,
 	lua_State* L,
 	Encounter* encounter,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2191,7 +2194,7 @@ void handle_encounter_load(
 	QuestInterface *parse,
 	lua_State* L,
 	Encounter* encounter,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2212,7 +2215,7 @@ void handle_encounter_unload(
 	QuestInterface *parse,
 	lua_State* L,
 	Encounter* encounter,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2227,7 +2230,7 @@ void handle_encounter_null(
 	QuestInterface *parse,
 	lua_State* L,
 	Encounter* encounter,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2237,7 +2240,7 @@ void handle_player_skill_up(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2259,7 +2262,7 @@ void handle_player_language_skill_up(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2278,7 +2281,7 @@ void handle_player_alt_currency_merchant(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2303,7 +2306,7 @@ void handle_player_merchant(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2328,7 +2331,7 @@ void handle_player_augment_insert(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2360,7 +2363,7 @@ void handle_player_augment_remove(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2395,7 +2398,7 @@ void handle_player_timer_pause_resume_start(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2412,7 +2415,7 @@ void handle_player_timer_stop(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2427,7 +2430,7 @@ void handle_bot_null(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2438,7 +2441,7 @@ void handle_bot_cast(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2472,7 +2475,7 @@ void handle_bot_combat(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2481,7 +2484,7 @@ void handle_bot_combat(
 	l_mob_o.push(L);
 	lua_setfield(L, -2, "other");
 
-	lua_pushboolean(L, Strings::ToBool(data));
+	lua_pushboolean(L, extra_pointers && !extra_pointers->empty() && std::any_cast<bool>(extra_pointers->at(0)));
 	lua_setfield(L, -2, "joined");
 }
 
@@ -2490,7 +2493,7 @@ void handle_bot_death(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2533,7 +2536,7 @@ void handle_bot_popup_response(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2551,7 +2554,7 @@ void handle_bot_say(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2572,7 +2575,7 @@ void handle_bot_signal(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2585,7 +2588,7 @@ void handle_bot_payload(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2603,7 +2606,7 @@ void handle_bot_slay(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2618,7 +2621,7 @@ void handle_bot_target_change(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2633,7 +2636,7 @@ void handle_bot_timer(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2646,7 +2649,7 @@ void handle_bot_trade(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2704,7 +2707,7 @@ void handle_bot_use_skill(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2721,7 +2724,7 @@ void handle_bot_equip_item(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2747,38 +2750,11 @@ void handle_bot_damage(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
-	Seperator sep(data.c_str());
-
-	lua_pushnumber(L, Strings::ToUnsignedInt(sep.arg[0]));
-	lua_setfield(L, -2, "entity_id");
-
-	lua_pushnumber(L, Strings::ToBigInt(sep.arg[1]));
-	lua_setfield(L, -2, "damage");
-
-	lua_pushnumber(L, Strings::ToInt(sep.arg[2]));
-	lua_setfield(L, -2, "spell_id");
-
-	lua_pushnumber(L, Strings::ToInt(sep.arg[3]));
-	lua_setfield(L, -2, "skill_id");
-
-	lua_pushboolean(L, Strings::ToBool(sep.arg[4]));
-	lua_setfield(L, -2, "is_damage_shield");
-
-	lua_pushboolean(L, Strings::ToBool(sep.arg[5]));
-	lua_setfield(L, -2, "is_avoidable");
-
-	lua_pushnumber(L, Strings::ToInt(sep.arg[6]));
-	lua_setfield(L, -2, "buff_slot");
-
-	lua_pushboolean(L, Strings::ToBool(sep.arg[7]));
-	lua_setfield(L, -2, "is_buff_tic");
-
-	lua_pushnumber(L, Strings::ToInt(sep.arg[8]));
-	lua_setfield(L, -2, "special_attack");
+	push_damage_event(L, extra_pointers);
 
 	Lua_Mob l_mob(init);
 	luabind::adl::object l_mob_o = luabind::adl::object(L, l_mob);
@@ -2791,7 +2767,7 @@ void handle_bot_level_up(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2804,7 +2780,7 @@ void handle_bot_level_down(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2817,7 +2793,7 @@ void handle_bot_timer_pause_resume_start(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2835,7 +2811,7 @@ void handle_bot_timer_stop(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2848,7 +2824,7 @@ void handle_bot_entity_variable(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 )
@@ -2878,7 +2854,7 @@ void handle_bot_spell_blocked(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 )
@@ -2912,7 +2888,7 @@ void handle_zone_null(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2922,7 +2898,7 @@ void handle_zone_click_door(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2941,7 +2917,7 @@ void handle_zone_click_object(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2960,7 +2936,7 @@ void handle_zone_death(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -3027,7 +3003,7 @@ void handle_zone_despawn(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -3041,7 +3017,7 @@ void handle_zone_enter(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -3055,7 +3031,7 @@ void handle_zone_loot(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -3079,7 +3055,7 @@ void handle_zone_payload(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -3096,7 +3072,7 @@ void handle_zone_pickup(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -3115,7 +3091,7 @@ void handle_zone_popup(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -3132,7 +3108,7 @@ void handle_zone_signal(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -3144,7 +3120,7 @@ void handle_zone_spawn(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -3158,7 +3134,7 @@ void handle_zone_timer(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -3170,7 +3146,7 @@ void handle_zone_timer_pause_resume_start(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -3187,7 +3163,7 @@ void handle_zone_timer_stop(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 ) {
@@ -2,14 +2,14 @@
 #define _EQE_LUA_PARSER_EVENTS_H
 #ifdef LUA_EQEMU
 
-typedef void(*NPCArgumentHandler)(QuestInterface*, lua_State*, NPC*, Mob*, std::string, uint32, std::vector<std::any>*);
-typedef void(*PlayerArgumentHandler)(QuestInterface*, lua_State*, Client*, std::string, uint32, std::vector<std::any>*);
-typedef void(*ItemArgumentHandler)(QuestInterface*, lua_State*, Client*, EQ::ItemInstance*, Mob*, std::string, uint32, std::vector<std::any>*);
-typedef void(*SpellArgumentHandler)(QuestInterface*, lua_State*, Mob*, Client*, uint32, std::string, uint32, std::vector<std::any>*);
-typedef void(*EncounterArgumentHandler)(QuestInterface*, lua_State*, Encounter* encounter, std::string, uint32, std::vector<std::any>*);
-typedef void(*BotArgumentHandler)(QuestInterface*, lua_State*, Bot*, Mob*, std::string, uint32, std::vector<std::any>*);
-typedef void(*MercArgumentHandler)(QuestInterface*, lua_State*, Merc*, Mob*, std::string, uint32, std::vector<std::any>*);
-typedef void(*ZoneArgumentHandler)(QuestInterface*, lua_State*, Zone*, std::string, uint32, std::vector<std::any>*);
+typedef void(*NPCArgumentHandler)(QuestInterface*, lua_State*, NPC*, Mob*, const std::string&, uint32, std::vector<std::any>*);
+typedef void(*PlayerArgumentHandler)(QuestInterface*, lua_State*, Client*, const std::string&, uint32, std::vector<std::any>*);
+typedef void(*ItemArgumentHandler)(QuestInterface*, lua_State*, Client*, EQ::ItemInstance*, Mob*, const std::string&, uint32, std::vector<std::any>*);
+typedef void(*SpellArgumentHandler)(QuestInterface*, lua_State*, Mob*, Client*, uint32, const std::string&, uint32, std::vector<std::any>*);
+typedef void(*EncounterArgumentHandler)(QuestInterface*, lua_State*, Encounter* encounter, const std::string&, uint32, std::vector<std::any>*);
+typedef void(*BotArgumentHandler)(QuestInterface*, lua_State*, Bot*, Mob*, const std::string&, uint32, std::vector<std::any>*);
+typedef void(*MercArgumentHandler)(QuestInterface*, lua_State*, Merc*, Mob*, const std::string&, uint32, std::vector<std::any>*);
+typedef void(*ZoneArgumentHandler)(QuestInterface*, lua_State*, Zone*, const std::string&, uint32, std::vector<std::any>*);
 
 // NPC
 void handle_npc_event_say(
@@ -17,7 +17,7 @@ void handle_npc_event_say(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -27,7 +27,7 @@ void handle_npc_event_trade(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -37,7 +37,7 @@ void handle_npc_event_hp(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -47,7 +47,7 @@ void handle_npc_single_mob(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -57,7 +57,7 @@ void handle_npc_single_client(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -67,7 +67,7 @@ void handle_npc_task_accepted(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -77,7 +77,7 @@ void handle_npc_popup(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -87,7 +87,7 @@ void handle_npc_waypoint(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -97,7 +97,17 @@ void handle_npc_hate(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
+	uint32 extra_data,
+	std::vector<std::any> *extra_pointers
+);
+
+void handle_npc_combat(
+	QuestInterface *parse,
+	lua_State* L,
+	NPC* npc,
+	Mob *init,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -107,7 +117,7 @@ void handle_npc_signal(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -117,7 +127,7 @@ void handle_npc_timer(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -127,7 +137,7 @@ void handle_npc_death(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -137,7 +147,7 @@ void handle_npc_cast(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -147,7 +157,7 @@ void handle_npc_area(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -157,7 +167,7 @@ void handle_npc_null(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -167,7 +177,7 @@ void handle_npc_loot_zone(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -177,7 +187,7 @@ void handle_npc_spawn_zone(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -187,7 +197,7 @@ void handle_npc_payload(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -197,7 +207,7 @@ void handle_npc_despawn_zone(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -207,7 +217,7 @@ void handle_npc_damage(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -217,7 +227,7 @@ void handle_npc_loot_added(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -227,7 +237,7 @@ void handle_npc_timer_pause_resume_start(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -237,7 +247,7 @@ void handle_npc_timer_stop(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -247,7 +257,7 @@ void handle_npc_entity_variable(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -257,7 +267,7 @@ void handle_npc_spell_blocked(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -267,7 +277,7 @@ void handle_npc_pet_command(
 	lua_State* L,
 	NPC* npc,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -277,7 +287,7 @@ void handle_player_say(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -286,7 +296,7 @@ void handle_player_environmental_damage(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -295,7 +305,7 @@ void handle_player_death(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -304,7 +314,7 @@ void handle_player_timer(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -313,7 +323,7 @@ void handle_player_discover_item(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -322,7 +332,7 @@ void handle_player_fish_forage_success(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -331,7 +341,7 @@ void handle_player_click_object(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -340,7 +350,7 @@ void handle_player_click_door(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -349,7 +359,7 @@ void handle_player_signal(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -358,7 +368,7 @@ void handle_player_popup_response(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -367,7 +377,7 @@ void handle_player_pick_up(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -376,7 +386,7 @@ void handle_player_cast(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -385,7 +395,7 @@ void handle_player_task_fail(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -394,7 +404,7 @@ void handle_player_zone(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -403,7 +413,7 @@ void handle_player_duel_win(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -412,7 +422,7 @@ void handle_player_duel_loss(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -421,7 +431,7 @@ void handle_player_loot(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -430,7 +440,7 @@ void handle_player_task_stage_complete(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -439,7 +449,7 @@ void handle_player_task_accepted(
 	QuestInterface* parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 );
@@ -448,7 +458,7 @@ void handle_player_task_update(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -457,7 +467,7 @@ void handle_player_command(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -466,7 +476,7 @@ void handle_player_combine(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -475,7 +485,7 @@ void handle_player_feign(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -484,7 +494,7 @@ void handle_player_area(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -493,7 +503,7 @@ void handle_player_respawn(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -502,7 +512,7 @@ void handle_player_packet(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -511,7 +521,7 @@ void handle_player_null(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -520,7 +530,7 @@ void handle_player_use_skill(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -529,7 +539,7 @@ void handle_test_buff(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -538,7 +548,7 @@ void handle_player_combine_validate(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -547,7 +557,7 @@ void handle_player_bot_command(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -556,7 +566,7 @@ void handle_player_warp(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -565,7 +575,7 @@ void handle_player_quest_combine(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -574,7 +584,7 @@ void handle_player_consider(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -583,7 +593,7 @@ void handle_player_consider_corpse(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -592,7 +602,7 @@ void handle_player_equip_item(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -601,7 +611,7 @@ void handle_player_skill_up(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -610,7 +620,7 @@ void handle_player_language_skill_up(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -619,7 +629,7 @@ void handle_player_alt_currency_merchant(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -628,7 +638,7 @@ void handle_player_merchant(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -637,7 +647,7 @@ void handle_player_inspect(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -646,7 +656,7 @@ void handle_player_aa_buy(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -655,7 +665,7 @@ void handle_player_aa_gain(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -664,7 +674,7 @@ void handle_player_aa_exp_gain(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -673,7 +683,7 @@ void handle_player_exp_gain(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -682,7 +692,7 @@ void handle_player_payload(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -691,7 +701,7 @@ void handle_player_level_up(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -700,7 +710,7 @@ void handle_player_level_down(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -709,7 +719,7 @@ void handle_player_gm_command(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -718,7 +728,7 @@ void handle_player_bot_create(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -727,7 +737,7 @@ void handle_player_augment_insert(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -736,7 +746,7 @@ void handle_player_augment_remove(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -745,7 +755,7 @@ void handle_player_damage(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -754,7 +764,7 @@ void handle_player_item_click(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -763,7 +773,7 @@ void handle_player_destroy_item(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -772,7 +782,7 @@ void handle_player_target_change(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -781,7 +791,7 @@ void handle_player_drop_item(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -790,7 +800,7 @@ void handle_player_memorize_scribe_spell(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -799,7 +809,7 @@ void handle_player_ldon_points_gain_loss(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -808,7 +818,7 @@ void handle_player_alt_currency_gain_loss(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -817,7 +827,7 @@ void handle_player_crystal_gain_loss(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -826,7 +836,7 @@ void handle_player_timer_pause_resume_start(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -835,7 +845,7 @@ void handle_player_timer_stop(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -844,7 +854,7 @@ void handle_player_entity_variable(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -853,7 +863,7 @@ void handle_player_aa_loss(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -862,7 +872,7 @@ void handle_player_spell_blocked(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -871,7 +881,7 @@ void handle_player_read_item(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -880,7 +890,7 @@ void handle_player_connect(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -889,7 +899,7 @@ void handle_player_pet_command(
 	QuestInterface *parse,
 	lua_State* L,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -901,7 +911,7 @@ void handle_item_click(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -912,7 +922,7 @@ void handle_item_timer(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -923,7 +933,7 @@ void handle_item_proc(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -934,7 +944,7 @@ void handle_item_loot(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -945,7 +955,7 @@ void handle_item_equip(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -956,7 +966,7 @@ void handle_item_augment(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -967,7 +977,7 @@ void handle_item_augment_insert(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -978,7 +988,7 @@ void handle_item_augment_remove(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -989,7 +999,7 @@ void handle_item_null(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1000,7 +1010,7 @@ void handle_item_timer_pause_resume_start(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1011,7 +1021,7 @@ void handle_item_timer_stop(
 	Client* client,
 	EQ::ItemInstance* item,
 	Mob *mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1023,7 +1033,7 @@ void handle_spell_event(
 	Mob* mob,
 	Client* client,
 	uint32 spell_id,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1034,7 +1044,7 @@ void handle_translocate_finish(
 	Mob* mob,
 	Client* client,
 	uint32 spell_id,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1045,7 +1055,7 @@ void handle_spell_null(
 	Mob* mob,
 	Client* client,
 	uint32 spell_id,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1055,7 +1065,7 @@ void handle_encounter_timer(
 	QuestInterface *parse,
 	lua_State* L,
 	Encounter* encounter,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1064,7 +1074,7 @@ void handle_encounter_load(
 	QuestInterface *parse,
 	lua_State* L,
 	Encounter* encounter,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1073,7 +1083,7 @@ void handle_encounter_unload(
 	QuestInterface *parse,
 	lua_State* L,
 	Encounter* encounter,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1082,7 +1092,7 @@ void handle_encounter_null(
 	QuestInterface *parse,
 	lua_State* L,
 	Encounter* encounter,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1093,7 +1103,7 @@ void handle_bot_null(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1103,7 +1113,7 @@ void handle_bot_cast(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1113,7 +1123,7 @@ void handle_bot_combat(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1123,7 +1133,7 @@ void handle_bot_death(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1133,7 +1143,7 @@ void handle_bot_popup_response(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1143,7 +1153,7 @@ void handle_bot_say(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1153,7 +1163,7 @@ void handle_bot_signal(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1163,7 +1173,7 @@ void handle_bot_slay(
 	lua_State* L,
 	Bot* bot,
 	Mob *init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1173,7 +1183,7 @@ void handle_bot_target_change(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1183,7 +1193,7 @@ void handle_bot_timer(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1193,7 +1203,7 @@ void handle_bot_trade(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1203,7 +1213,7 @@ void handle_bot_use_skill(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1213,7 +1223,7 @@ void handle_bot_payload(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1223,7 +1233,7 @@ void handle_bot_equip_item(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1233,7 +1243,7 @@ void handle_bot_damage(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1243,7 +1253,7 @@ void handle_bot_level_up(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1253,7 +1263,7 @@ void handle_bot_level_down(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1263,7 +1273,7 @@ void handle_bot_timer_pause_resume_start(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1273,7 +1283,7 @@ void handle_bot_timer_stop(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1283,7 +1293,7 @@ void handle_bot_entity_variable(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1293,7 +1303,7 @@ void handle_bot_spell_blocked(
 	lua_State* L,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1303,7 +1313,7 @@ void handle_zone_null(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1312,7 +1322,7 @@ void handle_zone_click_door(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1321,7 +1331,7 @@ void handle_zone_click_object(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1330,7 +1340,7 @@ void handle_zone_death(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1339,7 +1349,7 @@ void handle_zone_despawn(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1348,7 +1358,7 @@ void handle_zone_enter(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1357,7 +1367,7 @@ void handle_zone_loot(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1366,7 +1376,7 @@ void handle_zone_payload(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1375,7 +1385,7 @@ void handle_zone_pickup(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1384,7 +1394,7 @@ void handle_zone_popup(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1393,7 +1403,7 @@ void handle_zone_signal(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1402,7 +1412,7 @@ void handle_zone_spawn(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1411,7 +1421,7 @@ void handle_zone_timer(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1420,7 +1430,7 @@ void handle_zone_timer_pause_resume_start(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -1429,7 +1439,7 @@ void handle_zone_timer_stop(
 	QuestInterface *parse,
 	lua_State* L,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any> *extra_pointers
 );
@@ -88,7 +88,9 @@ extern volatile bool is_zone_loaded;
 #include "../common/path_manager.h"
 #include "../common/database/database_update.h"
 #include "../common/skill_caps.h"
+#include "../common/timer_wheel.h"
 #include "zone_cli.h"
+#include "character_save_queue.h"
 
 EntityList  entity_list;
 WorldServer worldserver;
@@ -487,6 +489,10 @@ int main(int argc, char **argv)
 		ZoneCLI::CommandHandler(argc, argv);
 	}
 
+	if (RuleB(Character, AsyncSaves)) {
+		CharacterSaveQueue::Instance()->Start();
+	}
+
 	Timer InterserverTimer(INTERSERVER_TIMER); // does MySQL pings and auto-reconnect
 	Timer UpdateWhoTimer(RuleI(Zone, UpdateWhoTimer) * 1000); // updates who list every 2 minutes
 	Timer WorldserverProcess(1000);
@@ -560,6 +566,13 @@ int main(int argc, char **argv)
 			opts.reliable_stream_options.resend_delay_min    = RuleI(Network, ResendDelayMinMS);
 			opts.reliable_stream_options.resend_delay_max    = RuleI(Network, ResendDelayMaxMS);
 			opts.reliable_stream_options.outgoing_data_rate  = RuleR(Network, ClientDataRate);
+			opts.reliable_stream_options.recv_mmsg           = RuleB(Network, BatchedReceive);
+			opts.network_thread                              = RuleB(Network, DedicatedThread);
+			opts.reliable_stream_options.compression_capture_file = RuleS(Network, CompressionCaptureFile);
+			if (!EQ::Net::ParseCompressionPolicy(RuleS(Network, CompressionPolicy), opts.reliable_stream_options.compression_policy)) {
+				LogWarning("Ignoring malformed Network:CompressionPolicy [{}]", RuleS(Network, CompressionPolicy));
+			}
+
 			eqsm      = std::make_unique<EQ::Net::EQStreamManager>(opts);
 			eqsf_open = true;
 
@@ -648,6 +661,9 @@ int main(int argc, char **argv)
 				entity_list.UpdateWho();
 			}
 		}
+
+		// run whatever wheel-attached timers came due this tick
+		TimerWheel::Instance()->Advance(Timer::GetCurrentTime());
 	};
 
 	EQ::Timer process_timer(loop_fn);
@@ -658,6 +674,9 @@ int main(int argc, char **argv)
 	entity_list.Clear();
 	entity_list.RemoveAllEncounters(); // gotta do it manually or rewrite lots of shit :P
 
+	// clients flush their own pending saves as they are destroyed, drain anything left before tearing down
+	CharacterSaveQueue::Instance()->Stop();
+
 	parse->ClearInterfaces();
 
 #ifdef EMBPERL
@@ -258,7 +258,22 @@ bool Map::CheckLoS(glm::vec3 myloc, glm::vec3 oloc) const {
 	if(!imp)
 		return false;
 
-	return !imp->rm->raycast((const RmReal*)&myloc, (const RmReal*)&oloc, nullptr, nullptr, nullptr);
+	return !imp->rm->occluded((const RmReal*)&myloc, (const RmReal*)&oloc);
+}
+
+// CheckLoS from one point to many, e.g. an AE caster to every target in range, in a single pass over the BVH
+void Map::CheckLoSBatch(const glm::vec3 &myloc, const std::vector<glm::vec3> &olocs, std::vector<bool> &results) const {
+	results.assign(olocs.size(), false);
+	if (!imp || olocs.empty())
+		return;
+
+	std::vector<glm::vec3> from(olocs.size(), myloc);
+	std::unique_ptr<bool[]> occluded(new bool[olocs.size()]);
+	imp->rm->occludedBatch((const RmReal*)from.data(), (const RmReal*)olocs.data(), (RmUint32)olocs.size(), occluded.get());
+
+	for (size_t i = 0; i < olocs.size(); ++i) {
+		results[i] = !occluded[i];
+	}
 }
 
 // returns true if a collision happens
@@ -269,6 +284,10 @@ bool Map::DoCollisionCheck(glm::vec3 myloc, glm::vec3 oloc, glm::vec3 &outnorm,
 	return imp->rm->raycast((const RmReal*)&myloc, (const RmReal*)&oloc, nullptr, (RmReal *)&outnorm, (RmReal *)&distance);
 }
 
+RaycastMesh *Map::GetRaycastMesh() const {
+	return imp ? imp->rm : nullptr;
+}
+
 Map *Map::LoadMapFile(std::string file) {
 	std::transform(file.begin(), file.end(), file.begin(), ::tolower);
 	std::string filename = fmt::format("{}/base/{}.map", PathManager::Instance()->GetMapsPath(), file);
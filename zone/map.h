@@ -24,6 +24,7 @@
 
 #include "position.h"
 #include <stdio.h>
+#include <vector>
 
 #include "zone_config.h"
 
@@ -31,6 +32,8 @@
 
 extern const ZoneConfig *Config;
 
+class RaycastMesh;
+
 class Map
 {
 public:
@@ -44,6 +47,7 @@ public:
 	bool LineIntersectsZone(glm::vec3 start, glm::vec3 end, float step, glm::vec3 *result) const;
 	bool LineIntersectsZoneNoZLeaps(glm::vec3 start, glm::vec3 end, float step_mag, glm::vec3 *result) const;
 	bool CheckLoS(glm::vec3 myloc, glm::vec3 oloc) const;
+	void CheckLoSBatch(const glm::vec3 &myloc, const std::vector<glm::vec3> &olocs, std::vector<bool> &results) const;
 	bool DoCollisionCheck(glm::vec3 myloc, glm::vec3 oloc, glm::vec3 &outnorm, float &distance) const;
 
 #ifdef USE_MAP_MMFS
@@ -53,6 +57,9 @@ public:
 #endif
 
 	static Map *LoadMapFile(std::string file);
+
+	// the underlying mesh, for tools and benchmarks that need the raw queries
+	RaycastMesh *GetRaycastMesh() const;
 private:
 	void RotateVertex(glm::vec3 &v, float rx, float ry, float rz);
 	void ScaleVertex(glm::vec3 &v, float sx, float sy, float sz);
@@ -19,6 +19,7 @@
 #include "../common/data_verification.h"
 #include "../common/spdat.h"
 #include "../common/strings.h"
+#include "../common/timer_wheel.h"
 #include "../common/misc_functions.h"
 
 #include "../common/repositories/bot_data_repository.h"
@@ -44,6 +45,8 @@ extern EntityList entity_list;
 extern Zone* zone;
 extern WorldServer worldserver;
 
+uint32 Mob::s_bonus_generation = 0;
+
 Mob::Mob(
 	const char *in_name,
 	const char *in_lastname,
@@ -139,6 +142,8 @@ Mob::Mob(
 	mMovementManager = &MobMovementManager::Get();
 	mMovementManager->AddMob(this);
 
+	m_clear_wearchange_cache_timer.Attach(TimerWheel::Instance(), [this]() { m_last_seen_wearchange.clear(); });
+
 	targeted          = 0;
 	currently_fleeing = false;
 
@@ -563,6 +568,11 @@ Mob::~Mob()
 
 	entity_list.RemoveFromTargets(this, true);
 
+	if (target) {
+		target->m_targeted_by.erase(this);
+		target = nullptr;
+	}
+
 	if (trade) {
 		Mob *with = trade->With();
 		if (with && with->IsClient()) {
@@ -1502,20 +1512,20 @@ void Mob::CreateHPPacket(EQApplicationPacket* app)
 	// hp event
 	if (IsNPC() && (GetNextHPEvent() > 0)) {
 		if (ds->hp < GetNextHPEvent()) {
-			std::string export_string = fmt::format("{}", GetNextHPEvent());
+			std::vector<std::any> args = { GetNextHPEvent() };
 			SetNextHPEvent(-1);
 			if (parse->HasQuestSub(CastToNPC()->GetNPCTypeID(), EVENT_HP)) {
-				parse->EventNPC(EVENT_HP, CastToNPC(), nullptr, export_string, 0);
+				parse->EventNPC(EVENT_HP, CastToNPC(), nullptr, "", 0, &args);
 			}
 		}
 	}
 
 	if (IsNPC() && (GetNextIncHPEvent() > 0)) {
 		if (ds->hp > GetNextIncHPEvent()) {
-			std::string export_string = fmt::format("{}", GetNextIncHPEvent());
+			std::vector<std::any> args = { GetNextIncHPEvent() };
 			SetNextIncHPEvent(-1);
 			if (parse->HasQuestSub(CastToNPC()->GetNPCTypeID(), EVENT_HP)) {
-				parse->EventNPC(EVENT_HP, CastToNPC(), nullptr, export_string, 1);
+				parse->EventNPC(EVENT_HP, CastToNPC(), nullptr, "", 1, &args);
 			}
 		}
 	}
@@ -5513,7 +5523,16 @@ void Mob::SetTarget(Mob *mob)
 		return;
 	}
 
+	if (target) {
+		target->m_targeted_by.erase(this);
+	}
+
 	target = mob;
+
+	if (target) {
+		target->m_targeted_by.insert(this);
+	}
+
 	entity_list.UpdateHoTT(this);
 
 	if (IsClient() && CastToClient()->admin > AccountStatus::GMMgmt) {
@@ -8162,6 +8181,11 @@ void Mob::DeleteBucket(std::string bucket_name)
 	k.key = bucket_name;
 
 	DataBucket::DeleteData(k);
+
+	// heroic stat scaling can read its multipliers from this mob's buckets
+	if (RuleB(Character, HeroicStatsUseDataBucketsToScale)) {
+		SetBonusesDirty(BonusLayer::Items);
+	}
 }
 
 std::string Mob::GetBucket(std::string bucket_name)
@@ -8213,6 +8237,10 @@ void Mob::SetBucket(std::string bucket_name, std::string bucket_value, std::stri
 	k.value   = bucket_value;
 
 	DataBucket::SetData(k);
+
+	if (RuleB(Character, HeroicStatsUseDataBucketsToScale)) {
+		SetBonusesDirty(BonusLayer::Items);
+	}
 }
 
 std::string Mob::GetMobDescription()
@@ -34,6 +34,7 @@
 
 #include <any>
 #include <set>
+#include <unordered_set>
 #include <vector>
 #include <memory>
 
@@ -94,6 +95,14 @@ struct AppearanceStruct {
 };
 
 class DataBucketKey;
+
+namespace BonusLayer {
+	constexpr uint8 Items  = (1 << 0); // worn, tribute, heroic and edible item bonuses
+	constexpr uint8 AAs    = (1 << 1);
+	constexpr uint8 Spells = (1 << 2);
+	constexpr uint8 All    = (Items | AAs | Spells);
+}
+
 class Mob : public Entity {
 public:
 	enum CLIENT_CONN_STATUS { CLIENT_CONNECTING, CLIENT_CONNECTED, CLIENT_LINKDEAD,
@@ -486,6 +495,10 @@ public:
 	uint16 FindBuffBySlot(int slot);
 	uint32 BuffCount(bool is_beneficial = true, bool is_detrimental = true);
 	bool FindType(uint16 type, bool bOffensive = false, uint16 threshold = 100);
+	// rebuilds the active buff effect bits from the buff slots, call after writing buffs[] outside AddBuff / BuffFadeBySlot
+	void RefreshActiveBuffEffects();
+	// true when m_active_buff_effects can answer for this effect, resyncs the bits after a spell reload
+	bool CanUseActiveBuffEffects(int effect);
 	int16 GetBuffSlotFromType(uint16 type);
 	uint16 GetSpellIDFromSlot(uint8 slot);
 	int CountDispellableBuffs();
@@ -607,6 +620,7 @@ public:
 	inline Mob* GetTarget() const { return target; }
 	std::string GetTargetDescription(Mob* target, uint8 description_type = TargetDescriptionType::LCSelf, uint16 entity_id_override = 0);
 	virtual void SetTarget(Mob* mob);
+	inline const std::unordered_set<Mob *> &GetTargetedBy() const { return m_targeted_by; }
 	inline bool HasTargetReflection() const { return (target && target != this && target->target == this); }
 	virtual inline float GetHPRatio() const { return max_hp == 0 ? 0 : ((float) current_hp / max_hp * 100); }
 	virtual inline int GetIntHPRatio() const { return max_hp == 0 ? 0 : static_cast<int>(GetHPRatio()); }
@@ -705,6 +719,10 @@ public:
 	virtual int32 GetHealAmt() const { return 0; }
 	virtual int32 GetSpellDmg() const { return 0; }
 	void ProcessItemCaps();
+	// Client::CalcBonuses only rebuilds the layers flagged here, everything else comes from its cache
+	inline void SetBonusesDirty(uint8 layers = BonusLayer::All) { m_dirty_bonus_layers |= layers; }
+	// for reloads that change bonus inputs outside any one mob (rules, AA data)
+	static void InvalidateAllBonusLayers() { s_bonus_generation++; }
 	virtual int32 CalcItemATKCap() { return 0; }
 	virtual bool IsSitting() const { return false; }
 
@@ -796,9 +814,14 @@ public:
 	void RemoveFromFeignMemory(Mob* attacker);
 	void ClearFeignMemory();
 	bool IsOnFeignMemory(Mob *attacker) const;
+	const std::set<uint32> &GetFeignMemoryList() const { return feign_memory_list; }
+	void AddAggroHolder(Mob *holder, uint8 type);
+	void RemoveAggroHolder(Mob *holder, uint8 type);
+	std::vector<Mob *> GetAggroHolders(uint8 type = AggroHolder::All);
 	void PrintHateListToClient(Client *who) { hate_list.PrintHateListToClient(who); }
-	std::list<struct_HateList*>& GetHateList() { return hate_list.GetHateList(); }
+	std::vector<struct_HateList*>& GetHateList() { return hate_list.GetHateList(); }
 	bool CheckLosFN(Mob* other);
+	void CheckLosFN(const std::vector<Mob *> &others, std::vector<bool> &results);
 	bool CheckLosFN(float posX, float posY, float posZ, float mobSize);
 	static bool CheckLosFN(glm::vec3 posWatcher, float sizeWatcher, glm::vec3 posTarget, float sizeTarget);
 	virtual bool CheckWaterLoS(Mob* m);
@@ -810,7 +833,7 @@ public:
 	inline bool CheckLastLosState() const { return last_los_check; }
 	std::string GetMobDescription();
 
-	std::list<struct_HateList*> GetFilteredHateList(
+	std::vector<struct_HateList*> GetFilteredHateList(
 		EntityFilterType filter_type = EntityFilterType::All,
 		uint32 distance = 0
 	) {
@@ -1437,7 +1460,7 @@ public:
 	uint32 GetAA(uint32 rank_id, uint32 *charges = nullptr) const;
 	uint32 GetAAByAAID(uint32 aa_id, uint32 *charges = nullptr) const;
 	bool SetAA(uint32 rank_id, uint32 new_value, uint32 charges = 0);
-	void ClearAAs() { aa_ranks.clear(); }
+	void ClearAAs() { aa_ranks.clear(); SetBonusesDirty(BonusLayer::AAs); }
 	bool CanUseAlternateAdvancementRank(AA::Rank *rank);
 	bool CanPurchaseAlternateAdvancementRank(AA::Rank *rank, bool check_price, bool check_grant);
 	int GetAlternateAdvancementCooldownReduction(AA::Rank *rank_in);
@@ -1590,6 +1613,10 @@ protected:
 	uint8 maxlevel;
 	uint32 scalerate;
 	Buffs_Struct *buffs;
+	SpellEffectBitset m_active_buff_effects; // union of the effect bits of every spell in buffs[]
+	uint32 m_active_buff_effects_generation = 0; // spell effect index generation the bits were built from
+	uint8 m_dirty_bonus_layers = BonusLayer::All;
+	static uint32 s_bonus_generation;
 	StatBonuses itembonuses;
 	StatBonuses spellbonuses;
 	StatBonuses aabonuses;
@@ -1843,6 +1870,12 @@ protected:
 	uint32 time_until_can_move;
 	HateList hate_list;
 	std::set<uint32> feign_memory_list;
+	// entity ids of the mobs that have us on their hate list, rampage list or feign memory, with AggroHolder bits.
+	// A superset: bits are dropped eagerly where cheap and otherwise left for callers to re-check against the holder
+	std::unordered_map<uint16, uint8> m_aggro_holders;
+	// mobs whose target is us, kept by SetTarget so HP and buff broadcasts skip the client walk. Held by pointer
+	// rather than entity id since clients change ids on death, ~Mob takes itself out of its target's set
+	std::unordered_set<Mob *> m_targeted_by;
 	// This is to keep track of the current (one only) faction mod (alliance)
 	uint32 current_alliance_faction;
 	int32 current_alliance_mod;
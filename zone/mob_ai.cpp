@@ -848,6 +848,7 @@ void Client::AI_Process()
 					remembered_feigned_mobid = feign_memory_list.erase(remembered_feigned_mobid);
 				} else if (!remembered_mob->GetFeigned()) {
 					AddToHateList(remembered_mob,1);
+					remembered_mob->RemoveAggroHolder(this, AggroHolder::FeignMemory);
 					remembered_feigned_mobid = feign_memory_list.erase(remembered_feigned_mobid);
 					break;
 				} else {
@@ -1377,6 +1378,7 @@ void Mob::AI_Process() {
 				}
 				else if (!remembered_mob->GetFeigned()) {
 					AddToHateList(remembered_mob, 1);
+					remembered_mob->RemoveAggroHolder(this, AggroHolder::FeignMemory);
 					remembered_feigned_mobid = feign_memory_list.erase(remembered_feigned_mobid);
 					break;
 				}
@@ -1755,7 +1757,9 @@ void Mob::AI_Event_Engaged(Mob *attacker, bool yell_for_help)
 
 	SetAppearance(eaStanding);
 
-	parse->EventBotMerc(EVENT_COMBAT, this, attacker, [&] { return "1"; });
+	std::vector<std::any> args = { true };
+
+	parse->EventBotMerc(EVENT_COMBAT, this, attacker, []() { return ""; }, 0, &args);
 
 	if (IsNPC()) {
 		CastToNPC()->AIautocastspell_timer->Start(300, false);
@@ -1781,7 +1785,7 @@ void Mob::AI_Event_Engaged(Mob *attacker, bool yell_for_help)
 			if (attacker->GetHP() > 0) {
 				if (!CastToNPC()->GetCombatEvent() && GetHP() > 0) {
 					if (parse->HasQuestSub(GetNPCTypeID(), EVENT_COMBAT)) {
-						parse->EventNPC(EVENT_COMBAT, CastToNPC(), attacker, "1", 0);
+						parse->EventNPC(EVENT_COMBAT, CastToNPC(), attacker, "", 0, &args);
 					}
 
 					if (emoteid) {
@@ -1824,7 +1828,9 @@ void Mob::AI_Event_NoLongerEngaged() {
 			entity_list.GetNPCByID(GetID())
 		) {
 			if (parse->HasQuestSub(GetNPCTypeID(), EVENT_COMBAT)) {
-				parse->EventNPC(EVENT_COMBAT, CastToNPC(), nullptr, "0", 0);
+				std::vector<std::any> args = { false };
+
+				parse->EventNPC(EVENT_COMBAT, CastToNPC(), nullptr, "", 0, &args);
 			}
 
 			const uint32 emote_id = CastToNPC()->GetEmoteID();
@@ -1836,7 +1842,9 @@ void Mob::AI_Event_NoLongerEngaged() {
 			CastToNPC()->SetCombatEvent(false);
 		}
 	} else {
-		parse->EventBotMerc(EVENT_COMBAT, this, nullptr, [&]() { return "0"; });
+		std::vector<std::any> args = { false };
+
+		parse->EventBotMerc(EVENT_COMBAT, this, nullptr, []() { return ""; }, 0, &args);
 	}
 }
 
@@ -2032,11 +2040,19 @@ bool Mob::AddRampage(Mob *mob)
 		}
 	}
 	RampageArray.push_back(mob->GetID());
+	mob->AddAggroHolder(this, AggroHolder::Rampage);
 	return true;
 }
 
 void Mob::ClearRampage()
 {
+	for (const auto &id : RampageArray) {
+		Mob *m = entity_list.GetMob(id);
+		if (m) {
+			m->RemoveAggroHolder(this, AggroHolder::Rampage);
+		}
+	}
+
 	RampageArray.clear();
 }
 
@@ -2063,6 +2079,8 @@ void Mob::RemoveFromRampageList(Mob* mob, bool remove_feigned)
 				RampageArray[i] = 0;
 			}
 		}
+
+		mob->RemoveAggroHolder(this, AggroHolder::Rampage);
 	}
 }
 
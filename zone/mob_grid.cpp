@@ -0,0 +1,118 @@
+#include "mob_grid.h"
+
+void MobGrid::SetCellSize(float cell_size)
+{
+	if (cell_size <= 0.0f || cell_size == m_cell_size) {
+		return;
+	}
+
+	m_cell_size         = cell_size;
+	m_inverse_cell_size = 1.0f / cell_size;
+
+	// re-bin everything against the new cell size
+	auto entries = m_entries;
+	std::vector<std::pair<uint16, Mob *>> mobs;
+	mobs.reserve(entries.size());
+	for (const auto &c : m_cells) {
+		for (const auto &e : c.second) {
+			mobs.emplace_back(e.id, e.mob);
+		}
+	}
+
+	Clear();
+
+	for (const auto &[id, mob] : mobs) {
+		const auto &s = entries[id];
+		Add(id, mob, s.x, s.y);
+	}
+}
+
+void MobGrid::Add(uint16 id, Mob *mob, float x, float y)
+{
+	if (!mob) {
+		return;
+	}
+
+	auto it = m_entries.find(id);
+	if (it != m_entries.end()) {
+		Update(id, mob, x, y);
+		return;
+	}
+
+	Slot slot{};
+	slot.x = x;
+	slot.y = y;
+
+	Insert(id, mob, CellKey(CellCoord(x), CellCoord(y)), slot);
+	m_entries.emplace(id, slot);
+}
+
+void MobGrid::Update(uint16 id, Mob *mob, float x, float y)
+{
+	auto it = m_entries.find(id);
+	if (it == m_entries.end()) {
+		Add(id, mob, x, y);
+		return;
+	}
+
+	auto &slot = it->second;
+	slot.x = x;
+	slot.y = y;
+
+	const uint64 cell = CellKey(CellCoord(x), CellCoord(y));
+	if (cell == slot.cell) {
+		return;
+	}
+
+	Detach(slot);
+	Insert(id, mob, cell, slot);
+}
+
+void MobGrid::Remove(uint16 id)
+{
+	auto it = m_entries.find(id);
+	if (it == m_entries.end()) {
+		return;
+	}
+
+	Detach(it->second);
+	m_entries.erase(it);
+}
+
+void MobGrid::Clear()
+{
+	m_cells.clear();
+	m_entries.clear();
+}
+
+void MobGrid::Insert(uint16 id, Mob *mob, uint64 cell, Slot &slot)
+{
+	auto &bucket = m_cells[cell];
+
+	slot.cell  = cell;
+	slot.index = static_cast<uint32>(bucket.size());
+
+	bucket.push_back(Entry{id, mob});
+}
+
+void MobGrid::Detach(const Slot &slot)
+{
+	auto c = m_cells.find(slot.cell);
+	if (c == m_cells.end()) {
+		return;
+	}
+
+	auto &bucket = c->second;
+
+	// swap-remove and fix up the index of whoever was moved into the hole
+	if (slot.index + 1 < bucket.size()) {
+		bucket[slot.index] = bucket.back();
+		m_entries[bucket[slot.index].id].index = slot.index;
+	}
+
+	bucket.pop_back();
+
+	if (bucket.empty()) {
+		m_cells.erase(c);
+	}
+}
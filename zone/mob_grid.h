@@ -0,0 +1,109 @@
+#ifndef EQEMU_MOB_GRID_H
+#define EQEMU_MOB_GRID_H
+
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+#include "../common/types.h"
+
+class Mob;
+
+/**
+ * Uniform spatial hash over the zone's mob_list
+ *
+ * Mobs are binned by their x/y position into square cells of a fixed size
+ * (sized off Range:MobCloseScanDistance) so that range queries only have to
+ * visit the cells overlapping the query square instead of the whole zone.
+ *
+ * The grid only knows about coordinates, callers still run their own exact
+ * distance checks against whatever comes back from a query
+ */
+class MobGrid {
+public:
+	struct Entry {
+		uint16 id;
+		Mob    *mob;
+	};
+
+	void SetCellSize(float cell_size);
+	inline float GetCellSize() const { return m_cell_size; }
+
+	void Add(uint16 id, Mob *mob, float x, float y);
+	void Update(uint16 id, Mob *mob, float x, float y);
+	void Remove(uint16 id);
+	void Clear();
+
+	inline size_t Size() const { return m_entries.size(); }
+	inline size_t CellCount() const { return m_cells.size(); }
+
+	// visits every mob in a cell overlapping the square [x - range, x + range] x [y - range, y + range]
+	template<typename Fn>
+	void ForEachInRange(float x, float y, float range, Fn &&fn) const
+	{
+		const int32 min_x = CellCoord(x - range);
+		const int32 max_x = CellCoord(x + range);
+		const int32 min_y = CellCoord(y - range);
+		const int32 max_y = CellCoord(y + range);
+
+		const uint64 span = static_cast<uint64>(max_x - min_x + 1) * static_cast<uint64>(max_y - min_y + 1);
+
+		// very large ranges cover more cells than are occupied, walk the occupied cells instead
+		if (span > m_cells.size()) {
+			for (const auto &c : m_cells) {
+				const int32 cx = static_cast<int32>(c.first >> 32);
+				const int32 cy = static_cast<int32>(c.first & 0xFFFFFFFF);
+				if (cx < min_x || cx > max_x || cy < min_y || cy > max_y) {
+					continue;
+				}
+
+				for (const auto &e : c.second) {
+					fn(e.mob);
+				}
+			}
+
+			return;
+		}
+
+		for (int32 cx = min_x; cx <= max_x; ++cx) {
+			for (int32 cy = min_y; cy <= max_y; ++cy) {
+				auto it = m_cells.find(CellKey(cx, cy));
+				if (it == m_cells.end()) {
+					continue;
+				}
+
+				for (const auto &e : it->second) {
+					fn(e.mob);
+				}
+			}
+		}
+	}
+
+private:
+	struct Slot {
+		uint64 cell;
+		uint32 index;
+		float  x;
+		float  y;
+	};
+
+	inline int32 CellCoord(float v) const
+	{
+		return static_cast<int32>(std::floor(v * m_inverse_cell_size));
+	}
+
+	static inline uint64 CellKey(int32 cx, int32 cy)
+	{
+		return (static_cast<uint64>(static_cast<uint32>(cx)) << 32) | static_cast<uint32>(cy);
+	}
+
+	void Insert(uint16 id, Mob *mob, uint64 cell, Slot &slot);
+	void Detach(const Slot &slot);
+
+	float m_cell_size         = 0.0f;
+	float m_inverse_cell_size = 0.0f;
+
+	std::unordered_map<uint64, std::vector<Entry>> m_cells;
+	std::unordered_map<uint16, Slot>               m_entries;
+};
+
+#endif //EQEMU_MOB_GRID_H
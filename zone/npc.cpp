@@ -24,6 +24,7 @@
 #include "../common/seperator.h"
 #include "../common/spdat.h"
 #include "../common/strings.h"
+#include "../common/timer_wheel.h"
 #include "../common/emu_versions.h"
 #include "../common/features.h"
 #include "../common/item_instance.h"
@@ -146,6 +147,12 @@ NPC::NPC(const NPCType *npc_type_data, Spawn2 *in_respawn, const glm::vec4 &posi
 	  m_GuardPoint(-1, -1, -1, 0),
 	  m_GuardPointSaved(0, 0, 0, 0)
 {
+	qglobal_purge_timer.Attach(TimerWheel::Instance(), [this]() {
+		if (qGlobals) {
+			qGlobals->PurgeExpiredGlobals();
+		}
+	});
+
 	//What is the point of this, since the names get mangled..
 	Mob *mob = entity_list.GetMob(name);
 	if (mob != nullptr) {
@@ -632,10 +639,6 @@ bool NPC::Process()
 	}
 
 	if (tic_timer.Check()) {
-		if (m_clear_wearchange_cache_timer.Check()) {
-			m_last_seen_wearchange.clear();
-		}
-
 		if (parse->HasQuestSub(GetNPCTypeID(), EVENT_TICK)) {
 			parse->EventNPC(EVENT_TICK, this, nullptr, "", 0);
 		}
@@ -796,14 +799,6 @@ bool NPC::Process()
 			assist_cap_timer.Start(RuleI(Combat, NPCAssistCapTimer));
 	}
 
-	if(qGlobals)
-	{
-		if(qglobal_purge_timer.Check())
-		{
-			qGlobals->PurgeExpiredGlobals();
-		}
-	}
-
 	if (bot_attack_flag_timer.Check()) {
 		bot_attack_flag_timer.Disable();
 		ClearBotAttackFlags();
@@ -635,6 +635,7 @@ public:
 			buffs[i].UpdateClient      = b.UpdateClient;
 			i++;
 		}
+		RefreshActiveBuffEffects();
 		CalcBonuses();
 	}
 
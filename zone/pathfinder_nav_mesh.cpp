@@ -1,5 +1,7 @@
+#include <list>
 #include <memory>
 #include <stdio.h>
+#include <unordered_map>
 #include <vector>
 #include "pathfinder_nav_mesh.h"
 #include <DetourCommon.h>
@@ -12,17 +14,177 @@
 
 extern Zone *zone;
 
+// idle queries kept around for reuse, pathing is driven from the zone thread so this rarely grows past one
+static const size_t max_pooled_queries = 4;
+
+struct RouteCacheKey
+{
+	dtPolyRef start_ref;
+	dtPolyRef end_ref;
+	int       flags;
+	int       max_polys;
+	uint32    cost_profile;
+
+	bool operator==(const RouteCacheKey &o) const
+	{
+		return start_ref == o.start_ref && end_ref == o.end_ref && flags == o.flags &&
+			max_polys == o.max_polys && cost_profile == o.cost_profile;
+	}
+};
+
+struct RouteCacheKeyHash
+{
+	size_t operator()(const RouteCacheKey &k) const
+	{
+		size_t h = std::hash<dtPolyRef>()(k.start_ref);
+		h ^= std::hash<dtPolyRef>()(k.end_ref) + 0x9e3779b9 + (h << 6) + (h >> 2);
+		h ^= std::hash<int>()(k.flags) + 0x9e3779b9 + (h << 6) + (h >> 2);
+		h ^= std::hash<int>()(k.max_polys) + 0x9e3779b9 + (h << 6) + (h >> 2);
+		h ^= std::hash<uint32>()(k.cost_profile) + 0x9e3779b9 + (h << 6) + (h >> 2);
+		return h;
+	}
+};
+
+struct PooledQuery
+{
+	dtNavMeshQuery *query;
+	int            max_nodes;
+};
+
 struct PathfinderNavmesh::Implementation
 {
 	dtNavMesh *nav_mesh;
-	dtNavMeshQuery *query;
+
+	// pre-initialized queries, init() reallocates the node pool so we only pay for it once per query
+	std::vector<PooledQuery> query_pool;
+
+	// LRU of polygon corridors, the straight path is still rebuilt per request from the caller's exact positions
+	typedef std::list<std::pair<RouteCacheKey, std::vector<dtPolyRef>>> RouteList;
+	RouteList                                                           route_list;
+	std::unordered_map<RouteCacheKey, RouteList::iterator, RouteCacheKeyHash> route_index;
+	uint64                                                              route_hits;
+	uint64                                                              route_misses;
+
+	PooledQuery AcquireQuery()
+	{
+		const int max_nodes = RuleI(Pathing, MaxNavmeshNodes);
+
+		PooledQuery q = { nullptr, 0 };
+		if (!query_pool.empty()) {
+			q = query_pool.back();
+			query_pool.pop_back();
+		}
+		else {
+			q.query = dtAllocNavMeshQuery();
+		}
+
+		if (q.max_nodes != max_nodes) {
+			q.query->init(nav_mesh, max_nodes);
+			q.max_nodes = max_nodes;
+		}
+
+		return q;
+	}
+
+	void ReleaseQuery(const PooledQuery &q)
+	{
+		if (query_pool.size() >= max_pooled_queries) {
+			dtFreeNavMeshQuery(q.query);
+			return;
+		}
+
+		query_pool.push_back(q);
+	}
+
+	void ClearQueries()
+	{
+		for (auto &q : query_pool) {
+			dtFreeNavMeshQuery(q.query);
+		}
+
+		query_pool.clear();
+	}
+
+	void ClearRoutes()
+	{
+		route_index.clear();
+		route_list.clear();
+	}
+
+	dtStatus FindCorridor(
+		dtNavMeshQuery *query,
+		const dtQueryFilter &filter,
+		uint32 cost_profile,
+		dtPolyRef start_ref,
+		dtPolyRef end_ref,
+		const float *start_pos,
+		const float *end_pos,
+		dtPolyRef *path,
+		int *npoly,
+		int max_polys
+	)
+	{
+		const int capacity = RuleI(Pathing, NavmeshRouteCacheSize);
+		if (capacity <= 0) {
+			if (!route_list.empty()) {
+				ClearRoutes();
+			}
+
+			return query->findPath(start_ref, end_ref, start_pos, end_pos, &filter, path, npoly, max_polys);
+		}
+
+		RouteCacheKey key = { start_ref, end_ref, filter.getIncludeFlags(), max_polys, cost_profile };
+
+		auto it = route_index.find(key);
+		if (it != route_index.end()) {
+			route_list.splice(route_list.begin(), route_list, it->second);
+
+			auto &corridor = it->second->second;
+			*npoly = static_cast<int>(corridor.size());
+			std::copy(corridor.begin(), corridor.end(), path);
+
+			++route_hits;
+			return DT_SUCCESS;
+		}
+
+		++route_misses;
+
+		auto status = query->findPath(start_ref, end_ref, start_pos, end_pos, &filter, path, npoly, max_polys);
+		if (dtStatusFailed(status) || *npoly <= 0) {
+			return status;
+		}
+
+		route_list.emplace_front(key, std::vector<dtPolyRef>(path, path + *npoly));
+		route_index[key] = route_list.begin();
+
+		while (route_list.size() > static_cast<size_t>(capacity)) {
+			route_index.erase(route_list.back().first);
+			route_list.pop_back();
+		}
+
+		return status;
+	}
 };
 
+static uint32 HashCostProfile(const float *costs, size_t count)
+{
+	// FNV-1a over the raw cost bytes, only needs to tell differing filters apart
+	uint32 hash = 2166136261u;
+	auto   data = reinterpret_cast<const unsigned char *>(costs);
+	for (size_t i = 0; i < count * sizeof(float); ++i) {
+		hash ^= data[i];
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
 PathfinderNavmesh::PathfinderNavmesh(const std::string &path)
 {
 	m_impl = std::make_unique<Implementation>();
 	m_impl->nav_mesh = nullptr;
-	m_impl->query = nullptr;
+	m_impl->route_hits = 0;
+	m_impl->route_misses = 0;
 	Load(path);
 }
 
@@ -39,11 +201,16 @@ IPathfinder::IPath PathfinderNavmesh::FindRoute(const glm::vec3 &start, const gl
 		return IPath();
 	}
 
-	if (!m_impl->query) {
-		m_impl->query = dtAllocNavMeshQuery();
-	}
+	auto pooled = m_impl->AcquireQuery();
+	auto query  = pooled.query;
+	IPath route = FindRoute(query, start, end, partial, stuck, flags);
+	m_impl->ReleaseQuery(pooled);
 
-	m_impl->query->init(m_impl->nav_mesh, RuleI(Pathing, MaxNavmeshNodes));
+	return route;
+}
+
+IPathfinder::IPath PathfinderNavmesh::FindRoute(dtNavMeshQuery *query, const glm::vec3 &start, const glm::vec3 &end, bool &partial, bool &stuck, int flags)
+{
 	glm::vec3 current_location(start.x, start.z, start.y);
 	glm::vec3 dest_location(end.x, end.z, end.y);
 
@@ -64,8 +231,8 @@ IPathfinder::IPath PathfinderNavmesh::FindRoute(const glm::vec3 &start, const gl
 	dtPolyRef end_ref;
 	glm::vec3 ext(5.0f, 100.0f, 5.0f);
 
-	m_impl->query->findNearestPoly(&current_location[0], &ext[0], &filter, &start_ref, 0);
-	m_impl->query->findNearestPoly(&dest_location[0], &ext[0], &filter, &end_ref, 0);
+	query->findNearestPoly(&current_location[0], &ext[0], &filter, &start_ref, 0);
+	query->findNearestPoly(&dest_location[0], &ext[0], &filter, &end_ref, 0);
 
 	if (!start_ref || !end_ref) {
 		return IPath();
@@ -73,12 +240,12 @@ IPathfinder::IPath PathfinderNavmesh::FindRoute(const glm::vec3 &start, const gl
 
 	int npoly = 0;
 	dtPolyRef path[1024] = { 0 };
-	auto status = m_impl->query->findPath(start_ref, end_ref, &current_location[0], &dest_location[0], &filter, path, &npoly, 1024);
+	auto status = m_impl->FindCorridor(query, filter, 0, start_ref, end_ref, &current_location[0], &dest_location[0], path, &npoly, 1024);
 
 	if (npoly) {
 		glm::vec3 epos = dest_location;
 		if (path[npoly - 1] != end_ref) {
-			m_impl->query->closestPointOnPoly(path[npoly - 1], &dest_location[0], &epos[0], 0);
+			query->closestPointOnPoly(path[npoly - 1], &dest_location[0], &epos[0], 0);
 			partial = true;
 
 			auto dist = DistanceSquared(epos, current_location);
@@ -93,7 +260,7 @@ IPathfinder::IPath PathfinderNavmesh::FindRoute(const glm::vec3 &start, const gl
 		int n_straight_polys;
 		dtPolyRef straight_path_polys[2048];
 
-		status = m_impl->query->findStraightPath(&current_location[0], &epos[0], path, npoly,
+		status = query->findStraightPath(&current_location[0], &epos[0], path, npoly,
 			straight_path, straight_path_flags,
 			straight_path_polys, &n_straight_polys, 2048, DT_STRAIGHTPATH_AREA_CROSSINGS);
 
@@ -137,11 +304,16 @@ IPathfinder::IPath PathfinderNavmesh::FindPath(const glm::vec3 &start, const glm
 		return IPath();
 	}
 
-	if (!m_impl->query) {
-		m_impl->query = dtAllocNavMeshQuery();
-	}
+	auto pooled = m_impl->AcquireQuery();
+	auto query  = pooled.query;
+	IPath route = FindPath(query, start, end, partial, stuck, opts);
+	m_impl->ReleaseQuery(pooled);
+
+	return route;
+}
 
-	m_impl->query->init(m_impl->nav_mesh, RuleI(Pathing, MaxNavmeshNodes));
+IPathfinder::IPath PathfinderNavmesh::FindPath(dtNavMeshQuery *query, const glm::vec3 &start, const glm::vec3 &end, bool &partial, bool &stuck, const PathfinderOptions &opts)
+{
 	glm::vec3 current_location(start.x, start.z, start.y);
 	glm::vec3 dest_location(end.x, end.z, end.y);
 
@@ -163,21 +335,23 @@ IPathfinder::IPath PathfinderNavmesh::FindPath(const glm::vec3 &start, const glm
 	dtPolyRef end_ref;
 	glm::vec3 ext(10.0f, 200.0f, 10.0f);
 
-	m_impl->query->findNearestPoly(&current_location[0], &ext[0], &filter, &start_ref, 0);
-	m_impl->query->findNearestPoly(&dest_location[0], &ext[0], &filter, &end_ref, 0);
+	query->findNearestPoly(&current_location[0], &ext[0], &filter, &start_ref, 0);
+	query->findNearestPoly(&dest_location[0], &ext[0], &filter, &end_ref, 0);
 
 	if (!start_ref || !end_ref) {
 		return IPath();
 	}
 
+	const uint32 cost_profile = HashCostProfile(opts.flag_cost, sizeof(opts.flag_cost) / sizeof(opts.flag_cost[0]));
+
 	int npoly = 0;
 	dtPolyRef path[max_polys] = { 0 };
-	auto status = m_impl->query->findPath(start_ref, end_ref, &current_location[0], &dest_location[0], &filter, path, &npoly, max_polys);
+	auto status = m_impl->FindCorridor(query, filter, cost_profile, start_ref, end_ref, &current_location[0], &dest_location[0], path, &npoly, max_polys);
 
 	if (npoly) {
 		glm::vec3 epos = dest_location;
 		if (path[npoly - 1] != end_ref) {
-			m_impl->query->closestPointOnPoly(path[npoly - 1], &dest_location[0], &epos[0], 0);
+			query->closestPointOnPoly(path[npoly - 1], &dest_location[0], &epos[0], 0);
 			partial = true;
 
 			auto dist = DistanceSquared(epos, current_location);
@@ -191,7 +365,7 @@ IPathfinder::IPath PathfinderNavmesh::FindPath(const glm::vec3 &start, const glm
 		unsigned char straight_path_flags[max_polys];
 		dtPolyRef straight_path_polys[max_polys];
 
-		auto status = m_impl->query->findStraightPath(&current_location[0], &epos[0], path, npoly,
+		auto status = query->findStraightPath(&current_location[0], &epos[0], path, npoly,
 			(float*)&straight_path[0], straight_path_flags,
 			straight_path_polys, &n_straight_polys, 2048, DT_STRAIGHTPATH_AREA_CROSSINGS | DT_STRAIGHTPATH_ALL_CROSSINGS);
 
@@ -309,10 +483,8 @@ glm::vec3 PathfinderNavmesh::GetRandomLocation(const glm::vec3 &start, int flags
 		return glm::vec3(0.f);
 	}
 
-	if (!m_impl->query) {
-		m_impl->query = dtAllocNavMeshQuery();
-		m_impl->query->init(m_impl->nav_mesh, RuleI(Pathing, MaxNavmeshNodes));
-	}
+	auto pooled = m_impl->AcquireQuery();
+	auto query  = pooled.query;
 
 	dtQueryFilter filter;
 	filter.setIncludeFlags(flags);
@@ -334,19 +506,17 @@ glm::vec3 PathfinderNavmesh::GetRandomLocation(const glm::vec3 &start, int flags
 	glm::vec3 current_location(start.x, start.z, start.y);
 	glm::vec3 ext(5.0f, 100.0f, 5.0f);
 
-	m_impl->query->findNearestPoly(&current_location[0], &ext[0], &filter, &start_ref, 0);
+	query->findNearestPoly(&current_location[0], &ext[0], &filter, &start_ref, 0);
 
-	if (!start_ref)
+	glm::vec3 location(0.f);
+	if (start_ref && dtStatusSucceed(query->findRandomPointAroundCircle(start_ref, &current_location[0], 100.f, &filter, []() { return (float)zone->random.Real(0.0, 1.0); }, &randomRef, point)))
 	{
-		return glm::vec3(0.f);
+		location = glm::vec3(point[0], point[2], point[1]);
 	}
 
-	if (dtStatusSucceed(m_impl->query->findRandomPointAroundCircle(start_ref, &current_location[0], 100.f, &filter, []() { return (float)zone->random.Real(0.0, 1.0); }, &randomRef, point)))
-	{
-		return glm::vec3(point[0], point[2], point[1]);
-	}
+	m_impl->ReleaseQuery(pooled);
 
-	return glm::vec3(0.f);
+	return location;
 }
 
 void PathfinderNavmesh::DebugCommand(Client *c, const Seperator *sep)
@@ -354,6 +524,25 @@ void PathfinderNavmesh::DebugCommand(Client *c, const Seperator *sep)
 	if (sep->arg[1][0] == '\0' || !strcasecmp(sep->arg[1], "help"))
 	{
 		c->Message(Chat::White, "#path show: Plots a path from the user to their target.");
+		c->Message(Chat::White, "#path cache: Shows navmesh route cache statistics.");
+		return;
+	}
+
+	if (!strcasecmp(sep->arg[1], "cache"))
+	{
+		const uint64 lookups = m_impl->route_hits + m_impl->route_misses;
+		c->Message(
+			Chat::White,
+			fmt::format(
+				"Route Cache | Entries: {}/{} Hits: {} Misses: {} Hit Rate: {:.1f}% Pooled Queries: {}",
+				m_impl->route_list.size(),
+				RuleI(Pathing, NavmeshRouteCacheSize),
+				m_impl->route_hits,
+				m_impl->route_misses,
+				lookups ? (static_cast<double>(m_impl->route_hits) / lookups) * 100.0 : 0.0,
+				m_impl->query_pool.size()
+			).c_str()
+		);
 		return;
 	}
 
@@ -373,12 +562,13 @@ void PathfinderNavmesh::DebugCommand(Client *c, const Seperator *sep)
 
 void PathfinderNavmesh::Clear()
 {
+	// pooled queries and cached corridors both reference the mesh being freed
+	m_impl->ClearQueries();
+	m_impl->ClearRoutes();
+
 	if (m_impl->nav_mesh) {
 		dtFreeNavMesh(m_impl->nav_mesh);
-	}
-
-	if (m_impl->query) {
-		dtFreeNavMeshQuery(m_impl->query);
+		m_impl->nav_mesh = nullptr;
 	}
 }
 
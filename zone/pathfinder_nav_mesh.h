@@ -4,6 +4,8 @@
 #include <string>
 #include <DetourNavMesh.h>
 
+class dtNavMeshQuery;
+
 class PathfinderNavmesh : public IPathfinder
 {
 public:
@@ -18,6 +20,8 @@ public:
 private:
 	void Clear();
 	void Load(const std::string &path);
+	IPath FindRoute(dtNavMeshQuery *query, const glm::vec3 &start, const glm::vec3 &end, bool &partial, bool &stuck, int flags);
+	IPath FindPath(dtNavMeshQuery *query, const glm::vec3 &start, const glm::vec3 &end, bool &partial, bool &stuck, const PathfinderOptions &opts);
 	void ShowPath(Client *c, const glm::vec3 &start, const glm::vec3 &end);
 	dtStatus GetPolyHeightNoConnections(dtPolyRef ref, const float *pos, float *height) const;
 	dtStatus GetPolyHeightOnPath(const dtPolyRef *path, const int path_len, const glm::vec3 &pos, float *h) const;
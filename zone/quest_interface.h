@@ -30,13 +30,26 @@ namespace EQ {
 	class ItemInstance;
 }
 
+// EVENT_DAMAGE_GIVEN and EVENT_DAMAGE_TAKEN carry this in extra_pointers after the other mob, their data is empty
+struct QuestDamageEvent {
+	uint16 entity_id;
+	int64  damage;
+	uint16 spell_id;
+	int    skill_id;
+	bool   is_damage_shield;
+	bool   is_avoidable;
+	int8   buff_slot;
+	bool   is_buff_tic;
+	int    special_attack;
+};
+
 class QuestInterface {
 public:
 	virtual int EventNPC(
 		QuestEventID event_id,
 		NPC* npc,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -48,7 +61,7 @@ public:
 		QuestEventID event_id,
 		NPC* npc,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -59,7 +72,7 @@ public:
 	virtual int EventPlayer(
 		QuestEventID event_id,
 		Client* client,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -70,7 +83,7 @@ public:
 	virtual int EventGlobalPlayer(
 		QuestEventID event_id,
 		Client* client,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -83,7 +96,7 @@ public:
 		Client* client,
 		EQ::ItemInstance* inst,
 		Mob* mob,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -96,7 +109,7 @@ public:
 		Mob* mob,
 		Client* client,
 		uint32 spell_id,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -107,7 +120,7 @@ public:
 	virtual int EventEncounter(
 		QuestEventID event_id,
 		std::string encounter_name,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -119,7 +132,7 @@ public:
 		QuestEventID event_id,
 		Bot* bot,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -131,7 +144,7 @@ public:
 		QuestEventID event_id,
 		Bot* bot,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -143,7 +156,7 @@ public:
 		QuestEventID event_id,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -155,7 +168,7 @@ public:
 		QuestEventID event_id,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -166,7 +179,7 @@ public:
 	virtual int EventZone(
 		QuestEventID event_id,
 		Zone* zone,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -177,7 +190,7 @@ public:
 	virtual int EventGlobalZone(
 		QuestEventID event_id,
 		Zone* zone,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -273,7 +286,7 @@ public:
 		QuestEventID event_id,
 		NPC* npc,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -284,7 +297,7 @@ public:
 	virtual int DispatchEventPlayer(
 		QuestEventID event_id,
 		Client* client,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -297,7 +310,7 @@ public:
 		Client* client,
 		EQ::ItemInstance* inst,
 		Mob* mob,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -310,7 +323,7 @@ public:
 		Mob* mob,
 		Client* client,
 		uint32 spell_id,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -322,7 +335,7 @@ public:
 		QuestEventID event_id,
 		Bot* bot,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -334,7 +347,7 @@ public:
 		QuestEventID event_id,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -345,7 +358,7 @@ public:
 	virtual int DispatchEventZone(
 		QuestEventID event_id,
 		Zone* zone,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	)
@@ -30,6 +30,7 @@
 #include "../common/file.h"
 
 #include <stdio.h>
+#include <chrono>
 
 // an encounter can register events before the object is loaded
 // examples
@@ -40,6 +41,27 @@ const std::string ENCOUNTER_NO_ENTITY_ID = "-1";
 extern Zone* zone;
 extern void MapOpcodes();
 
+// times one top level Event* call into the collection's per event stats
+class EventStatsTimer {
+public:
+	EventStatsTimer(QuestParserCollection* collection, QuestEventID event_id)
+		: m_collection(collection), m_event_id(event_id), m_start(std::chrono::steady_clock::now()) {}
+
+	~EventStatsTimer()
+	{
+		const auto elapsed = std::chrono::steady_clock::now() - m_start;
+		m_collection->RecordEvent(
+			m_event_id,
+			static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count())
+		);
+	}
+
+private:
+	QuestParserCollection*                m_collection;
+	QuestEventID                          m_event_id;
+	std::chrono::steady_clock::time_point m_start;
+};
+
 QuestParserCollection::QuestParserCollection()
 {
 	_player_quest_status        = QuestUnloaded;
@@ -478,11 +500,13 @@ int QuestParserCollection::EventNPC(
 	QuestEventID event_id,
 	NPC* npc,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
 {
+	EventStatsTimer timer(this, event_id);
+
 	if (npc->IsResumedFromZoneSuspend() && npc->IsQueuedForCorpse()) {
 		return 0;
 	}
@@ -506,7 +530,7 @@ int QuestParserCollection::EventNPCLocal(
 	QuestEventID event_id,
 	NPC* npc,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -538,7 +562,7 @@ int QuestParserCollection::EventNPCGlobal(
 	QuestEventID event_id,
 	NPC* npc,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -565,11 +589,13 @@ int QuestParserCollection::EventNPCGlobal(
 int QuestParserCollection::EventPlayer(
 	QuestEventID event_id,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
 {
+	EventStatsTimer timer(this, event_id);
+
 	const int local_return   = EventPlayerLocal(event_id, client, data, extra_data, extra_pointers);
 	const int global_return  = EventPlayerGlobal(event_id, client, data, extra_data, extra_pointers);
 	const int default_return = DispatchEventPlayer(event_id, client, data, extra_data, extra_pointers);
@@ -588,7 +614,7 @@ int QuestParserCollection::EventPlayer(
 int QuestParserCollection::EventPlayerLocal(
 	QuestEventID event_id,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -615,7 +641,7 @@ int QuestParserCollection::EventPlayerLocal(
 int QuestParserCollection::EventPlayerGlobal(
 	QuestEventID event_id,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -644,11 +670,13 @@ int QuestParserCollection::EventItem(
 	Client* client,
 	EQ::ItemInstance* inst,
 	Mob* mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
 {
+	EventStatsTimer timer(this, event_id);
+
 	if (!inst) {
 		return 0;
 	}
@@ -720,11 +748,13 @@ int QuestParserCollection::EventSpell(
 	Mob* mob,
 	Client* client,
 	uint32 spell_id,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
 {
+	EventStatsTimer timer(this, event_id);
+
 	auto iter = _spell_quest_status.find(spell_id);
 	if (iter != _spell_quest_status.end()) {
 		//loaded or failed to load
@@ -785,11 +815,13 @@ int QuestParserCollection::EventSpell(
 int QuestParserCollection::EventEncounter(
 	QuestEventID event_id,
 	std::string encounter_name,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
 {
+	EventStatsTimer timer(this, event_id);
+
 	auto iter = _encounter_quest_status.find(encounter_name);
 	if (iter != _encounter_quest_status.end()) {
 		if (iter->second != QuestFailedToLoad) { // Loaded or failed to load
@@ -816,11 +848,13 @@ int QuestParserCollection::EventBot(
 	QuestEventID event_id,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
 {
+	EventStatsTimer timer(this, event_id);
+
 	const int local_return   = EventBotLocal(event_id, bot, init, data, extra_data, extra_pointers);
 	const int global_return  = EventBotGlobal(event_id, bot, init, data, extra_data, extra_pointers);
 	const int default_return = DispatchEventBot(event_id, bot, init, data, extra_data, extra_pointers);
@@ -840,7 +874,7 @@ int QuestParserCollection::EventBotLocal(
 	QuestEventID event_id,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -868,7 +902,7 @@ int QuestParserCollection::EventBotGlobal(
 	QuestEventID event_id,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -896,11 +930,13 @@ int QuestParserCollection::EventMerc(
 	QuestEventID event_id,
 	Merc* merc,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
 {
+	EventStatsTimer timer(this, event_id);
+
 	const int local_return   = EventMercLocal(event_id, merc, init, data, extra_data, extra_pointers);
 	const int global_return  = EventMercGlobal(event_id, merc, init, data, extra_data, extra_pointers);
 	const int default_return = DispatchEventMerc(event_id, merc, init, data, extra_data, extra_pointers);
@@ -920,7 +956,7 @@ int QuestParserCollection::EventMercLocal(
 	QuestEventID event_id,
 	Merc* merc,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -948,7 +984,7 @@ int QuestParserCollection::EventMercGlobal(
 	QuestEventID event_id,
 	Merc* merc,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -975,11 +1011,13 @@ int QuestParserCollection::EventMercGlobal(
 int QuestParserCollection::EventZone(
 	QuestEventID event_id,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
 {
+	EventStatsTimer timer(this, event_id);
+
 	const int local_return   = EventZoneLocal(event_id, zone, data, extra_data, extra_pointers);
 	const int global_return  = EventZoneGlobal(event_id, zone, data, extra_data, extra_pointers);
 	const int default_return = DispatchEventZone(event_id, zone, data, extra_data, extra_pointers);
@@ -998,7 +1036,7 @@ int QuestParserCollection::EventZone(
 int QuestParserCollection::EventZoneLocal(
 	QuestEventID event_id,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -1025,7 +1063,7 @@ int QuestParserCollection::EventZoneLocal(
 int QuestParserCollection::EventZoneGlobal(
 	QuestEventID event_id,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -1630,6 +1668,26 @@ QuestInterface* QuestParserCollection::GetQIByGlobalZoneQuest(std::string& filen
 	return nullptr;
 }
 
+void QuestParserCollection::RecordEvent(QuestEventID event_id, uint64 elapsed_ns)
+{
+	if (event_id >= _LargestEventID) {
+		return;
+	}
+
+	auto& s = m_event_stats[event_id];
+
+	s.calls++;
+	s.total_ns += elapsed_ns;
+	s.max_ns = std::max(s.max_ns, elapsed_ns);
+
+	int bucket = 0;
+	for (uint64 limit = 1000; bucket < EVENT_TIMING_BUCKETS - 1 && elapsed_ns >= limit; limit *= 10) {
+		bucket++;
+	}
+
+	s.buckets[bucket]++;
+}
+
 void QuestParserCollection::GetErrors(std::list<std::string>& quest_errors)
 {
 	quest_errors.clear();
@@ -1643,7 +1701,7 @@ int QuestParserCollection::DispatchEventNPC(
 	QuestEventID event_id,
 	NPC* npc,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -1663,7 +1721,7 @@ int QuestParserCollection::DispatchEventNPC(
 int QuestParserCollection::DispatchEventPlayer(
 	QuestEventID event_id,
 	Client* client,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -1685,7 +1743,7 @@ int QuestParserCollection::DispatchEventItem(
 	Client* client,
 	EQ::ItemInstance* inst,
 	Mob* mob,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -1707,7 +1765,7 @@ int QuestParserCollection::DispatchEventSpell(
 	Mob* mob,
 	Client* client,
 	uint32 spell_id,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -1728,7 +1786,7 @@ int QuestParserCollection::DispatchEventBot(
 	QuestEventID event_id,
 	Bot* bot,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -1749,7 +1807,7 @@ int QuestParserCollection::DispatchEventMerc(
 	QuestEventID event_id,
 	Merc* merc,
 	Mob* init,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
@@ -1769,7 +1827,7 @@ int QuestParserCollection::DispatchEventMerc(
 int QuestParserCollection::DispatchEventZone(
 	QuestEventID event_id,
 	Zone* zone,
-	std::string data,
+	const std::string &data,
 	uint32 extra_data,
 	std::vector<std::any>* extra_pointers
 )
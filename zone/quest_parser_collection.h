@@ -36,6 +36,7 @@
 
 #include "zone_config.h"
 
+#include <array>
 #include <list>
 #include <map>
 
@@ -78,7 +79,7 @@ public:
 		QuestEventID event_id,
 		NPC* npc,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers = nullptr
 	);
@@ -86,7 +87,7 @@ public:
 	int EventPlayer(
 		QuestEventID event_id,
 		Client* client,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers = nullptr
 	);
@@ -96,7 +97,7 @@ public:
 		Client* client,
 		EQ::ItemInstance* inst,
 		Mob* mob,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers = nullptr
 	);
@@ -106,7 +107,7 @@ public:
 		Mob* mob,
 		Client* client,
 		uint32 spell_id,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers = nullptr
 	);
@@ -114,7 +115,7 @@ public:
 	int EventEncounter(
 		QuestEventID event_id,
 		std::string encounter_name,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers = nullptr
 	);
@@ -123,7 +124,7 @@ public:
 		QuestEventID event_id,
 		Bot *bot,
 		Mob *init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers = nullptr
 	);
@@ -132,7 +133,7 @@ public:
 		QuestEventID event_id,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers = nullptr
 	);
@@ -176,13 +177,27 @@ public:
 	int EventZone(
 		QuestEventID event_id,
 		Zone* zone,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data = 0,
 		std::vector<std::any>* extra_pointers = nullptr
 	);
 
 	void GetErrors(std::list<std::string> &quest_errors);
 
+	// wall time of each top level event dispatch, nested events also count toward the event that raised them
+	static constexpr int EVENT_TIMING_BUCKETS = 6; // under 1us, 10us, 100us, 1ms, 10ms, then everything slower
+
+	struct EventStats {
+		uint64                                   calls    = 0;
+		uint64                                   total_ns = 0;
+		uint64                                   max_ns   = 0;
+		std::array<uint64, EVENT_TIMING_BUCKETS> buckets  = {};
+	};
+
+	void RecordEvent(QuestEventID event_id, uint64 elapsed_ns);
+	const std::array<EventStats, _LargestEventID>& GetEventStats() const { return m_event_stats; }
+	void ResetEventStats() { m_event_stats = {}; }
+
 	/*
 		Internally used memory reference for all Perl Event Export Settings
 		Some exports are very taxing on CPU given how much an event is called.
@@ -225,7 +240,7 @@ private:
 		QuestEventID event_id,
 		NPC* npc,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -234,7 +249,7 @@ private:
 		QuestEventID event_id,
 		NPC* npc,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -242,7 +257,7 @@ private:
 	int EventPlayerLocal(
 		QuestEventID event_id,
 		Client* client,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -250,7 +265,7 @@ private:
 	int EventPlayerGlobal(
 		QuestEventID event_id,
 		Client* client,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -259,7 +274,7 @@ private:
 		QuestEventID event_id,
 		Bot *bot,
 		Mob *init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -268,7 +283,7 @@ private:
 		QuestEventID event_id,
 		Bot *bot,
 		Mob *init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any> *extra_pointers
 	);
@@ -277,7 +292,7 @@ private:
 		QuestEventID event_id,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -286,7 +301,7 @@ private:
 		QuestEventID event_id,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -294,7 +309,7 @@ private:
 	int EventZoneLocal(
 		QuestEventID event_id,
 		Zone* zone,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -302,7 +317,7 @@ private:
 	int EventZoneGlobal(
 		QuestEventID event_id,
 		Zone* zone,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -325,7 +340,7 @@ private:
 		QuestEventID event_id,
 		NPC* npc,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -333,7 +348,7 @@ private:
 	int DispatchEventPlayer(
 		QuestEventID event_id,
 		Client* client,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -343,7 +358,7 @@ private:
 		Client* client,
 		EQ::ItemInstance* inst,
 		Mob* mob,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -353,7 +368,7 @@ private:
 		Mob* mob,
 		Client* client,
 		uint32 spell_id,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -362,7 +377,7 @@ private:
 		QuestEventID event_id,
 		Bot* bot,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -371,7 +386,7 @@ private:
 		QuestEventID event_id,
 		Merc* merc,
 		Mob* init,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -379,7 +394,7 @@ private:
 	int DispatchEventZone(
 		QuestEventID event_id,
 		Zone* zone,
-		std::string data,
+		const std::string &data,
 		uint32 extra_data,
 		std::vector<std::any>* extra_pointers
 	);
@@ -401,6 +416,8 @@ private:
 	std::map<uint32, uint32>      _spell_quest_status;
 	std::map<uint32, uint32>      _item_quest_status;
 	std::map<std::string, uint32> _encounter_quest_status;
+
+	std::array<EventStats, _LargestEventID> m_event_stats = {};
 };
 
 extern QuestParserCollection *parse;
@@ -2101,16 +2101,16 @@ void QuestManager::set_proximity_range(float x_range, float y_range, float z_ran
 
 	auto n = owner->CastToNPC();
 
-	entity_list.AddProximity(n);
-
-	n->proximity->min_x         = n->GetX() - x_range;
-	n->proximity->max_x         = n->GetX() + x_range;
-	n->proximity->min_y         = n->GetY() - y_range;
-	n->proximity->max_y         = n->GetY() + y_range;
-	n->proximity->min_z         = n->GetZ() - z_range;
-	n->proximity->max_z         = n->GetZ() + z_range;
-	n->proximity->say           = enable_say;
-	n->proximity->proximity_set = true;
+	entity_list.AddProximity(
+		n,
+		n->GetX() - x_range,
+		n->GetX() + x_range,
+		n->GetY() - y_range,
+		n->GetY() + y_range,
+		n->GetZ() - z_range,
+		n->GetZ() + z_range,
+		enable_say
+	);
 
 	if (enable_say) {
 		HaveProximitySays = enable_say;
@@ -2126,16 +2126,7 @@ void QuestManager::set_proximity(float min_x, float max_x, float min_y, float ma
 
 	auto n = owner->CastToNPC();
 
-	entity_list.AddProximity(n);
-
-	n->proximity->min_x         = min_x;
-	n->proximity->max_x         = max_x;
-	n->proximity->min_y         = min_y;
-	n->proximity->max_y         = max_y;
-	n->proximity->min_z         = min_z;
-	n->proximity->max_z         = max_z;
-	n->proximity->say           = enable_say;
-	n->proximity->proximity_set = true;
+	entity_list.AddProximity(n, min_x, max_x, min_y, max_y, min_z, max_z, enable_say);
 
 	if (enable_say) {
 		HaveProximitySays = enable_say;
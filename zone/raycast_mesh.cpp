@@ -8,6 +8,15 @@
 #include <string.h>
 #include <vector>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define RAYCAST_MESH_SSE
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
 // This code snippet allows you to create an axis aligned bounding volume tree for a triangle mesh so that you can do
 // high-speed raycasting.
 //
@@ -735,6 +744,266 @@ public:
 		RmUint32		mLeafTriangleIndex;	// if it is a leaf node; then these are the triangle indices.
 	};
 
+// The pointer tree above is what gets built and serialized, queries run against a flattened copy of it. Nodes sit in
+// one contiguous array in depth first order and every leaf's triangles are packed four at a time into TriPackets in
+// structure-of-arrays form, so a leaf is a few 4-wide Moller-Trumbore passes over contiguous memory instead of a walk
+// through the index and vertex arrays. None of it is written after construction, so queries are safe from any thread
+#define FLAT_BVH_PAD 0.01f // boxes of flat geometry are zero-thick on one axis
+#define FLAT_BVH_STACK 64
+#define RAY_BATCH_SIZE 64
+
+struct FlatNodeAABB
+{
+	RmReal		mMin[3];
+	RmReal		mMax[3];
+	RmUint32	mLeft;			// TRI_EOF when there is no child
+	RmUint32	mRight;
+	RmUint32	mPacketStart;	// first TriPacket of a leaf
+	RmUint32	mPacketCount;	// zero for inner nodes
+};
+
+struct alignas(16) TriPacket
+{
+	RmReal		mV0[3][4];
+	RmReal		mE1[3][4];		// v1 - v0
+	RmReal		mE2[3][4];		// v2 - v0
+	RmUint32	mTri[4];		// TRI_EOF in padding lanes, which hold a degenerate triangle that never hits
+};
+
+struct FlatRay
+{
+	RmReal		mFrom[3];
+	RmReal		mDir[3];		// normalized, so hit t values are distances
+	RmReal		mInvDir[3];
+	RmReal		mDistance;
+};
+
+static inline bool setupFlatRay(const RmReal *from,const RmReal *to,FlatRay &ray)
+{
+	RmReal dir[3];
+	dir[0] = to[0] - from[0];
+	dir[1] = to[1] - from[1];
+	dir[2] = to[2] - from[2];
+	RmReal distance = sqrtf( dir[0]*dir[0] + dir[1]*dir[1]+dir[2]*dir[2] );
+	if ( distance < 0.0000000001f ) return false;
+	RmReal recipDistance = 1.0f / distance;
+	for (RmUint32 i=0; i<3; i++)
+	{
+		ray.mFrom[i] = from[i];
+		ray.mDir[i] = dir[i]*recipDistance;
+		// keep the slab test free of inf * 0
+		RmReal d = ray.mDir[i];
+		if ( fabsf(d) < 1e-12f )
+		{
+			d = d < 0.0f ? -1e-12f : 1e-12f;
+		}
+		ray.mInvDir[i] = 1.0f / d;
+	}
+	ray.mDistance = distance;
+	return true;
+}
+
+// slab test, tnear is where the ray enters the box (0 when it starts inside)
+static inline bool rayHitsFlatNode(const FlatNodeAABB &node,const FlatRay &ray,RmReal tmax,RmReal &tnear)
+{
+	RmReal t0 = 0.0f;
+	RmReal t1 = tmax;
+	for (RmUint32 i=0; i<3; i++)
+	{
+		RmReal ta = (node.mMin[i] - ray.mFrom[i]) * ray.mInvDir[i];
+		RmReal tb = (node.mMax[i] - ray.mFrom[i]) * ray.mInvDir[i];
+		if ( ta > tb )
+		{
+			RmReal swap = ta;
+			ta = tb;
+			tb = swap;
+		}
+		t0 = ta > t0 ? ta : t0;
+		t1 = tb < t1 ? tb : t1;
+		if ( t0 > t1 ) return false;
+	}
+	tnear = t0;
+	return true;
+}
+
+// The rays of an occludedBatch call laid out by component, so one node's slab test covers four rays at a time
+struct alignas(16) FlatRayBatch
+{
+	RmReal		mFrom[3][RAY_BATCH_SIZE];
+	RmReal		mInvDir[3][RAY_BATCH_SIZE];
+	RmReal		mDistance[RAY_BATCH_SIZE];
+
+	FlatRayBatch(void)
+	{
+		// unused lanes get a zero length ray so they never report a box hit
+		memset(this,0,sizeof(*this));
+		for (RmUint32 i=0; i<RAY_BATCH_SIZE; i++)
+		{
+			mDistance[i] = -1.0f;
+		}
+	}
+
+	void set(RmUint32 i,const FlatRay &ray)
+	{
+		for (RmUint32 axis=0; axis<3; axis++)
+		{
+			mFrom[axis][i] = ray.mFrom[axis];
+			mInvDir[axis][i] = ray.mInvDir[axis];
+		}
+		mDistance[i] = ray.mDistance;
+	}
+
+	// mask of the rays in 'rays' whose segment touches the node's box
+	uint64_t hitsNode(const FlatNodeAABB &node,uint64_t rays) const
+	{
+		uint64_t ret = 0;
+#ifdef RAYCAST_MESH_SSE
+		const __m128 minX = _mm_set1_ps(node.mMin[0]);
+		const __m128 minY = _mm_set1_ps(node.mMin[1]);
+		const __m128 minZ = _mm_set1_ps(node.mMin[2]);
+		const __m128 maxX = _mm_set1_ps(node.mMax[0]);
+		const __m128 maxY = _mm_set1_ps(node.mMax[1]);
+		const __m128 maxZ = _mm_set1_ps(node.mMax[2]);
+		for (RmUint32 i=0; i<RAY_BATCH_SIZE; i+=4)
+		{
+			if ( !((rays >> i) & 0xF) ) continue;
+
+			__m128 t0 = _mm_setzero_ps();
+			__m128 t1 = _mm_load_ps(&mDistance[i]);
+
+			__m128 o = _mm_load_ps(&mFrom[0][i]);
+			__m128 inv = _mm_load_ps(&mInvDir[0][i]);
+			__m128 ta = _mm_mul_ps(_mm_sub_ps(minX,o),inv);
+			__m128 tb = _mm_mul_ps(_mm_sub_ps(maxX,o),inv);
+			t0 = _mm_max_ps(t0,_mm_min_ps(ta,tb));
+			t1 = _mm_min_ps(t1,_mm_max_ps(ta,tb));
+
+			o = _mm_load_ps(&mFrom[1][i]);
+			inv = _mm_load_ps(&mInvDir[1][i]);
+			ta = _mm_mul_ps(_mm_sub_ps(minY,o),inv);
+			tb = _mm_mul_ps(_mm_sub_ps(maxY,o),inv);
+			t0 = _mm_max_ps(t0,_mm_min_ps(ta,tb));
+			t1 = _mm_min_ps(t1,_mm_max_ps(ta,tb));
+
+			o = _mm_load_ps(&mFrom[2][i]);
+			inv = _mm_load_ps(&mInvDir[2][i]);
+			ta = _mm_mul_ps(_mm_sub_ps(minZ,o),inv);
+			tb = _mm_mul_ps(_mm_sub_ps(maxZ,o),inv);
+			t0 = _mm_max_ps(t0,_mm_min_ps(ta,tb));
+			t1 = _mm_min_ps(t1,_mm_max_ps(ta,tb));
+
+			ret |= (uint64_t)_mm_movemask_ps(_mm_cmple_ps(t0,t1)) << i;
+		}
+#else
+		for (RmUint32 i=0; i<RAY_BATCH_SIZE; i++)
+		{
+			if ( !((rays >> i) & 1) ) continue;
+
+			RmReal t0 = 0.0f;
+			RmReal t1 = mDistance[i];
+			for (RmUint32 axis=0; axis<3 && t0 <= t1; axis++)
+			{
+				RmReal ta = (node.mMin[axis] - mFrom[axis][i]) * mInvDir[axis][i];
+				RmReal tb = (node.mMax[axis] - mFrom[axis][i]) * mInvDir[axis][i];
+				t0 = fmaxf(t0,fminf(ta,tb));
+				t1 = fminf(t1,fmaxf(ta,tb));
+			}
+			if ( t0 <= t1 )
+			{
+				ret |= (uint64_t)1 << i;
+			}
+		}
+#endif
+		return ret & rays;
+	}
+};
+
+// Tests one ray against the four triangles of a packet, returning a lane mask of hits and their distances in t. Same
+// arithmetic and the same rejection rules as rayIntersectsTriangle, lane for lane, so both agree on edge cases
+static inline RmUint32 intersectTriPacket(const TriPacket &p,const FlatRay &ray,RmReal *t)
+{
+#ifdef RAYCAST_MESH_SSE
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 eps = _mm_set1_ps(0.00001f);
+	const __m128 negEps = _mm_set1_ps(-0.00001f);
+
+	const __m128 dx = _mm_set1_ps(ray.mDir[0]);
+	const __m128 dy = _mm_set1_ps(ray.mDir[1]);
+	const __m128 dz = _mm_set1_ps(ray.mDir[2]);
+
+	const __m128 e1x = _mm_load_ps(p.mE1[0]);
+	const __m128 e1y = _mm_load_ps(p.mE1[1]);
+	const __m128 e1z = _mm_load_ps(p.mE1[2]);
+	const __m128 e2x = _mm_load_ps(p.mE2[0]);
+	const __m128 e2y = _mm_load_ps(p.mE2[1]);
+	const __m128 e2z = _mm_load_ps(p.mE2[2]);
+
+	// h = d x e2
+	const __m128 hx = _mm_sub_ps(_mm_mul_ps(dy,e2z),_mm_mul_ps(e2y,dz));
+	const __m128 hy = _mm_sub_ps(_mm_mul_ps(dz,e2x),_mm_mul_ps(e2z,dx));
+	const __m128 hz = _mm_sub_ps(_mm_mul_ps(dx,e2y),_mm_mul_ps(e2x,dy));
+
+	const __m128 a = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x,hx),_mm_mul_ps(e1y,hy)),_mm_mul_ps(e1z,hz));
+	__m128 valid = _mm_or_ps(_mm_cmplt_ps(a,negEps),_mm_cmpgt_ps(a,eps));
+	if ( !_mm_movemask_ps(valid) ) return 0;
+
+	const __m128 f = _mm_div_ps(one,a);
+
+	// s = from - v0
+	const __m128 sx = _mm_sub_ps(_mm_set1_ps(ray.mFrom[0]),_mm_load_ps(p.mV0[0]));
+	const __m128 sy = _mm_sub_ps(_mm_set1_ps(ray.mFrom[1]),_mm_load_ps(p.mV0[1]));
+	const __m128 sz = _mm_sub_ps(_mm_set1_ps(ray.mFrom[2]),_mm_load_ps(p.mV0[2]));
+
+	const __m128 u = _mm_mul_ps(f,_mm_add_ps(_mm_add_ps(_mm_mul_ps(sx,hx),_mm_mul_ps(sy,hy)),_mm_mul_ps(sz,hz)));
+	valid = _mm_and_ps(valid,_mm_and_ps(_mm_cmpge_ps(u,zero),_mm_cmple_ps(u,one)));
+	if ( !_mm_movemask_ps(valid) ) return 0;
+
+	// q = s x e1
+	const __m128 qx = _mm_sub_ps(_mm_mul_ps(sy,e1z),_mm_mul_ps(e1y,sz));
+	const __m128 qy = _mm_sub_ps(_mm_mul_ps(sz,e1x),_mm_mul_ps(e1z,sx));
+	const __m128 qz = _mm_sub_ps(_mm_mul_ps(sx,e1y),_mm_mul_ps(e1x,sy));
+
+	const __m128 v = _mm_mul_ps(f,_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx,qx),_mm_mul_ps(dy,qy)),_mm_mul_ps(dz,qz)));
+	valid = _mm_and_ps(valid,_mm_and_ps(_mm_cmpge_ps(v,zero),_mm_cmple_ps(_mm_add_ps(u,v),one)));
+
+	const __m128 tt = _mm_mul_ps(f,_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x,qx),_mm_mul_ps(e2y,qy)),_mm_mul_ps(e2z,qz)));
+	valid = _mm_and_ps(valid,_mm_cmpgt_ps(tt,zero));
+
+	_mm_storeu_ps(t,tt);
+	return (RmUint32)_mm_movemask_ps(valid);
+#else
+	RmUint32 mask = 0;
+	for (RmUint32 lane=0; lane<4; lane++)
+	{
+		RmReal e1[3] = { p.mE1[0][lane], p.mE1[1][lane], p.mE1[2][lane] };
+		RmReal e2[3] = { p.mE2[0][lane], p.mE2[1][lane], p.mE2[2][lane] };
+		RmReal v0[3] = { p.mV0[0][lane], p.mV0[1][lane], p.mV0[2][lane] };
+		RmReal h[3],s[3],q[3];
+
+		crossProduct(h,ray.mDir,e2);
+		RmReal a = innerProduct(e1,h);
+		if ( !(a < -0.00001f || a > 0.00001f) ) continue;
+
+		RmReal f = 1/a;
+		vector(s,ray.mFrom,v0);
+		RmReal u = f * (innerProduct(s,h));
+		if ( u < 0.0f || u > 1.0f ) continue;
+
+		crossProduct(q,s,e1);
+		RmReal v = f * innerProduct(ray.mDir,q);
+		if ( v < 0.0f || u + v > 1.0f ) continue;
+
+		t[lane] = f * innerProduct(e2,q);
+		if ( t[lane] > 0 )
+		{
+			mask |= 1 << lane;
+		}
+	}
+	return mask;
+#endif
+}
+
 class MyRaycastMesh : public RaycastMesh, public NodeInterface
 {
 public:
@@ -801,6 +1070,8 @@ public:
 		new ( mRoot ) NodeAABB(mVcount,mVertices,mTcount,mIndices,maxDepth,minLeafSize,minAxisSize,this,mLeafTriangles);
 
 		KSM::MarkMemoryForKSM(mLeafTriangles.data(), mLeafTriangles.size() * sizeof(RmUint32));
+
+		buildFlatTree();
 	}
 
 	~MyRaycastMesh(void)
@@ -813,6 +1084,218 @@ public:
 	}
 
 	virtual bool raycast(const RmReal *from,const RmReal *to,RmReal *hitLocation,RmReal *hitNormal,RmReal *hitDistance)
+	{
+		FlatRay ray;
+		if ( mFlatNodes.empty() || !setupFlatRay(from,to,ray) ) return false;
+
+		// nearest hit, ties go to the lowest triangle index like the tree walk
+		RmReal nearestDistance = ray.mDistance;
+		RmUint32 nearestTriIndex = TRI_EOF;
+
+		struct StackEntry
+		{
+			RmUint32	mNode;
+			RmReal		mNear;
+		};
+		StackEntry stack[FLAT_BVH_STACK];
+		RmUint32 stackSize = 0;
+
+		RmReal tnear;
+		if ( rayHitsFlatNode(mFlatNodes[0],ray,nearestDistance,tnear) )
+		{
+			stack[stackSize++] = { 0, tnear };
+		}
+
+		while ( stackSize )
+		{
+			const StackEntry entry = stack[--stackSize];
+			if ( entry.mNear > nearestDistance ) continue;
+
+			const FlatNodeAABB &node = mFlatNodes[entry.mNode];
+			if ( node.mPacketCount )
+			{
+				RmReal t[4];
+				for (RmUint32 i=0; i<node.mPacketCount; i++)
+				{
+					const TriPacket &packet = mTriPackets[node.mPacketStart+i];
+					RmUint32 mask = intersectTriPacket(packet,ray,t);
+					for (RmUint32 lane=0; mask; lane++, mask >>= 1)
+					{
+						if ( !(mask & 1) ) continue;
+						RmUint32 tri = packet.mTri[lane];
+						if ( t[lane] < nearestDistance || (t[lane] == nearestDistance && tri < nearestTriIndex) )
+						{
+							nearestDistance = t[lane];
+							nearestTriIndex = tri;
+						}
+					}
+				}
+				continue;
+			}
+
+			// push the far child first so the near one is popped, and tightens nearestDistance, first
+			RmReal leftNear = 0, rightNear = 0;
+			bool left = node.mLeft != TRI_EOF && rayHitsFlatNode(mFlatNodes[node.mLeft],ray,nearestDistance,leftNear);
+			bool right = node.mRight != TRI_EOF && rayHitsFlatNode(mFlatNodes[node.mRight],ray,nearestDistance,rightNear);
+			if ( left && right && leftNear < rightNear )
+			{
+				stack[stackSize++] = { node.mRight, rightNear };
+				stack[stackSize++] = { node.mLeft, leftNear };
+			}
+			else
+			{
+				if ( left ) stack[stackSize++] = { node.mLeft, leftNear };
+				if ( right ) stack[stackSize++] = { node.mRight, rightNear };
+			}
+		}
+
+		if ( nearestTriIndex == TRI_EOF ) return false;
+
+		if ( hitLocation )
+		{
+			hitLocation[0] = from[0]+ray.mDir[0]*nearestDistance;
+			hitLocation[1] = from[1]+ray.mDir[1]*nearestDistance;
+			hitLocation[2] = from[2]+ray.mDir[2]*nearestDistance;
+		}
+		if ( hitNormal )
+		{
+			getFaceNormal(nearestTriIndex,hitNormal);
+		}
+		if ( hitDistance )
+		{
+			*hitDistance = nearestDistance;
+		}
+		return true;
+	}
+
+	virtual bool occluded(const RmReal *from,const RmReal *to)
+	{
+		FlatRay ray;
+		if ( mFlatNodes.empty() || !setupFlatRay(from,to,ray) ) return false;
+
+		RmUint32 stack[FLAT_BVH_STACK];
+		RmUint32 stackSize = 0;
+		stack[stackSize++] = 0;
+
+		RmReal tnear;
+		RmReal t[4];
+		while ( stackSize )
+		{
+			const FlatNodeAABB &node = mFlatNodes[stack[--stackSize]];
+			if ( !rayHitsFlatNode(node,ray,ray.mDistance,tnear) ) continue;
+
+			if ( node.mPacketCount )
+			{
+				for (RmUint32 i=0; i<node.mPacketCount; i++)
+				{
+					RmUint32 mask = intersectTriPacket(mTriPackets[node.mPacketStart+i],ray,t);
+					for (RmUint32 lane=0; mask; lane++, mask >>= 1)
+					{
+						if ( (mask & 1) && t[lane] <= ray.mDistance ) return true;
+					}
+				}
+				continue;
+			}
+
+			if ( node.mLeft != TRI_EOF ) stack[stackSize++] = node.mLeft;
+			if ( node.mRight != TRI_EOF ) stack[stackSize++] = node.mRight;
+		}
+		return false;
+	}
+
+	// Up to RAY_BATCH_SIZE segments walk the tree together, each stack entry carrying the mask of rays still alive in
+	// that subtree. A node is fetched once per batch instead of once per ray, and rays drop out as soon as they are hit
+	virtual void occludedBatch(const RmReal *from,const RmReal *to,RmUint32 count,bool *results)
+	{
+		for (RmUint32 base=0; base<count; base+=RAY_BATCH_SIZE)
+		{
+			RmUint32 batchCount = count - base < RAY_BATCH_SIZE ? count - base : RAY_BATCH_SIZE;
+			occludedBatch64(&from[base*3],&to[base*3],batchCount,&results[base]);
+		}
+	}
+
+	void occludedBatch64(const RmReal *from,const RmReal *to,RmUint32 count,bool *results)
+	{
+		FlatRay rays[RAY_BATCH_SIZE];
+		FlatRayBatch batch;
+		uint64_t live = 0;
+		for (RmUint32 i=0; i<count; i++)
+		{
+			results[i] = false;
+			if ( !mFlatNodes.empty() && setupFlatRay(&from[i*3],&to[i*3],rays[i]) )
+			{
+				batch.set(i,rays[i]);
+				live |= (uint64_t)1 << i;
+			}
+		}
+
+		struct StackEntry
+		{
+			RmUint32	mNode;
+			uint64_t	mRays;
+		};
+		StackEntry stack[FLAT_BVH_STACK];
+		RmUint32 stackSize = 0;
+		if ( live )
+		{
+			stack[stackSize++] = { 0, live };
+		}
+
+		uint64_t hit = 0;
+		RmReal t[4];
+		while ( stackSize )
+		{
+			const StackEntry entry = stack[--stackSize];
+			const FlatNodeAABB &node = mFlatNodes[entry.mNode];
+
+			uint64_t active = batch.hitsNode(node,entry.mRays & ~hit);
+			if ( !active ) continue;
+
+			if ( node.mPacketCount )
+			{
+				for (RmUint32 p=0; p<node.mPacketCount && active; p++)
+				{
+					const TriPacket &packet = mTriPackets[node.mPacketStart+p];
+					for (uint64_t pending = active; pending; pending &= pending - 1)
+					{
+						RmUint32 i = ctz64(pending);
+						RmUint32 mask = intersectTriPacket(packet,rays[i],t);
+						for (RmUint32 lane=0; mask; lane++, mask >>= 1)
+						{
+							if ( (mask & 1) && t[lane] <= rays[i].mDistance )
+							{
+								hit |= (uint64_t)1 << i;
+								active &= ~((uint64_t)1 << i);
+								break;
+							}
+						}
+					}
+				}
+				continue;
+			}
+
+			if ( node.mLeft != TRI_EOF ) stack[stackSize++] = { node.mLeft, active };
+			if ( node.mRight != TRI_EOF ) stack[stackSize++] = { node.mRight, active };
+		}
+
+		for (RmUint32 i=0; i<count; i++)
+		{
+			results[i] = (hit >> i) & 1;
+		}
+	}
+
+	static inline RmUint32 ctz64(uint64_t v)
+	{
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward64(&index,v);
+		return (RmUint32)index;
+#else
+		return (RmUint32)__builtin_ctzll(v);
+#endif
+	}
+
+	virtual bool treeRaycast(const RmReal *from,const RmReal *to,RmReal *hitLocation,RmReal *hitNormal,RmReal *hitDistance)
 	{
 		bool ret = false;
 
@@ -936,6 +1419,73 @@ public:
 		return ret;
 	}
 
+	void buildFlatTree(void)
+	{
+		mFlatNodes.clear();
+		mTriPackets.clear();
+		if ( mRoot == NULL ) return;
+
+		mFlatNodes.reserve(mNodeCount);
+		flattenNode(mRoot);
+	}
+
+	RmUint32 flattenNode(const NodeAABB *src)
+	{
+		RmUint32 index = (RmUint32)mFlatNodes.size();
+		mFlatNodes.emplace_back();
+
+		FlatNodeAABB node;
+		for (RmUint32 i=0; i<3; i++)
+		{
+			node.mMin[i] = src->mBounds.mMin[i] - FLAT_BVH_PAD;
+			node.mMax[i] = src->mBounds.mMax[i] + FLAT_BVH_PAD;
+		}
+		node.mLeft = TRI_EOF;
+		node.mRight = TRI_EOF;
+		node.mPacketStart = (RmUint32)mTriPackets.size();
+		node.mPacketCount = 0;
+
+		if ( src->mLeafTriangleIndex != TRI_EOF )
+		{
+			const RmUint32 *scan = &mLeafTriangles[src->mLeafTriangleIndex];
+			RmUint32 count = *scan++;
+			for (RmUint32 i=0; i<count; i+=4)
+			{
+				TriPacket packet;
+				memset(&packet,0,sizeof(packet));
+				for (RmUint32 lane=0; lane<4; lane++)
+				{
+					if ( i+lane >= count )
+					{
+						packet.mTri[lane] = TRI_EOF;
+						continue;
+					}
+					RmUint32 tri = scan[i+lane];
+					const RmReal *p1 = &mVertices[mIndices[tri*3+0]*3];
+					const RmReal *p2 = &mVertices[mIndices[tri*3+1]*3];
+					const RmReal *p3 = &mVertices[mIndices[tri*3+2]*3];
+					for (RmUint32 axis=0; axis<3; axis++)
+					{
+						packet.mV0[axis][lane] = p1[axis];
+						packet.mE1[axis][lane] = p2[axis] - p1[axis];
+						packet.mE2[axis][lane] = p3[axis] - p1[axis];
+					}
+					packet.mTri[lane] = tri;
+				}
+				mTriPackets.push_back(packet);
+				node.mPacketCount++;
+			}
+		}
+		else
+		{
+			if ( src->mLeft ) node.mLeft = flattenNode(src->mLeft);
+			if ( src->mRight ) node.mRight = flattenNode(src->mRight);
+		}
+
+		mFlatNodes[index] = node;
+		return index;
+	}
+
 	RmUint32		mRaycastFrame;
 	RmUint32		*mRaycastTriangles;
 	RmUint32		mVcount;
@@ -948,6 +1498,8 @@ public:
 	RmUint32		mMaxNodeCount;
 	NodeAABB		*mNodes;
 	TriVector		mLeafTriangles;
+	std::vector<FlatNodeAABB>	mFlatNodes;
+	std::vector<TriPacket>		mTriPackets;
 
 #ifdef USE_MAP_MMFS
 	MyRaycastMesh(std::vector<char>& rm_buffer);
@@ -979,8 +1531,12 @@ RaycastMesh * createRaycastMesh(RmUint32 vcount,		// The number of vertices in t
 	size_t bvh_node_size = m->mNodeCount * sizeof(NodeAABB); // BVH Node memory usage
 	size_t bvh_leaf_size = m->mLeafTriangles.size() * sizeof(RmUint32); // BVH leaf triangles
 
+	size_t flat_node_size = m->mFlatNodes.size() * sizeof(FlatNodeAABB); // Flattened BVH nodes
+	size_t flat_packet_size = m->mTriPackets.size() * sizeof(TriPacket); // Packed leaf triangles
+
 	size_t bvh_size = bvh_node_size + bvh_leaf_size; // Total BVH size
-	size_t total_size = vertex_size + index_size + bvh_size;
+	size_t flat_size = flat_node_size + flat_packet_size;
+	size_t total_size = vertex_size + index_size + bvh_size + flat_size;
 
 	KSM::CheckPageAlignment(m->mNodes);
 	KSM::CheckPageAlignment(m->mVertices);
@@ -993,6 +1549,13 @@ RaycastMesh * createRaycastMesh(RmUint32 vcount,		// The number of vertices in t
 		bvh_leaf_size / (1024.0 * 1024.0),
 		bvh_size / (1024.0 * 1024.0)
 	);
+	LogInfo(
+		"Map Raycast Flat BVH | Nodes [{}] [{:.2f}] MB Triangle Packets [{}] [{:.2f}] MB",
+		m->mFlatNodes.size(),
+		flat_node_size / (1024.0 * 1024.0),
+		m->mTriPackets.size(),
+		flat_packet_size / (1024.0 * 1024.0)
+	);
 	LogInfo("Total Raycast Memory [{:.2f}] MB", total_size / (1024.0 * 1024.0));
 
 	return static_cast< RaycastMesh * >(m);
@@ -1158,6 +1721,8 @@ MyRaycastMesh::MyRaycastMesh(std::vector<char>& rm_buffer)
 		mNodes = nullptr;
 		mRoot = nullptr;
 	}
+
+	buildFlatTree();
 }
 
 void MyRaycastMesh::serialize(std::vector<char>& rm_buffer)
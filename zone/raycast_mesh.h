@@ -37,6 +37,12 @@ class RaycastMesh
 {
 public:
 	virtual bool raycast(const RmReal *from,const RmReal *to,RmReal *hitLocation,RmReal *hitNormal,RmReal *hitDistance) = 0;
+	// true if anything lies between from and to, stops at the first hit rather than looking for the nearest
+	virtual bool occluded(const RmReal *from,const RmReal *to) = 0;
+	// occluded() for count segments given as x,y,z triples, the segments share a single walk of the tree
+	virtual void occludedBatch(const RmReal *from,const RmReal *to,RmUint32 count,bool *results) = 0;
+	// walks the original pointer tree instead of the flattened one, kept around for benchmarking and verification
+	virtual bool treeRaycast(const RmReal *from,const RmReal *to,RmReal *hitLocation,RmReal *hitNormal,RmReal *hitDistance) = 0;
 	virtual bool bruteForceRaycast(const RmReal *from,const RmReal *to,RmReal *hitLocation,RmReal *hitNormal,RmReal *hitDistance) = 0;
 
 	virtual const RmReal * getBoundMin(void) const = 0; // return the minimum bounding box
@@ -27,6 +27,7 @@
 #include "worldserver.h"
 #include "zone.h"
 #include "zonedb.h"
+#include "../common/timer_wheel.h"
 #include "../common/repositories/criteria/content_filter_criteria.h"
 #include "../common/repositories/spawn_conditions_repository.h"
 #include "../common/repositories/spawn_condition_values_repository.h"
@@ -41,6 +42,9 @@ extern Zone* zone;
 
 extern WorldServer worldserver;
 
+// how often a due spawn point that is held back looks again, the pace the zone used to poll every spawn point at
+constexpr uint32 SPAWN2_HELD_RECHECK_MS = 1000;
+
 /*
 
 CREATE TABLE spawn_conditions (
@@ -110,6 +114,9 @@ Spawn2::Spawn2(uint32 in_spawn2_id, uint32 spawngroup_id,
 		timer.Start(resetTimer());
 		timer.Trigger();
 	}
+
+	// Reset, Repop, DeathReset etc. all go through the timer, which keeps the wheel entry on its deadline
+	timer.Attach(TimerWheel::Instance(), [this]() { OnTimer(); });
 }
 
 Spawn2::~Spawn2()
@@ -150,6 +157,11 @@ uint32 Spawn2::despawnTimer(uint32 despawn_timer)
 
 }
 
+bool Spawn2::IsHeldByNPC(SpawnGroup *spawn_group)
+{
+	return NPCPointerValid() && (spawn_group && spawn_group->despawn == 0 || condition_id != 0);
+}
+
 bool Spawn2::Process() {
 	IsDespawned = false;
 
@@ -159,195 +171,220 @@ bool Spawn2::Process() {
 
 	//grab our spawn group
 	SpawnGroup *spawn_group = zone->spawn_group_list.GetSpawnGroup(spawngroup_id_);
-	if (NPCPointerValid() && (spawn_group && spawn_group->despawn == 0 || condition_id != 0)) {
+	if (IsHeldByNPC(spawn_group)) {
 		return true;
 	}
 
 	if (timer.Check()) {
-		timer.Disable();
+		return SpawnDue(spawn_group);
+	}
 
-		LogSpawns("[{}]: Timer has triggered", spawn2_id);
+	return true;
+}
 
-		//first check our spawn condition, if this isnt active
-		//then we reset the timer and try again next time.
-		if (condition_id != SC_AlwaysEnabled
-			&& !zone->spawn_conditions.Check(condition_id, condition_min_value)) {
-			LogSpawns("[{}]: spawning prevented by spawn condition [{}]", spawn2_id, condition_id);
-			Reset();
-			return (true);
-		}
+// wheel callback, the timer has already been checked
+void Spawn2::OnTimer()
+{
+	IsDespawned = false;
 
-		/**
-		 * Wait for init grids timer because we bulk load this data before trying to fetch it individually
-		 */
-		if (spawn_group == nullptr && zone->GetInitgridsTimer().Check()) {
-			content_db.LoadSpawnGroupsByID(spawngroup_id_, &zone->spawn_group_list);
-			spawn_group = zone->spawn_group_list.GetSpawnGroup(spawngroup_id_);
-		}
+	SpawnGroup *spawn_group = zone->spawn_group_list.GetSpawnGroup(spawngroup_id_);
+	if (!zone->IsLoaded() || !Enabled() || IsHeldByNPC(spawn_group)) {
+		timer.Start(SPAWN2_HELD_RECHECK_MS, false);
+		return;
+	}
 
-		if (spawn_group == nullptr) {
-			LogSpawns("Spawn2 [{}]: Unable to locate spawn group [{}]. Disabling", spawn2_id, spawngroup_id_);
+	// the timer must outlive this callback, Zone::Process deletes us
+	if (!SpawnDue(spawn_group)) {
+		m_pending_removal             = true;
+		zone->spawn2_removals_pending = true;
+	}
+}
 
-			return false;
-		}
+bool Spawn2::SpawnDue(SpawnGroup *spawn_group)
+{
+	timer.Disable();
 
-		uint16 condition_value = 1;
-		if (condition_id > 0) {
-			condition_value = zone->spawn_conditions.GetCondition(
-				zone->GetShortName(),
-				zone->GetInstanceID(),
-				condition_id
-			);
-		}
+	LogSpawns("[{}]: Timer has triggered", spawn2_id);
 
-		//have the spawn group pick an NPC for us
-		uint32 npcid = 0;
-		if (m_resumed_npc_id > 0) {
-			npcid = m_resumed_npc_id;
-			m_resumed_npc_id = 0;
-		} else {
-			npcid = spawn_group->GetNPCType(condition_value);
-		}
+	//first check our spawn condition, if this isnt active
+	//then we reset the timer and try again next time.
+	if (condition_id != SC_AlwaysEnabled
+		&& !zone->spawn_conditions.Check(condition_id, condition_min_value)) {
+		LogSpawns("[{}]: spawning prevented by spawn condition [{}]", spawn2_id, condition_id);
+		Reset();
+		return (true);
+	}
 
-		if (npcid == 0) {
-			LogSpawns("Spawn2 [{}]: Spawn group [{}] did not yeild an NPC! not spawning", spawn2_id, spawngroup_id_);
+	/**
+	 * Wait for init grids timer because we bulk load this data before trying to fetch it individually
+	 */
+	if (spawn_group == nullptr && zone->GetInitgridsTimer().Check()) {
+		content_db.LoadSpawnGroupsByID(spawngroup_id_, &zone->spawn_group_list);
+		spawn_group = zone->spawn_group_list.GetSpawnGroup(spawngroup_id_);
+	}
 
-			Reset();    //try again later (why?)
-			return (true);
-		}
+	if (spawn_group == nullptr) {
+		LogSpawns("Spawn2 [{}]: Unable to locate spawn group [{}]. Disabling", spawn2_id, spawngroup_id_);
 
-		//try to find our NPC type.
-		const NPCType *tmp = content_db.LoadNPCTypesData(npcid);
-		if (tmp == nullptr) {
-			LogSpawns("Spawn2 [{}]: Spawn group [{}] yeilded an invalid NPC type [{}]", spawn2_id, spawngroup_id_, npcid);
-			Reset();    //try again later
-			return (true);
-		}
+		return false;
+	}
 
-		if (tmp->npc_id == 0) {
-			LogError("NPC type did not load for npc_id [{}]", npcid);
-			return true;
-		}
+	uint16 condition_value = 1;
+	if (condition_id > 0) {
+		condition_value = zone->spawn_conditions.GetCondition(
+			zone->GetShortName(),
+			zone->GetInstanceID(),
+			condition_id
+		);
+	}
 
-		if (tmp->unique_spawn_by_name) {
-			if (!entity_list.LimitCheckName(tmp->name)) {
-				LogSpawns("Spawn2 [{}]: Spawn group [{}] yeilded NPC type [{}], which is unique and one already exists", spawn2_id, spawngroup_id_, npcid);
-				timer.Start(5000);    //try again in five seconds.
-				return (true);
-			}
-		}
+	//have the spawn group pick an NPC for us
+	uint32 npcid = 0;
+	if (m_resumed_npc_id > 0) {
+		npcid = m_resumed_npc_id;
+		m_resumed_npc_id = 0;
+	} else {
+		npcid = spawn_group->GetNPCType(condition_value);
+	}
 
-		if (tmp->spawn_limit > 0) {
-			if (!entity_list.LimitCheckType(npcid, tmp->spawn_limit)) {
-				LogSpawns("Spawn2 [{}]: Spawn group [{}] yeilded NPC type [{}], which is over its spawn limit ([{}])", spawn2_id, spawngroup_id_, npcid, tmp->spawn_limit);
-				timer.Start(5000);    //try again in five seconds.
-				return (true);
-			}
-		}
+	if (npcid == 0) {
+		LogSpawns("Spawn2 [{}]: Spawn group [{}] did not yeild an NPC! not spawning", spawn2_id, spawngroup_id_);
 
-		bool ignore_despawn = false;
-		if (npcthis) {
-			ignore_despawn = npcthis->IgnoreDespawn();
-		}
+		Reset();    //try again later (why?)
+		return (true);
+	}
 
-		if (ignore_despawn) {
-			return true;
-		}
+	//try to find our NPC type.
+	const NPCType *tmp = content_db.LoadNPCTypesData(npcid);
+	if (tmp == nullptr) {
+		LogSpawns("Spawn2 [{}]: Spawn group [{}] yeilded an invalid NPC type [{}]", spawn2_id, spawngroup_id_, npcid);
+		Reset();    //try again later
+		return (true);
+	}
 
-		if (spawn_group->despawn != 0 && condition_id == 0 && !ignore_despawn) {
-			zone->Despawn(spawn2_id);
+	if (tmp->npc_id == 0) {
+		LogError("NPC type did not load for npc_id [{}]", npcid);
+		return true;
+	}
+
+	if (tmp->unique_spawn_by_name) {
+		if (!entity_list.LimitCheckName(tmp->name)) {
+			LogSpawns("Spawn2 [{}]: Spawn group [{}] yeilded NPC type [{}], which is unique and one already exists", spawn2_id, spawngroup_id_, npcid);
+			timer.Start(5000);    //try again in five seconds.
+			return (true);
 		}
+	}
 
-		if (IsDespawned) {
-			return true;
+	if (tmp->spawn_limit > 0) {
+		if (!entity_list.LimitCheckType(npcid, tmp->spawn_limit)) {
+			LogSpawns("Spawn2 [{}]: Spawn group [{}] yeilded NPC type [{}], which is over its spawn limit ([{}])", spawn2_id, spawngroup_id_, npcid, tmp->spawn_limit);
+			timer.Start(5000);    //try again in five seconds.
+			return (true);
 		}
+	}
+
+	bool ignore_despawn = false;
+	if (npcthis) {
+		ignore_despawn = npcthis->IgnoreDespawn();
+	}
+
+	if (ignore_despawn) {
+		return true;
+	}
+
+	if (spawn_group->despawn != 0 && condition_id == 0 && !ignore_despawn) {
+		zone->Despawn(spawn2_id);
+	}
+
+	if (IsDespawned) {
+		return true;
+	}
 
-		currentnpcid = npcid;
+	currentnpcid = npcid;
 
-		glm::vec4 loc(x, y, z, heading);
-		int starting_wp = 0;
-		if (spawn_group->wp_spawns && grid_ > 0)
+	glm::vec4 loc(x, y, z, heading);
+	int starting_wp = 0;
+	if (spawn_group->wp_spawns && grid_ > 0)
+	{
+		glm::vec4 wploc;
+		starting_wp = content_db.GetRandomWaypointFromGrid(wploc, zone->GetZoneID(), grid_);
+		if (wploc.x != 0.0f || wploc.y != 0.0f || wploc.z != 0.0f)
 		{
-			glm::vec4 wploc;
-			starting_wp = content_db.GetRandomWaypointFromGrid(wploc, zone->GetZoneID(), grid_);
-			if (wploc.x != 0.0f || wploc.y != 0.0f || wploc.z != 0.0f)
-			{
-				loc = wploc;
-				Log(Logs::General, Logs::Spawns, "spawning at random waypoint #%i loc: (%.3f, %.3f, %.3f).", starting_wp , loc.x, loc.y, loc.z);
-			}
+			loc = wploc;
+			Log(Logs::General, Logs::Spawns, "spawning at random waypoint #%i loc: (%.3f, %.3f, %.3f).", starting_wp , loc.x, loc.y, loc.z);
 		}
+	}
 
-		// zone state restore
-		if (m_stored_location != glm::vec4(0, 0, -1000, 0)) {
-			loc = m_stored_location;
-			m_stored_location = glm::vec4(0, 0, -1000, 0);
-		}
+	// zone state restore
+	if (m_stored_location != glm::vec4(0, 0, -1000, 0)) {
+		loc = m_stored_location;
+		m_stored_location = glm::vec4(0, 0, -1000, 0);
+	}
 
-		NPC *npc = new NPC(tmp, this, loc, GravityBehavior::Water);
+	NPC *npc = new NPC(tmp, this, loc, GravityBehavior::Water);
 
-		npcthis = npc;
+	npcthis = npc;
 
-		if (!m_entity_variables.empty()) {
-			for (auto &var : m_entity_variables) {
-				npc->SetEntityVariable(var.first, var.second);
-			}
-			m_entity_variables = {};
+	if (!m_entity_variables.empty()) {
+		for (auto &var : m_entity_variables) {
+			npc->SetEntityVariable(var.first, var.second);
 		}
+		m_entity_variables = {};
+	}
 
-		npc->SetResumedFromZoneSuspend(m_resumed_from_zone_suspend);
-		m_resumed_from_zone_suspend = false;
+	npc->SetResumedFromZoneSuspend(m_resumed_from_zone_suspend);
+	m_resumed_from_zone_suspend = false;
 
-		npc->AddLootTable();
-		if (npc->DropsGlobalLoot()) {
-			npc->CheckGlobalLootTables();
-		}
+	npc->AddLootTable();
+	if (npc->DropsGlobalLoot()) {
+		npc->CheckGlobalLootTables();
+	}
 
-		npc->SetSpawnGroupId(spawngroup_id_);
-		npc->SaveGuardPointAnim(anim);
-		npc->SetAppearance((EmuAppearance) anim);
-		entity_list.AddNPC(npc);
-		//this limit add must be done after the AddNPC since we need the entity ID.
-		entity_list.LimitAddNPC(npc);
-
-		/**
-		 * Roambox init
-		 */
-		if (spawn_group->roamdist > 0) {
-			npc->AI_SetRoambox(
-				spawn_group->roamdist,
-				spawn_group->roambox[0],
-				spawn_group->roambox[1],
-				spawn_group->roambox[2],
-				spawn_group->roambox[3],
-				spawn_group->delay,
-				spawn_group->min_delay
-			);
-		}
+	npc->SetSpawnGroupId(spawngroup_id_);
+	npc->SaveGuardPointAnim(anim);
+	npc->SetAppearance((EmuAppearance) anim);
+	entity_list.AddNPC(npc);
+	//this limit add must be done after the AddNPC since we need the entity ID.
+	entity_list.LimitAddNPC(npc);
+
+	/**
+	 * Roambox init
+	 */
+	if (spawn_group->roamdist > 0) {
+		npc->AI_SetRoambox(
+			spawn_group->roamdist,
+			spawn_group->roambox[0],
+			spawn_group->roambox[1],
+			spawn_group->roambox[2],
+			spawn_group->roambox[3],
+			spawn_group->delay,
+			spawn_group->min_delay
+		);
+	}
 
-		if (zone->InstantGrids()) {
-			LogSpawns("Spawn2 [{}]: Group [{}] spawned [{}] ([{}]) at ([{}], [{}], [{}])",
-				spawn2_id,
-				spawngroup_id_,
-				npc->GetName(),
-				npcid,
-				x,
-				y,
-				z
-			);
+	if (zone->InstantGrids()) {
+		LogSpawns("Spawn2 [{}]: Group [{}] spawned [{}] ([{}]) at ([{}], [{}], [{}])",
+			spawn2_id,
+			spawngroup_id_,
+			npc->GetName(),
+			npcid,
+			x,
+			y,
+			z
+		);
 
-			LoadGrid(starting_wp);
-		}
-		else {
-			LogSpawns("Spawn2 [{}]: Group [{}] spawned [{}] ([{}]) at ([{}], [{}], [{}]). Grid loading delayed",
-				spawn2_id,
-				spawngroup_id_,
-				tmp->name,
-				npcid,
-				x,
-				y,
-				z
-			);
-		}
+		LoadGrid(starting_wp);
+	}
+	else {
+		LogSpawns("Spawn2 [{}]: Group [{}] spawned [{}] ([{}]) at ([{}], [{}], [{}]). Grid loading delayed",
+			spawn2_id,
+			spawngroup_id_,
+			tmp->name,
+			npcid,
+			x,
+			y,
+			z
+		);
 	}
 
 	return true;
@@ -473,8 +510,31 @@ void Spawn2::DeathReset(bool realdeath)
 	}
 }
 
-bool ZoneDatabase::PopulateZoneSpawnList(uint32 zoneid, LinkedList<Spawn2*> &spawn2_list, int16 version) {
+std::vector<Spawn2Repository::Spawn2> ZoneDatabase::LoadZoneSpawn2(const std::string &zone_name, int16 version)
+{
+	return Spawn2Repository::GetWhere(
+		*this,
+		fmt::format(
+			"TRUE {} AND zone = '{}' AND (version = {} OR version = -1) ",
+			ContentFilterCriteria::apply(),
+			zone_name,
+			version
+		)
+	);
+}
+
+bool ZoneDatabase::PopulateZoneSpawnList(uint32 zoneid, LinkedList<Spawn2*> &spawn2_list, int16 version)
+{
+	return PopulateZoneSpawnList(zoneid, spawn2_list, version, content_db.LoadZoneSpawn2(ZoneName(zoneid), version));
+}
 
+bool ZoneDatabase::PopulateZoneSpawnList(
+	uint32 zoneid,
+	LinkedList<Spawn2*> &spawn2_list,
+	int16 version,
+	const std::vector<Spawn2Repository::Spawn2> &spawns
+)
+{
 	std::unordered_map<uint32, uint32> spawn_times;
 
 	timeval tv{};
@@ -506,15 +566,6 @@ bool ZoneDatabase::PopulateZoneSpawnList(uint32 zoneid, LinkedList<Spawn2*> &spa
 
 	const char *zone_name = ZoneName(zoneid);
 
-	auto spawns = Spawn2Repository::GetWhere(
-		content_db, fmt::format(
-			"TRUE {} AND zone = '{}' AND (version = {} OR version = -1) ",
-			ContentFilterCriteria::apply(),
-			zone_name,
-			version
-		)
-	);
-
 	std::vector<uint32> spawn2_ids;
 	for (auto &s: spawns) {
 		spawn2_ids.push_back(s.id);
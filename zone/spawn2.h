@@ -24,6 +24,7 @@
 #define SC_AlwaysEnabled 0
 
 class SpawnCondition;
+class SpawnGroup;
 class NPC;
 
 class Spawn2
@@ -80,6 +81,7 @@ public:
 	inline void SetEntityVariables(std::map<std::string, std::string> vars) { m_entity_variables = vars; }
 	inline void SetResumedNPCID(uint32 npc_id) { m_resumed_npc_id = npc_id; }
 	inline void SetStoredLocation(const glm::vec4& loc) { m_stored_location = loc; }
+	inline bool IsPendingRemoval() const { return m_pending_removal; }
 
 protected:
 	friend class Zone;
@@ -89,6 +91,9 @@ private:
 	uint32 m_respawn_time;
 	uint32	resetTimer();
 	uint32	despawnTimer(uint32 despawn_timer);
+	bool	IsHeldByNPC(SpawnGroup *spawn_group);
+	bool	SpawnDue(SpawnGroup *spawn_group);
+	void	OnTimer();
 
 	uint32	spawngroup_id_;
 	uint32	currentnpcid;
@@ -110,6 +115,7 @@ private:
 	uint32 m_resumed_npc_id = 0;
 	std::map<std::string, std::string> m_entity_variables = {};
 	glm::vec4 m_stored_location = {0, 0, -1000, 0}; // use -1000 to indicate unset/zero-state
+	bool m_pending_removal = false;
 };
 
 class SpawnCondition {
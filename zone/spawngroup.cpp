@@ -163,6 +163,15 @@ void SpawnGroupList::ClearSpawnGroups()
 	m_spawn_groups.clear();
 }
 
+void SpawnGroupList::TakeSpawnGroups(SpawnGroupList &other)
+{
+	for (auto &e : other.m_spawn_groups) {
+		m_spawn_groups[e.first] = std::move(e.second);
+	}
+
+	other.m_spawn_groups.clear();
+}
+
 bool ZoneDatabase::LoadSpawnGroups(const char *zone_name, uint16 version, SpawnGroupList *spawn_group_list)
 {
 	std::string query = fmt::format(
@@ -82,6 +82,7 @@ public:
 	SpawnGroup *GetSpawnGroup(uint32 id);
 	void ClearSpawnGroups();
 	void ReloadSpawnGroups();
+	void TakeSpawnGroups(SpawnGroupList &other); // moves every group out of other, replacing ones with the same id
 private:
 	std::map<uint32, std::unique_ptr<SpawnGroup>> m_spawn_groups;
 };
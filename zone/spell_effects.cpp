@@ -3859,6 +3859,8 @@ void Mob::BuffProcess()
 				if(!zone->BuffTimersSuspended() || !IsSuspendableSpell(buffs[buffs_i].spellid))
 				{
 					--buffs[buffs_i].ticsremaining;
+					// some effect formulas scale with the tics left
+					SetBonusesDirty(BonusLayer::Spells);
 
 					if (buffs[buffs_i].ticsremaining < 0) {
 						LogSpells("Buff [{}] in slot [{}] has expired. Fading", buffs[buffs_i].spellid, buffs_i);
@@ -4669,6 +4671,7 @@ void Mob::BuffFadeBySlot(int slot, bool iRecalcBonuses)
 		RemoveNimbusEffect(spells[buffs[slot].spellid].nimbus_effect);
 
 	buffs[slot].spellid = SPELL_UNKNOWN;
+	RefreshActiveBuffEffects();
 	if(IsPet() && GetOwner() && GetOwner()->IsClient()) {
 		SendPetBuffsToClient();
 	}
@@ -7296,6 +7299,10 @@ bool Mob::TryDeathSave() {
 
 bool Mob::AffectedBySpellExcludingSlot(int slot, int effect)
 {
+	if (CanUseActiveBuffEffects(effect) && !m_active_buff_effects.test(effect)) {
+		return false;
+	}
+
 	int buff_count = GetMaxTotalSlots();
 	for (int i = 0; i < buff_count; i++)
 	{
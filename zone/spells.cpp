@@ -3737,8 +3737,19 @@ int Mob::AddBuff(Mob *caster, uint16 spell_id, int duration, int32 level_overrid
 		}
 	}
 
+	// a bard pulse can land on a slot without fading what was there
+	const bool replaced_other = IsValidSpell(buffs[emptyslot].spellid) && buffs[emptyslot].spellid != spell_id;
+
 	buffs[emptyslot].spellid = spell_id;
 	buffs[emptyslot].casterlevel = caster_level;
+
+	if (replaced_other) {
+		RefreshActiveBuffEffects();
+	} else {
+		m_active_buff_effects |= GetSpellEffectBits(spell_id);
+		SetBonusesDirty(BonusLayer::Spells);
+	}
+
 	if (caster && !caster->IsAura()) // maybe some other things we don't want to ...
 		strcpy(buffs[emptyslot].caster_name, caster->GetCleanName());
 	else
@@ -6282,13 +6293,14 @@ bool Client::SpellBucketCheck(uint16 spell_id, uint32 character_id)
 
 // TODO get rid of this
 int16 Mob::GetBuffSlotFromType(uint16 type) {
+	if (CanUseActiveBuffEffects(type) && !m_active_buff_effects.test(type)) {
+		return -1;
+	}
+
 	uint32 buff_count = GetMaxTotalSlots();
 	for (int i = 0; i < buff_count; i++) {
-		if (IsValidSpell(buffs[i].spellid)) {
-			for (int j = 0; j < EFFECT_COUNT; j++) {
-				if (spells[buffs[i].spellid].effect_id[j] == type )
-					return i;
-			}
+		if (IsValidSpell(buffs[i].spellid) && IsEffectInSpell(buffs[i].spellid, type)) {
+			return i;
 		}
 	}
 	return -1;
@@ -6303,9 +6315,19 @@ uint16 Mob::GetSpellIDFromSlot(uint8 slot)
 }
 
 bool Mob::FindType(uint16 type, bool bOffensive, uint16 threshold) {
+	if (CanUseActiveBuffEffects(type)) {
+		if (!m_active_buff_effects.test(type)) {
+			return false;
+		}
+
+		if (!bOffensive) {
+			return true;
+		}
+	}
+
 	int buff_count = GetMaxTotalSlots();
 	for (int i = 0; i < buff_count; i++) {
-		if (IsValidSpell(buffs[i].spellid)) {
+		if (IsValidSpell(buffs[i].spellid) && IsEffectInSpell(buffs[i].spellid, type)) {
 			for (int j = 0; j < EFFECT_COUNT; j++) {
 				// adjustments necessary for offensive npc casting behavior
 				if (bOffensive) {
@@ -6334,6 +6356,38 @@ bool Mob::FindType(uint16 type, bool bOffensive, uint16 threshold) {
 	return false;
 }
 
+void Mob::RefreshActiveBuffEffects()
+{
+	m_active_buff_effects.reset();
+	m_active_buff_effects_generation = GetSpellEffectIndexGeneration();
+	SetBonusesDirty(BonusLayer::Spells);
+
+	if (!buffs) {
+		return;
+	}
+
+	int buff_count = GetMaxTotalSlots();
+	for (int i = 0; i < buff_count; i++) {
+		if (IsValidSpell(buffs[i].spellid)) {
+			m_active_buff_effects |= GetSpellEffectBits(buffs[i].spellid);
+		}
+	}
+}
+
+bool Mob::CanUseActiveBuffEffects(int effect)
+{
+	// without the spell effect index the bits stay empty, callers fall back to scanning the buffs
+	if (effect < 0 || effect >= SPELL_EFFECT_BITSET_SIZE || GetSpellEffectIndexGeneration() == 0) {
+		return false;
+	}
+
+	if (m_active_buff_effects_generation != GetSpellEffectIndexGeneration()) {
+		RefreshActiveBuffEffects();
+	}
+
+	return true;
+}
+
 bool Mob::IsCombatProc(uint16 spell_id) {
 
 	if (RuleB(Spells, FocusCombatProcs)) {
@@ -6718,6 +6772,7 @@ void Mob::BuffModifyDurationBySpellID(uint16 spell_id, int32 newDuration)
 		if (buffs[i].spellid == spell_id)
 		{
 			buffs[i].ticsremaining = newDuration;
+			SetBonusesDirty(BonusLayer::Spells);
 			if(IsClient())
 			{
 				CastToClient()->SendBuffDurationPacket(buffs[i], i);
@@ -6752,6 +6807,7 @@ void Client::InitializeBuffSlots()
 		buffs[x].spellid = SPELL_UNKNOWN;
 		buffs[x].UpdateClient = false;
 	}
+	m_active_buff_effects.reset();
 }
 
 void Client::UninitializeBuffSlots()
@@ -6767,6 +6823,7 @@ void NPC::InitializeBuffSlots()
 		buffs[x].spellid      = SPELL_UNKNOWN;
 		buffs[x].UpdateClient = false;
 	}
+	m_active_buff_effects.reset();
 }
 
 void NPC::UninitializeBuffSlots()
@@ -456,7 +456,30 @@ const TaskInformation* ClientTaskState::GetTaskData(const ClientTaskInformation&
 	return TaskManager::Instance()->GetTaskData(client_task.task_id);
 }
 
-bool ClientTaskState::CanUpdate(Client* client, const TaskUpdateFilter& filter, int task_id,
+TaskMatchTarget::TaskMatchTarget(Mob* mob)
+{
+	if (!mob)
+	{
+		return;
+	}
+
+	valid       = true;
+	name        = Strings::ToLower(mob->GetName());
+	clean_name  = Strings::ToLower(mob->GetCleanName());
+	npc_type_id = mob->GetNPCTypeID();
+
+	for (const auto& s : { &name, &clean_name })
+	{
+		size_t run = 0;
+		for (char c : *s)
+		{
+			run = isdigit(static_cast<unsigned char>(c)) ? run + 1 : 0;
+			longest_digit_run = std::max(longest_digit_run, run);
+		}
+	}
+}
+
+bool ClientTaskState::CanUpdate(Client* client, const TaskUpdateFilter& filter, const TaskMatchTarget& target, int task_id,
 	const ActivityInformation& activity, const ClientActivityInformation& client_activity) const
 {
 	if (activity.goal_method == METHODQUEST && activity.goal_method != filter.method)
@@ -499,18 +522,17 @@ bool ClientTaskState::CanUpdate(Client* client, const TaskUpdateFilter& filter,
 	}
 
 	// item is only checked for updates that provide an item to check (unlike npc which may be null for non-npcs)
-	if (!activity.item_id_list.empty() && filter.item_id != 0 &&
-	    !Tasks::IsInMatchList(activity.item_id_list, std::to_string(filter.item_id)))
+	if (!activity.item_matcher.empty && filter.item_id != 0 && !activity.item_matcher.HasId(filter.item_id))
 	{
 		LogTasks("client [{}] task [{}]-[{}] failed item match filter", client->GetName(), task_id, client_activity.activity_id);
 		return false;
 	}
 
 	// npc filter supports both npc names and ids in match lists
-	if (!activity.npc_match_list.empty() && (!filter.mob ||
-	    (!Tasks::IsInMatchListPartial(activity.npc_match_list, filter.mob->GetName()) &&
-	     !Tasks::IsInMatchListPartial(activity.npc_match_list, filter.mob->GetCleanName()) &&
-	     !Tasks::IsInMatchList(activity.npc_match_list, std::to_string(filter.mob->GetNPCTypeID())))))
+	if (!activity.npc_matcher.empty && (!target.valid ||
+	    (!activity.npc_matcher.HasPartial(target.name) &&
+	     !activity.npc_matcher.HasPartial(target.clean_name) &&
+	     !activity.npc_matcher.HasId(target.npc_type_id))))
 	{
 		LogTasks("client [{}] task [{}]-[{}] failed npc match filter", client->GetName(), task_id, client_activity.activity_id);
 		return false;
@@ -519,12 +541,112 @@ bool ClientTaskState::CanUpdate(Client* client, const TaskUpdateFilter& filter,
 	return true;
 }
 
+void ClientTaskState::BuildActivityIndex()
+{
+	m_activity_index.clear();
+	m_indexed_generation   = TaskManager::Instance()->GetGeneration();
+	m_activity_index_built = true;
+
+	for (int i = 0; i < static_cast<int>(m_indexed_task_ids.size()); ++i)
+	{
+		const auto& client_task = m_active_tasks[i];
+		m_indexed_task_ids[i] = client_task.task_id;
+
+		const auto task = GetTaskData(client_task);
+		if (!task)
+		{
+			continue;
+		}
+
+		for (int activity_id = 0; activity_id < task->activity_count; ++activity_id)
+		{
+			const auto& activity = task->activity_information[activity_id];
+			const ActivityRef ref{ static_cast<uint8>(i), static_cast<uint8>(activity_id) };
+
+			auto& index = m_activity_index[static_cast<int32>(activity.activity_type)];
+			if (!activity.npc_matcher.ids_only)
+			{
+				index.scanned.push_back(ref);
+				continue;
+			}
+
+			index.npc_id_lists.push_back(ref);
+			index.shortest_npc_id = std::min(index.shortest_npc_id, activity.npc_matcher.shortest_partial);
+			for (const auto& id : activity.npc_matcher.ids)
+			{
+				index.by_npc_id[id].push_back(ref);
+			}
+		}
+	}
+}
+
+void ClientTaskState::GetCandidateActivities(TaskActivityType type, const TaskMatchTarget& target, std::vector<ActivityRef>& out)
+{
+	bool stale = !m_activity_index_built || m_indexed_generation != TaskManager::Instance()->GetGeneration();
+	for (int i = 0; !stale && i < static_cast<int>(m_indexed_task_ids.size()); ++i)
+	{
+		stale = m_active_tasks[i].task_id != m_indexed_task_ids[i];
+	}
+
+	if (stale)
+	{
+		BuildActivityIndex();
+	}
+
+	auto it = m_activity_index.find(static_cast<int32>(type));
+	if (it == m_activity_index.end())
+	{
+		return;
+	}
+
+	const auto& index = it->second;
+
+	out.insert(out.end(), index.scanned.begin(), index.scanned.end());
+
+	// id-only lists still go through the partial name match, so a name with a long enough run of digits has to see them all
+	if (target.valid && target.longest_digit_run >= index.shortest_npc_id)
+	{
+		out.insert(out.end(), index.npc_id_lists.begin(), index.npc_id_lists.end());
+	}
+	else if (target.valid)
+	{
+		auto id = index.by_npc_id.find(target.npc_type_id);
+		if (id != index.by_npc_id.end())
+		{
+			out.insert(out.end(), id->second.begin(), id->second.end());
+		}
+	}
+
+	// same order as walking every task slot and activity
+	std::sort(out.begin(), out.end(), [](const ActivityRef& a, const ActivityRef& b) {
+		return a.task_index != b.task_index ? a.task_index < b.task_index : a.activity_id < b.activity_id;
+	});
+}
+
 int ClientTaskState::UpdateTasks(Client* client, const TaskUpdateFilter& filter, int count)
 {
 	int max_updated = 0;
 
-	for (const auto& client_task : m_active_tasks)
+	const TaskMatchTarget target(filter.mob);
+
+	std::vector<ActivityRef> candidates;
+	GetCandidateActivities(filter.type, target, candidates);
+
+	int done_task_index = -1;
+	for (const auto& candidate : candidates)
 	{
+		if (candidate.task_index == done_task_index)
+		{
+			continue;
+		}
+
+		// an earlier update in this pass may have completed the task and freed its slot
+		const auto& client_task = m_active_tasks[candidate.task_index];
+		if (client_task.task_id != m_indexed_task_ids[candidate.task_index])
+		{
+			continue;
+		}
+
 		const auto task = GetTaskData(client_task);
 		if (!task)
 		{
@@ -538,47 +660,45 @@ int ClientTaskState::UpdateTasks(Client* client, const TaskUpdateFilter& filter,
 			continue;
 		}
 
-		for (const ClientActivityInformation& client_activity : client_task.activity)
+		const ClientActivityInformation& client_activity = client_task.activity[candidate.activity_id];
+		const ActivityInformation& activity = task->activity_information[candidate.activity_id];
+
+		if (CanUpdate(client, filter, target, client_task.task_id, activity, client_activity))
 		{
-			const ActivityInformation& activity = task->activity_information[client_activity.activity_id];
+			if (parse->PlayerHasQuestSub(EVENT_TASK_BEFORE_UPDATE)) {
+				const auto& export_string = fmt::format(
+					"{} {} {}",
+					count,
+					client_activity.activity_id,
+					client_task.task_id
+				);
 
-			if (CanUpdate(client, filter, client_task.task_id, activity, client_activity))
-			{
-				if (parse->PlayerHasQuestSub(EVENT_TASK_BEFORE_UPDATE)) {
-					const auto& export_string = fmt::format(
-						"{} {} {}",
-						count,
-						client_activity.activity_id,
-						client_task.task_id
+				if (parse->EventPlayer(EVENT_TASK_BEFORE_UPDATE, client, export_string, 0) != 0) {
+					LogTasks(
+						"client [{}] task [{}]-[{}] update prevented by quest",
+						client->GetName(),
+						client_task.task_id,
+						client_activity.activity_id
 					);
 
-					if (parse->EventPlayer(EVENT_TASK_BEFORE_UPDATE, client, export_string, 0) != 0) {
-						LogTasks(
-							"client [{}] task [{}]-[{}] update prevented by quest",
-							client->GetName(),
-							client_task.task_id,
-							client_activity.activity_id
-						);
-
-						continue;
-					}
+					continue;
 				}
+			}
 
-				LogTasks(
-					"client [{}] task [{}] activity [{}] increment [{}]",
-					client->GetName(),
-					client_task.task_id,
-					client_activity.activity_id,
-					count
-				);
+			LogTasks(
+				"client [{}] task [{}] activity [{}] increment [{}]",
+				client->GetName(),
+				client_task.task_id,
+				client_activity.activity_id,
+				count
+			);
 
-				int updated = IncrementDoneCount(client, task, client_task.slot, client_activity.activity_id, count);
-				max_updated = std::max(max_updated, updated);
+			int updated = IncrementDoneCount(client, task, client_task.slot, client_activity.activity_id, count);
+			max_updated = std::max(max_updated, updated);
 
-				if (RuleB(TaskSystem, UpdateOneElementPerTask))
-				{
-					break; // only one element updated per task, move to next task
-				}
+			if (RuleB(TaskSystem, UpdateOneElementPerTask))
+			{
+				done_task_index = candidate.task_index; // only one element updated per task, move to next task
 			}
 		}
 	}
@@ -588,6 +708,8 @@ int ClientTaskState::UpdateTasks(Client* client, const TaskUpdateFilter& filter,
 
 std::pair<int, int> ClientTaskState::FindTask(Client* client, const TaskUpdateFilter& filter) const
 {
+	const TaskMatchTarget target(filter.mob);
+
 	for (const auto& client_task : m_active_tasks)
 	{
 		const auto task = GetTaskData(client_task);
@@ -599,7 +721,7 @@ std::pair<int, int> ClientTaskState::FindTask(Client* client, const TaskUpdateFi
 		for (const ClientActivityInformation& client_activity : client_task.activity)
 		{
 			const ActivityInformation& activity = task->activity_information[client_activity.activity_id];
-			if (CanUpdate(client, filter, client_task.task_id, activity, client_activity))
+			if (CanUpdate(client, filter, target, client_task.task_id, activity, client_activity))
 			{
 				return std::make_pair(client_task.task_id, client_activity.activity_id);
 			}
@@ -3,7 +3,10 @@
 
 #include "tasks.h"
 #include "../common/types.h"
+#include <array>
+#include <cstdint>
 #include <list>
+#include <unordered_map>
 #include <vector>
 #include <string>
 #include <algorithm>
@@ -30,6 +33,18 @@ struct TaskUpdateFilter
 	TaskMethodType method = TaskMethodType::METHODSINGLEID;
 };
 
+// the mob an update is about, lowered once per update instead of once per activity
+struct TaskMatchTarget
+{
+	explicit TaskMatchTarget(Mob* mob);
+
+	bool        valid             = false;
+	std::string name;
+	std::string clean_name;
+	uint32      npc_type_id       = 0;
+	size_t      longest_digit_run = 0; // an id list entry longer than this can't partially match either name
+};
+
 class ClientTaskState {
 
 public:
@@ -109,7 +124,7 @@ private:
 
 	void AddOffer(int task_id, uint16_t npc_entity_id) { m_last_offers.push_back({task_id, npc_entity_id}); };
 	void AddReplayTimer(Client *client, ClientTaskInformation& client_task, const TaskInformation& task);
-	bool CanUpdate(Client* client, const TaskUpdateFilter& filter, int task_id,
+	bool CanUpdate(Client* client, const TaskUpdateFilter& filter, const TaskMatchTarget& target, int task_id,
 		const ActivityInformation& activity, const ClientActivityInformation& client_activity) const;
 	int DispatchEventTaskComplete(Client* client, ClientTaskInformation& client_task, int activity_id);
 	std::pair<int, int> FindTask(Client* client, const TaskUpdateFilter& filter) const;
@@ -117,6 +132,24 @@ private:
 	void UpdateTasksOnKill(Client* client, Client* exp_client, NPC* npc);
 	int UpdateTasks(Client* client, const TaskUpdateFilter& filter, int count = 1);
 
+	struct ActivityRef
+	{
+		uint8 task_index; // into m_active_tasks
+		uint8 activity_id;
+	};
+
+	// active activities of one type. Those whose npc match list is nothing but ids are also keyed by each id
+	struct ActivityTypeIndex
+	{
+		std::unordered_map<uint32, std::vector<ActivityRef>> by_npc_id;
+		std::vector<ActivityRef>                             npc_id_lists;
+		size_t                                               shortest_npc_id = SIZE_MAX;
+		std::vector<ActivityRef>                             scanned;
+	};
+
+	void BuildActivityIndex();
+	void GetCandidateActivities(TaskActivityType type, const TaskMatchTarget& target, std::vector<ActivityRef>& out);
+
 	int IncrementDoneCount(
 		Client *client,
 		const TaskInformation* task_data,
@@ -172,6 +205,12 @@ private:
 	std::vector<TaskOffer>                m_last_offers;
 	bool                                  m_has_explore_task = false;
 
+	// rebuilt when a task slot changes hands or tasks are reloaded, see BuildActivityIndex
+	std::unordered_map<int32, ActivityTypeIndex> m_activity_index;
+	std::array<int, MAXACTIVEQUESTS + 2>         m_indexed_task_ids{};
+	uint32                                       m_indexed_generation   = 0;
+	bool                                         m_activity_index_built = false;
+
 	static void ShowClientTaskInfoMessage(ClientTaskInformation *task, Client *c);
 
 	void SyncSharedTaskZoneClientDoneCountState(
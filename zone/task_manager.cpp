@@ -44,6 +44,7 @@ bool TaskManager::LoadTaskSets()
 bool TaskManager::LoadTasks(int single_task)
 {
 	m_task_data.clear();
+	m_generation++;
 
 	std::string task_query_filter = fmt::format("id = {}", single_task);
 	if (single_task == 0) {
@@ -206,6 +207,8 @@ bool TaskManager::LoadTasks(int single_task)
 		ad->description_override = a.description_override;
 		ad->npc_match_list       = a.npc_match_list;
 		ad->item_id_list         = a.item_id_list;
+		ad->npc_matcher.Compile(a.npc_match_list);
+		ad->item_matcher.Compile(a.item_id_list);
 		ad->dz_switch_id         = a.dz_switch_id;
 		ad->goal_method          = (TaskMethodType) a.goalmethod;
 		ad->goal_count           = a.goalcount;
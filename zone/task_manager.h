@@ -70,6 +70,9 @@ public:
 		return it != m_task_data.end() ? &it->second : nullptr;
 	}
 
+	// bumped on every (re)load, task data pointers and anything derived from them are stale once it changes
+	uint32 GetGeneration() const { return m_generation; }
+
 	static TaskManager* Instance()
 	{
 		static TaskManager instance;
@@ -79,6 +82,7 @@ public:
 private:
 	std::vector<int>                              m_task_sets[MAXTASKSETS];
 	std::unordered_map<uint32_t, TaskInformation> m_task_data;
+	uint32                                        m_generation = 0;
 	void SendActiveTaskDescription(
 		Client *client,
 		int task_id,
@@ -166,6 +166,7 @@ void Client::DoTributeUpdate() {
 				DeleteItemInInventory(EQ::invslot::TRIBUTE_BEGIN + r);
 		}
 	}
+	SetBonusesDirty(BonusLayer::Items);
 	CalcBonuses();
 }
 
@@ -501,6 +502,7 @@ void Client::DoGuildTributeUpdate()
 			DeleteItemInInventory(EQ::invslot::GUILD_TRIBUTE_BEGIN + 1);
 		}
 	}
+	SetBonusesDirty(BonusLayer::Items);
 	CalcBonuses();
 }
 
@@ -0,0 +1,97 @@
+#include "trigger_grid.h"
+
+void TriggerGrid::Add(int id, int type, float min_x, float max_x, float min_y, float max_y, float min_z, float max_z)
+{
+	Remove(id);
+
+	Box b{};
+	b.id       = id;
+	b.type     = type;
+	b.sequence = m_sequence++;
+	b.min_x    = min_x;
+	b.max_x    = max_x;
+	b.min_y    = min_y;
+	b.max_y    = max_y;
+	b.min_z    = min_z;
+	b.max_z    = max_z;
+
+	// inverted or NaN bounds can never contain a point, so there is nothing to index
+	if (!(min_x <= max_x && min_y <= max_y && min_z <= max_z)) {
+		m_boxes.emplace(id, b);
+		return;
+	}
+
+	b.min_cx = CellCoord(min_x);
+	b.max_cx = CellCoord(max_x);
+	b.min_cy = CellCoord(min_y);
+	b.max_cy = CellCoord(max_y);
+
+	const int64 cells = (static_cast<int64>(b.max_cx) - b.min_cx + 1) * (static_cast<int64>(b.max_cy) - b.min_cy + 1);
+
+	b.wide = cells > MAX_CELLS_PER_BOX;
+
+	m_boxes.emplace(id, b);
+
+	if (b.wide) {
+		m_wide.push_back(b);
+		return;
+	}
+
+	for (int32 cx = b.min_cx; cx <= b.max_cx; ++cx) {
+		for (int32 cy = b.min_cy; cy <= b.max_cy; ++cy) {
+			m_cells[CellKey(cx, cy)].push_back(b);
+		}
+	}
+}
+
+void TriggerGrid::Remove(int id)
+{
+	auto it = m_boxes.find(id);
+	if (it == m_boxes.end()) {
+		return;
+	}
+
+	Detach(it->second);
+	m_boxes.erase(it);
+}
+
+void TriggerGrid::Clear()
+{
+	m_cells.clear();
+	m_wide.clear();
+	m_boxes.clear();
+}
+
+void TriggerGrid::Detach(const Box &b)
+{
+	auto erase_from = [&b](std::vector<Box> &boxes) {
+		// keeps the survivors in add order
+		boxes.erase(
+			std::remove_if(boxes.begin(), boxes.end(), [&b](const Box &e) { return e.id == b.id; }),
+			boxes.end()
+		);
+	};
+
+	if (b.wide) {
+		erase_from(m_wide);
+		return;
+	}
+
+	if (!(b.min_x <= b.max_x && b.min_y <= b.max_y && b.min_z <= b.max_z)) {
+		return;
+	}
+
+	for (int32 cx = b.min_cx; cx <= b.max_cx; ++cx) {
+		for (int32 cy = b.min_cy; cy <= b.max_cy; ++cy) {
+			auto c = m_cells.find(CellKey(cx, cy));
+			if (c == m_cells.end()) {
+				continue;
+			}
+
+			erase_from(c->second);
+			if (c->second.empty()) {
+				m_cells.erase(c);
+			}
+		}
+	}
+}
@@ -0,0 +1,133 @@
+#ifndef EQEMU_TRIGGER_GRID_H
+#define EQEMU_TRIGGER_GRID_H
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+#include <glm/vec3.hpp>
+#include "../common/types.h"
+
+/**
+ * Static spatial hash over axis aligned trigger boxes (NPC proximities and quest areas)
+ *
+ * Each box is copied into every x/y cell it overlaps, so a point only has to be tested against the boxes in its own
+ * cell. Boxes that would span more than MAX_CELLS_PER_BOX cells are kept on a short list that every query walks
+ * instead, which keeps zone sized areas from filling the map
+ *
+ * Boxes do not move once added, re-adding an id replaces the old box and moves it to the back of the trigger order
+ */
+class TriggerGrid {
+public:
+	static constexpr float CELL_SIZE         = 128.0f;
+	static constexpr int32 MAX_CELLS_PER_BOX = 64;
+
+	struct Box {
+		int    id;
+		int    type;
+		uint32 sequence; // add order, events fire in this order
+		float  min_x, max_x;
+		float  min_y, max_y;
+		float  min_z, max_z;
+		int32  min_cx, max_cx;
+		int32  min_cy, max_cy;
+		bool   wide;
+
+		inline bool Contains(const glm::vec3 &p) const
+		{
+			return !(
+				p.x < min_x || p.x > max_x ||
+				p.y < min_y || p.y > max_y ||
+				p.z < min_z || p.z > max_z
+			);
+		}
+
+		inline bool CoversCell(int32 cx, int32 cy) const
+		{
+			return !wide && cx >= min_cx && cx <= max_cx && cy >= min_cy && cy <= max_cy;
+		}
+	};
+
+	void Add(int id, int type, float min_x, float max_x, float min_y, float max_y, float min_z, float max_z);
+	void Remove(int id);
+	void Clear();
+
+	inline size_t Size() const { return m_boxes.size(); }
+	inline size_t CellCount() const { return m_cells.size(); }
+	inline size_t WideCount() const { return m_wide.size(); }
+
+	// calls fn(box, entered) for every box that contains exactly one of from and to, without allocating
+	template<typename Fn>
+	void ForEachCrossed(const glm::vec3 &from, const glm::vec3 &to, Fn &&fn) const
+	{
+		auto visit = [&](const Box &b) {
+			const bool was_in = b.Contains(from);
+			const bool is_in  = b.Contains(to);
+			if (was_in != is_in) {
+				fn(b, is_in);
+			}
+		};
+
+		for (const auto &b : m_wide) {
+			visit(b);
+		}
+
+		if (m_cells.empty()) {
+			return;
+		}
+
+		const int32 from_cx = CellCoord(from.x);
+		const int32 from_cy = CellCoord(from.y);
+		const int32 to_cx   = CellCoord(to.x);
+		const int32 to_cy   = CellCoord(to.y);
+
+		auto it = m_cells.find(CellKey(from_cx, from_cy));
+		if (it != m_cells.end()) {
+			for (const auto &b : it->second) {
+				visit(b);
+			}
+		}
+
+		if (to_cx == from_cx && to_cy == from_cy) {
+			return;
+		}
+
+		it = m_cells.find(CellKey(to_cx, to_cy));
+		if (it != m_cells.end()) {
+			for (const auto &b : it->second) {
+				// already seen in the from cell
+				if (b.CoversCell(from_cx, from_cy)) {
+					continue;
+				}
+
+				visit(b);
+			}
+		}
+	}
+
+private:
+	static inline int32 CellCoord(float v)
+	{
+		// a NaN never lands inside a box, any cell will do; far out coordinates share the edge cells
+		if (std::isnan(v)) {
+			return 0;
+		}
+
+		return static_cast<int32>(std::floor(std::clamp(v / CELL_SIZE, -1.0e9f, 1.0e9f)));
+	}
+
+	static inline uint64 CellKey(int32 cx, int32 cy)
+	{
+		return (static_cast<uint64>(static_cast<uint32>(cx)) << 32) | static_cast<uint32>(cy);
+	}
+
+	void Detach(const Box &b);
+
+	uint32 m_sequence = 0;
+
+	std::unordered_map<uint64, std::vector<Box>> m_cells;
+	std::vector<Box>                             m_wide;
+	std::unordered_map<int, Box>                 m_boxes;
+};
+
+#endif //EQEMU_TRIGGER_GRID_H
@@ -4544,6 +4544,7 @@ void WorldServer::ProcessReload(const ServerReload::Request& request)
 	switch (request.type) {
 		case ServerReload::Type::AAData:
 			zone->LoadAlternateAdvancement();
+			Mob::InvalidateAllBonusLayers();
 			entity_list.SendAlternateAdvancementStats();
 			break;
 
@@ -4622,6 +4623,7 @@ void WorldServer::ProcessReload(const ServerReload::Request& request)
 
 		case ServerReload::Type::Rules:
 			RuleManager::Instance()->LoadRules(&database, RuleManager::Instance()->GetActiveRuleset(), true);
+			Mob::InvalidateAllBonusLayers();
 			break;
 
 		case ServerReload::Type::SkillCaps:
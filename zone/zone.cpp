@@ -54,6 +54,7 @@
 #include "npc_scale_manager.h"
 #include "../common/data_verification.h"
 #include "zone_reload.h"
+#include "zone_boot_loader.h"
 #include "../common/repositories/criteria/content_filter_criteria.h"
 #include "../common/repositories/character_exp_modifiers_repository.h"
 #include "../common/repositories/merchantlist_repository.h"
@@ -676,26 +677,11 @@ void Zone::LoadNewMerchantData(uint32 merchantid) {
 
 void Zone::LoadMerchants()
 {
-	const auto& l = MerchantlistRepository::GetWhere(
-		content_db,
-		fmt::format(
-			SQL(
-				`merchantid` IN (
-					SELECT `merchant_id` FROM `npc_types` WHERE `id` IN (
-						SELECT `npcID` FROM `spawnentry` WHERE `spawngroupID` IN (
-							SELECT `spawngroupID` FROM `spawn2` WHERE `zone` = '{}' AND (`version` = {} OR `version` = -1)
-						)
-					)
-				)
-				{}
-				ORDER BY `merchantlist`.`slot`
-			),
-			GetShortName(),
-			GetInstanceVersion(),
-			ContentFilterCriteria::apply()
-		)
-	);
+	LoadMerchants(content_db.LoadZoneMerchantLists(GetShortName(), GetInstanceVersion()));
+}
 
+void Zone::LoadMerchants(const std::vector<MerchantlistRepository::Merchantlist> &l)
+{
 	LogInfo("Loaded [{}] merchant lists", Strings::Commify(l.size()));
 
 	if (l.empty()) {
@@ -953,7 +939,11 @@ void Zone::Shutdown(bool quiet)
 
 void Zone::LoadZoneDoors()
 {
-	auto door_entries = content_db.LoadDoors(GetShortName(), GetInstanceVersion());
+	LoadZoneDoors(content_db.LoadDoors(GetShortName(), GetInstanceVersion()));
+}
+
+void Zone::LoadZoneDoors(const std::vector<DoorsRepository::Doors> &door_entries)
+{
 	if (door_entries.empty()) {
 		LogInfo("No doors loaded");
 		return;
@@ -1163,9 +1153,17 @@ bool Zone::Init(bool is_static) {
 		return false;
 	}
 
-	zonemap  = Map::LoadMapFile(map_name);
-	watermap = WaterMap::LoadWaterMapfile(map_name);
-	pathing  = IPathfinder::Load(map_name);
+	// map files parse and content tables load in the background, each is taken below where it used to be loaded
+	std::unique_ptr<ZoneBootLoader> boot;
+	if (RuleI(Zone, BootLoaderThreads) > 0) {
+		boot = std::make_unique<ZoneBootLoader>(zoneid, short_name, GetInstanceVersion(), map_name);
+		boot->Start(RuleI(Zone, BootLoaderThreads));
+	}
+	else {
+		zonemap  = Map::LoadMapFile(map_name);
+		watermap = WaterMap::LoadWaterMapfile(map_name);
+		pathing  = IPathfinder::Load(map_name);
+	}
 
 	LogInfo("Loading timezone data");
 	zone_time.setEQTimeZone(content_db.GetZoneTimezone(zoneid, GetInstanceVersion()));
@@ -1180,7 +1178,19 @@ bool Zone::Init(bool is_static) {
 
 	npc_scale_manager->LoadScaleData();
 
-	LoadGrids();
+	if (boot) {
+		auto &c = boot->Wait(ZoneBootTask::Grids);
+		zone_grids        = std::move(c.grids);
+		zone_grid_entries = std::move(c.grid_entries);
+		LogInfo(
+			"Loaded [{}] grids and [{}] grid_entries",
+			Strings::Commify(zone_grids.size()),
+			Strings::Commify(zone_grid_entries.size())
+		);
+	}
+	else {
+		LoadGrids();
+	}
 
 	if (RuleB(Zone, LevelBasedEXPMods)) {
 		LoadLevelEXPMods();
@@ -1193,6 +1203,13 @@ bool Zone::Init(bool is_static) {
 		zone->LoadZoneVariablesState();
 	}
 
+	// scripts can query the map as soon as they load
+	if (boot) {
+		zonemap  = boot->TakeMap();
+		watermap = boot->TakeWaterMap();
+		pathing  = boot->TakePathing();
+	}
+
 	// make sure that anything that needs to be loaded prior to scripts is loaded before here
 	// this is to ensure that the scripts have access to the data they need
 	parse->ReloadQuests(true);
@@ -1201,12 +1218,26 @@ bool Zone::Init(bool is_static) {
 
 	content_db.LoadStaticZonePoints(&zone_point_list, short_name, GetInstanceVersion());
 
-	if (!content_db.LoadSpawnGroups(short_name, GetInstanceVersion(), &spawn_group_list)) {
+	if (boot) {
+		auto &c = boot->Wait(ZoneBootTask::SpawnGroups);
+		if (!c.spawn_groups_loaded) {
+			LogError("Loading spawn groups failed");
+			return false;
+		}
+
+		spawn_group_list.TakeSpawnGroups(c.spawn_groups);
+	}
+	else if (!content_db.LoadSpawnGroups(short_name, GetInstanceVersion(), &spawn_group_list)) {
 		LogError("Loading spawn groups failed");
 		return false;
 	}
 
-	content_db.PopulateZoneSpawnList(zoneid, spawn2_list, GetInstanceVersion());
+	if (boot) {
+		content_db.PopulateZoneSpawnList(zoneid, spawn2_list, GetInstanceVersion(), boot->Wait(ZoneBootTask::Spawn2).spawn2);
+	}
+	else {
+		content_db.PopulateZoneSpawnList(zoneid, spawn2_list, GetInstanceVersion());
+	}
 	SetSaveZoneState(true);
 
 	database.LoadCharacterCorpses(zoneid, instanceid);
@@ -1217,14 +1248,24 @@ bool Zone::Init(bool is_static) {
 	LoadAdventureFlavor();
 	LoadGroundSpawns();
 	LoadZoneObjects();
-	LoadZoneDoors();
+	if (boot) {
+		LoadZoneDoors(boot->Wait(ZoneBootTask::Doors).doors);
+	}
+	else {
+		LoadZoneDoors();
+	}
 	LoadZoneBlockedSpells();
 	LoadVeteranRewards();
 	LoadAlternateCurrencies();
 	LoadNPCEmotes(&npc_emote_list);
 	LoadAlternateAdvancement();
 	LoadBaseData();
-	LoadMerchants();
+	if (boot) {
+		LoadMerchants(boot->Wait(ZoneBootTask::Merchants).merchants);
+	}
+	else {
+		LoadMerchants();
+	}
 	LoadTempMerchantData();
 
 	// Merc data
@@ -1539,17 +1580,22 @@ bool Zone::Process() {
 	spawn_conditions.Process();
 
 	if (spawn2_timer.Check()) {
-		LinkedListIterator<Spawn2 *> iterator(spawn2_list);
-
 		EQ::InventoryProfile::CleanDirty();
 
-		iterator.Reset();
-		while (iterator.MoreElements()) {
-			if (iterator.GetData()->Process()) {
-				iterator.Advance();
-			}
-			else {
-				iterator.RemoveCurrent();
+		// spawn points respawn off their own timers on the timer wheel, only the ones that failed are left to drop
+		if (spawn2_removals_pending) {
+			spawn2_removals_pending = false;
+
+			LinkedListIterator<Spawn2 *> iterator(spawn2_list);
+
+			iterator.Reset();
+			while (iterator.MoreElements()) {
+				if (iterator.GetData()->IsPendingRemoval()) {
+					iterator.RemoveCurrent();
+				}
+				else {
+					iterator.Advance();
+				}
 			}
 		}
 
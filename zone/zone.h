@@ -208,6 +208,8 @@ public:
 	IPathfinder                                   *pathing;
 	std::vector<NPC_Emote_Struct *>               npc_emote_list;
 	LinkedList<Spawn2 *>                          spawn2_list;
+	// set when a spawn point's timer gave up on it, spawn2_list is swept on the next spawn2_timer pass
+	bool                                          spawn2_removals_pending = false;
 	LinkedList<ZonePoint *>                       zone_point_list;
 	std::vector<ZonePointsRepository::ZonePoints> virtual_zone_point_list;
 
@@ -305,6 +307,7 @@ public:
 	void DoAdventureAssassinationCountIncrease();
 	void DoAdventureCountIncrease();
 	void LoadMerchants();
+	void LoadMerchants(const std::vector<MerchantlistRepository::Merchantlist> &l);
 	void GetTimeSync();
 	void LoadAdventureFlavor();
 	void LoadAlternateAdvancement();
@@ -322,6 +325,7 @@ public:
 	void LoadTempMerchantData();
 	void LoadVeteranRewards();
 	void LoadZoneDoors();
+	void LoadZoneDoors(const std::vector<DoorsRepository::Doors> &door_entries);
 	void ReloadStaticData();
 	void RemoveAuth(const char *iCharName, const char *iLSKey);
 	void RemoveAuth(uint32 lsid);
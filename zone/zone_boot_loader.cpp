@@ -0,0 +1,172 @@
+#include <algorithm>
+#include "zone_boot_loader.h"
+#include "map.h"
+#include "water_map.h"
+#include "pathfinder_interface.h"
+#include "../common/eqemu_config.h"
+#include "../common/eqemu_logsys.h"
+
+extern ZoneDatabase content_db;
+
+ZoneBootLoader::ZoneBootLoader(
+	uint32 zone_id,
+	const std::string &short_name,
+	int16 instance_version,
+	const std::string &map_name
+) : m_zone_id(zone_id), m_short_name(short_name), m_instance_version(instance_version), m_map_name(map_name)
+{
+	auto &grids = m_tasks[static_cast<size_t>(ZoneBootTask::Grids)];
+	grids.name = "grids";
+	grids.run  = [this](ZoneDatabase &db) {
+		m_content.grids        = GridRepository::GetZoneGrids(db, m_zone_id);
+		m_content.grid_entries = GridEntriesRepository::GetZoneGridEntries(db, m_zone_id);
+	};
+
+	auto &spawn_groups = m_tasks[static_cast<size_t>(ZoneBootTask::SpawnGroups)];
+	spawn_groups.name = "spawn groups";
+	spawn_groups.run  = [this](ZoneDatabase &db) {
+		m_content.spawn_groups_loaded = db.LoadSpawnGroups(
+			m_short_name.c_str(),
+			m_instance_version,
+			&m_content.spawn_groups
+		);
+	};
+
+	auto &spawn2 = m_tasks[static_cast<size_t>(ZoneBootTask::Spawn2)];
+	spawn2.name = "spawn2";
+	spawn2.run  = [this](ZoneDatabase &db) {
+		m_content.spawn2 = db.LoadZoneSpawn2(m_short_name, m_instance_version);
+	};
+
+	auto &doors = m_tasks[static_cast<size_t>(ZoneBootTask::Doors)];
+	doors.name = "doors";
+	doors.run  = [this](ZoneDatabase &db) {
+		m_content.doors = db.LoadDoors(m_short_name, m_instance_version);
+	};
+
+	auto &merchants = m_tasks[static_cast<size_t>(ZoneBootTask::Merchants)];
+	merchants.name = "merchants";
+	merchants.run  = [this](ZoneDatabase &db) {
+		m_content.merchants = db.LoadZoneMerchantLists(m_short_name, m_instance_version);
+	};
+}
+
+ZoneBootLoader::~ZoneBootLoader()
+{
+	for (auto &t : m_workers) {
+		if (t.joinable()) {
+			t.join();
+		}
+	}
+
+	// anything Init bailed out before taking
+	if (m_map.valid()) {
+		delete m_map.get();
+	}
+
+	if (m_water_map.valid()) {
+		delete m_water_map.get();
+	}
+
+	if (m_pathing.valid()) {
+		delete m_pathing.get();
+	}
+}
+
+void ZoneBootLoader::Start(int db_workers)
+{
+	m_started_at = std::chrono::steady_clock::now();
+
+	m_map       = std::async(std::launch::async, [name = m_map_name] { return Map::LoadMapFile(name); });
+	m_water_map = std::async(std::launch::async, [name = m_map_name] { return WaterMap::LoadWaterMapfile(name); });
+	m_pathing   = std::async(std::launch::async, [name = m_map_name] { return IPathfinder::Load(name); });
+
+	const int workers = std::min(db_workers, static_cast<int>(m_tasks.size()));
+	for (int i = 0; i < workers; i++) {
+		m_workers.emplace_back(&ZoneBootLoader::ContentWorker, this, i);
+	}
+
+	LogInfo("Parallel boot started with [{}] content worker(s)", workers);
+}
+
+Map *ZoneBootLoader::TakeMap()
+{
+	return m_map.valid() ? m_map.get() : nullptr;
+}
+
+WaterMap *ZoneBootLoader::TakeWaterMap()
+{
+	return m_water_map.valid() ? m_water_map.get() : nullptr;
+}
+
+IPathfinder *ZoneBootLoader::TakePathing()
+{
+	return m_pathing.valid() ? m_pathing.get() : nullptr;
+}
+
+ZoneBootContent &ZoneBootLoader::Wait(ZoneBootTask task)
+{
+	auto &t = m_tasks[static_cast<size_t>(task)];
+
+	bool expected = false;
+	if (t.claimed.compare_exchange_strong(expected, true)) {
+		RunTask(t, content_db, "zone thread");
+		return m_content;
+	}
+
+	std::unique_lock<std::mutex> lock(m_done_lock);
+	m_done_cv.wait(lock, [&] { return t.done; });
+
+	return m_content;
+}
+
+void ZoneBootLoader::RunTask(ContentTask &t, ZoneDatabase &db, const std::string &runner)
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	t.run(db);
+
+	{
+		std::unique_lock<std::mutex> lock(m_done_lock);
+		t.done = true;
+	}
+
+	m_done_cv.notify_all();
+
+	const auto now = std::chrono::steady_clock::now();
+	LogInfo(
+		"Parallel boot loaded [{}] on [{}] in [{}] ms ([{}] ms since boot start)",
+		t.name,
+		runner,
+		std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count(),
+		std::chrono::duration_cast<std::chrono::milliseconds>(now - m_started_at).count()
+	);
+}
+
+void ZoneBootLoader::ContentWorker(int worker_id)
+{
+	auto c = EQEmuConfig::get();
+
+	// content tables live in the content database when one is configured
+	const bool content = !c->ContentDbHost.empty();
+
+	ZoneDatabase db;
+	if (!db.Connect(
+		content ? c->ContentDbHost : c->DatabaseHost,
+		content ? c->ContentDbUsername : c->DatabaseUsername,
+		content ? c->ContentDbPassword : c->DatabasePassword,
+		content ? c->ContentDbName : c->DatabaseDB,
+		content ? c->ContentDbPort : c->DatabasePort,
+		fmt::format("boot-{}", worker_id)
+	)) {
+		LogError("Parallel boot worker [{}] failed to connect, the zone thread picks up its loads", worker_id);
+		return;
+	}
+
+	for (auto &t : m_tasks) {
+		bool expected = false;
+		if (t.claimed.compare_exchange_strong(expected, true)) {
+			RunTask(t, db, fmt::format("worker {}", worker_id));
+		}
+	}
+}
@@ -0,0 +1,100 @@
+#ifndef EQEMU_ZONE_BOOT_LOADER_H
+#define EQEMU_ZONE_BOOT_LOADER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../common/types.h"
+#include "../common/repositories/grid_repository.h"
+#include "../common/repositories/grid_entries_repository.h"
+#include "spawngroup.h"
+#include "zonedb.h"
+
+class Map;
+class WaterMap;
+class IPathfinder;
+
+enum class ZoneBootTask : uint8 {
+	Grids = 0,
+	SpawnGroups,
+	Spawn2,
+	Doors,
+	Merchants,
+	Count
+};
+
+// zone content fetched off the zone thread, each field is written by exactly one task
+struct ZoneBootContent {
+	std::vector<GridRepository::Grid>                 grids;
+	std::vector<GridEntriesRepository::GridEntries>   grid_entries;
+	SpawnGroupList                                    spawn_groups;
+	bool                                              spawn_groups_loaded = false;
+	std::vector<Spawn2Repository::Spawn2>             spawn2;
+	std::vector<DoorsRepository::Doors>               doors;
+	std::vector<MerchantlistRepository::Merchantlist> merchants;
+};
+
+/**
+ * Parallel bootstrap for Zone::Init
+ *
+ * Map, water map and navmesh files are parsed on their own threads, and the zone's content tables are read by a
+ * small pool of workers that each open their own database connection. Nothing here touches the zone or the entity
+ * list; Zone::Init takes the results on the zone thread at the point it used to load each of them, so the commit
+ * order (and everything that depends on it) stays the same as a serial boot
+ *
+ * Waiting on a task no worker has picked up yet runs it on the zone thread instead, so a worker that fails to connect
+ * only costs the parallelism
+ */
+class ZoneBootLoader {
+public:
+	ZoneBootLoader(uint32 zone_id, const std::string &short_name, int16 instance_version, const std::string &map_name);
+	~ZoneBootLoader();
+
+	void Start(int db_workers);
+
+	// each blocks until its file has been parsed, ownership passes to the caller
+	Map *TakeMap();
+	WaterMap *TakeWaterMap();
+	IPathfinder *TakePathing();
+
+	// blocks until the task has run, the matching ZoneBootContent fields are then safe to read or move out of
+	ZoneBootContent &Wait(ZoneBootTask task);
+
+private:
+	struct ContentTask {
+		const char                         *name = "";
+		std::function<void(ZoneDatabase &)> run;
+		std::atomic_bool                    claimed{false};
+		bool                                done = false; // guarded by m_done_lock
+	};
+
+	void ContentWorker(int worker_id);
+	void RunTask(ContentTask &t, ZoneDatabase &db, const std::string &runner);
+
+	uint32      m_zone_id;
+	std::string m_short_name;
+	int16       m_instance_version;
+	std::string m_map_name;
+
+	std::future<Map *>         m_map;
+	std::future<WaterMap *>    m_water_map;
+	std::future<IPathfinder *> m_pathing;
+
+	ZoneBootContent                                                   m_content;
+	std::array<ContentTask, static_cast<size_t>(ZoneBootTask::Count)> m_tasks;
+	std::vector<std::thread>                                          m_workers;
+	std::mutex                                                        m_done_lock;
+	std::condition_variable                                           m_done_cv;
+
+	std::chrono::steady_clock::time_point m_started_at;
+};
+
+#endif //EQEMU_ZONE_BOOT_LOADER_H
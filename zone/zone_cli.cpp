@@ -29,8 +29,12 @@ void ZoneCLI::CommandHandler(int argc, char **argv)
 	auto function_map = EQEmuCommand::function_map;
 
 	// Register commands
+	function_map["benchmark:close-mobs"]         = &ZoneCLI::BenchmarkCloseMobs;
+	function_map["benchmark:compression"]        = &ZoneCLI::BenchmarkCompression;
 	function_map["benchmark:databuckets"]        = &ZoneCLI::BenchmarkDatabuckets;
+	function_map["benchmark:raycast"]            = &ZoneCLI::BenchmarkRaycast;
 	function_map["sidecar:serve-http"]           = &ZoneCLI::SidecarServeHttp;
+	function_map["tests:bonus-layers"]           = &ZoneCLI::TestBonusLayers;
 	function_map["tests:databuckets"]            = &ZoneCLI::TestDataBuckets;
 	function_map["tests:npc-handins"]            = &ZoneCLI::TestNpcHandins;
 	function_map["tests:npc-handins-multiquest"] = &ZoneCLI::TestNpcHandinsMultiQuest;
@@ -40,11 +44,15 @@ void ZoneCLI::CommandHandler(int argc, char **argv)
 }
 
 // cli
+#include "cli/benchmark_close_mobs.cpp"
+#include "cli/benchmark_compression.cpp"
 #include "cli/benchmark_databuckets.cpp"
+#include "cli/benchmark_raycast.cpp"
 #include "cli/sidecar_serve_http.cpp"
 
 // tests
 #include "cli/tests/_test_util.cpp"
+#include "cli/tests/bonus_layers.cpp"
 #include "cli/tests/databuckets.cpp"
 #include "cli/tests/npc_handins.cpp"
 #include "cli/tests/npc_handins_multiquest.cpp"
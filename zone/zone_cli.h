@@ -7,11 +7,15 @@
 class ZoneCLI {
 public:
 	static void CommandHandler(int argc, char **argv);
+	static void BenchmarkCloseMobs(int argc, char **argv, argh::parser &cmd, std::string &description);
+	static void BenchmarkCompression(int argc, char **argv, argh::parser &cmd, std::string &description);
 	static void BenchmarkDatabuckets(int argc, char **argv, argh::parser &cmd, std::string &description);
+	static void BenchmarkRaycast(int argc, char **argv, argh::parser &cmd, std::string &description);
 	static void SidecarServeHttp(int argc, char **argv, argh::parser &cmd, std::string &description);
 	static bool RanConsoleCommand(int argc, char **argv);
 	static bool RanSidecarCommand(int argc, char **argv);
 	static bool RanTestCommand(int argc, char **argv);
+	static void TestBonusLayers(int argc, char **argv, argh::parser &cmd, std::string &description);
 	static void TestDataBuckets(int argc, char **argv, argh::parser &cmd, std::string &description);
 	static void TestNpcHandins(int argc, char **argv, argh::parser &cmd, std::string &description);
 	static void TestNpcHandinsMultiQuest(int argc, char **argv, argh::parser &cmd, std::string &description);
@@ -1,4 +1,5 @@
 #include "zone_event_scheduler.h"
+#include "mob.h"
 #include <ctime>
 
 void ZoneEventScheduler::Process(Zone *zone, WorldContentService *content_service)
@@ -43,6 +44,7 @@ void ZoneEventScheduler::Process(Zone *zone, WorldContentService *content_servic
 				if (e.event_type == ServerEvents::EVENT_TYPE_RULE_CHANGE) {
 					LogScheduler("Deactivating event [{}] resetting rules to normal", e.description);
 					RuleManager::Instance()->LoadRules(m_database, RuleManager::Instance()->GetActiveRuleset(), true);
+					Mob::InvalidateAllBonusLayers();
 
 					// force active events clear and reapply all active events because we reset the entire state
 					// ideally if we could revert only the state of which was originally set we would only remove one active event
@@ -103,6 +105,7 @@ void ZoneEventScheduler::Process(Zone *zone, WorldContentService *content_servic
 							rule_value
 						);
 						RuleManager::Instance()->SetRule(rule_key, rule_value, nullptr, false, true);
+						Mob::InvalidateAllBonusLayers();
 					}
 					m_active_events.push_back(e);
 				}
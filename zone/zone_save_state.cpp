@@ -1,6 +1,11 @@
+#include <chrono>
 #include <string>
 #include <cereal/archives/json.hpp>
+#include <cereal/archives/portable_binary.hpp>
+#include <cereal/external/base64.hpp>
 #include <cereal/types/map.hpp>
+#include <cereal/types/string.hpp>
+#include <cereal/types/vector.hpp>
 #include "npc.h"
 #include "corpse.h"
 #include "zone.h"
@@ -8,6 +13,137 @@
 #include "../common/repositories/spawn2_repository.h"
 #include "../common/repositories/criteria/content_filter_criteria.h"
 
+// rows are written in chunks so a large zone never builds one enormous INSERT
+constexpr size_t ZONE_STATE_INSERT_BATCH_SIZE = 500;
+
+// bump the version when the layout of an archived struct changes, rows with another tag then fail to load
+// and are treated like any other invalid state data
+static const std::string ZONE_STATE_BINARY_TAG = "#zs1:";
+
+bool IsZoneStateBinary(const std::string &data)
+{
+	return data.compare(0, ZONE_STATE_BINARY_TAG.size(), ZONE_STATE_BINARY_TAG) == 0;
+}
+
+template<class T>
+inline std::string ToZoneStateBinary(T &value)
+{
+	std::ostringstream os;
+	{
+		cereal::PortableBinaryOutputArchive ar(os);
+		ar(value);
+	}
+
+	const std::string raw = os.str();
+
+	return ZONE_STATE_BINARY_TAG + cereal::base64::encode(
+		reinterpret_cast<const unsigned char *>(raw.data()),
+		raw.size()
+	);
+}
+
+template<class T>
+inline void FromZoneStateBinary(const std::string &data, T &value)
+{
+	std::istringstream is(cereal::base64::decode(data.substr(ZONE_STATE_BINARY_TAG.size())));
+	cereal::PortableBinaryInputArchive ar(is);
+	ar(value);
+}
+
+inline void CheckZoneStateJson(const std::string &data)
+{
+	if (!Strings::IsValidJson(data)) {
+		throw std::runtime_error("invalid JSON");
+	}
+}
+
+std::string SerializeZoneStateLoot(LootStateData &l)
+{
+	if (!RuleB(Zone, StateSaveAsJson)) {
+		return ToZoneStateBinary(l);
+	}
+
+	std::stringstream ss;
+	{
+		cereal::JSONOutputArchiveSingleLine ar(ss);
+		l.serialize(ar);
+	}
+
+	return ss.str();
+}
+
+void DeserializeZoneStateLoot(const std::string &data, LootStateData &l)
+{
+	if (IsZoneStateBinary(data)) {
+		FromZoneStateBinary(data, l);
+		return;
+	}
+
+	CheckZoneStateJson(data);
+
+	std::stringstream ss(data);
+	cereal::JSONInputArchive ar(ss);
+	l.serialize(ar);
+}
+
+std::string SerializeZoneStateVariables(std::map<std::string, std::string> &variables)
+{
+	if (!RuleB(Zone, StateSaveAsJson)) {
+		return ToZoneStateBinary(variables);
+	}
+
+	std::ostringstream os;
+	{
+		cereal::JSONOutputArchiveSingleLine archive(os);
+		archive(variables);
+	}
+
+	return os.str();
+}
+
+void DeserializeZoneStateVariables(const std::string &data, std::map<std::string, std::string> &variables)
+{
+	if (IsZoneStateBinary(data)) {
+		FromZoneStateBinary(data, variables);
+		return;
+	}
+
+	CheckZoneStateJson(data);
+
+	std::istringstream is(data);
+	cereal::JSONInputArchive archive(is);
+	archive(variables);
+}
+
+std::string SerializeZoneStateBuffs(std::vector<Buffs_Struct> &buffs)
+{
+	if (!RuleB(Zone, StateSaveAsJson)) {
+		return ToZoneStateBinary(buffs);
+	}
+
+	std::ostringstream os;
+	{
+		cereal::JSONOutputArchiveSingleLine archive(os);
+		archive(cereal::make_nvp("buffs", buffs));
+	}
+
+	return os.str();
+}
+
+void DeserializeZoneStateBuffs(const std::string &data, std::vector<Buffs_Struct> &buffs)
+{
+	if (IsZoneStateBinary(data)) {
+		FromZoneStateBinary(data, buffs);
+		return;
+	}
+
+	CheckZoneStateJson(data);
+
+	std::istringstream is(data);
+	cereal::JSONInputArchive archive(is);
+	archive(cereal::make_nvp("buffs", buffs));
+}
+
 // IsZoneStateValid checks if the zone state is valid
 // if these fields are all empty or zero value for an entire zone state, it's considered invalid
 inline bool IsZoneStateValid(std::vector<ZoneStateSpawnsRepository::ZoneStateSpawns> &spawns)
@@ -42,18 +178,8 @@ inline void LoadLootStateData(Zone *zone, NPC *npc, const std::string &loot_data
 		return;
 	}
 
-	if (!Strings::IsValidJson(loot_data)) {
-		LogZoneState("Invalid JSON data for NPC [{}]", npc->GetNPCTypeID());
-		return;
-	}
-
 	try {
-		std::stringstream ss;
-		{
-			ss << loot_data;
-			cereal::JSONInputArchive ar(ss);
-			l.serialize(ar);
-		}
+		DeserializeZoneStateLoot(loot_data, l);
 	} catch (const std::exception &e) {
 		LogZoneState("Failed to load loot state data for NPC [{}] [{}]", npc->GetNPCTypeID(), e.what());
 		return;
@@ -117,13 +243,7 @@ inline std::string GetLootSerialized(NPC *npc)
 	}
 
 	try {
-		std::stringstream ss;
-		{
-			cereal::JSONOutputArchiveSingleLine ar(ss);
-			ls.serialize(ar);
-		}
-
-		return ss.str();
+		return SerializeZoneStateLoot(ls);
 	} catch (const std::exception &e) {
 		LogZoneState("Failed to serialize loot data for NPC [{}] [{}]", npc->GetNPCTypeID(), e.what());
 		return "";
@@ -152,13 +272,7 @@ inline std::string GetLootSerialized(Corpse *c)
 	}
 
 	try {
-		std::stringstream ss;
-		{
-			cereal::JSONOutputArchiveSingleLine ar(ss);
-			ls.serialize(ar);
-		}
-
-		return ss.str();
+		return SerializeZoneStateLoot(ls);
 	} catch (const std::exception &e) {
 		LogZoneState("Failed to serialize loot data for Corpse [{}] [{}]", c->GetID(), e.what());
 		return "";
@@ -175,18 +289,8 @@ inline std::map<std::string, std::string> GetVariablesDeserialized(const std::st
 		return deserialized_map;
 	}
 
-	if (!Strings::IsValidJson(entity_variables)) {
-		LogZoneState("Invalid JSON data for entity variables");
-		return deserialized_map;
-	}
-
 	try {
-		std::stringstream ss;
-		{
-			ss << entity_variables;
-			cereal::JSONInputArchive ar(ss);
-			ar(deserialized_map);
-		}
+		DeserializeZoneStateVariables(entity_variables, deserialized_map);
 	} catch (const std::exception &e) {
 		LogZoneState("Failed to load entity variables [{}]", e.what());
 	}
@@ -219,21 +323,12 @@ inline void LoadNPCBuffs(NPC *n, const std::string &buffs)
 		return;
 	}
 
-	if (!Strings::IsValidJson(buffs)) {
-		LogZoneState("Invalid JSON data for NPC [{}]", n->GetNPCTypeID());
-		return;
-	}
-
 	std::vector<Buffs_Struct> valid_buffs;
 	try {
-		std::istringstream is(buffs);
-		{
-			cereal::JSONInputArchive archive(is);
-			archive(cereal::make_nvp("buffs", valid_buffs));
-		}
+		DeserializeZoneStateBuffs(buffs, valid_buffs);
 	}
 	catch (const std::exception &e) {
-		LogZoneState("Failed to load entity variables for NPC [{}] [{}]", n->GetNPCTypeID(), e.what());
+		LogZoneState("Failed to load buffs for NPC [{}] [{}]", n->GetNPCTypeID(), e.what());
 		return;
 	}
 
@@ -251,18 +346,9 @@ inline std::vector<uint32_t> GetLootdropIds(const std::vector<ZoneStateSpawnsRep
 			continue;
 		}
 
-		if (!Strings::IsValidJson(s.loot_data)) {
-			continue;
-		}
-
 		LootStateData l{};
 		try {
-			std::stringstream ss;
-			{
-				ss << s.loot_data;
-				cereal::JSONInputArchive ar(ss);
-				l.serialize(ar);
-			}
+			DeserializeZoneStateLoot(s.loot_data, l);
 		}
 		catch (const std::exception &e) {
 			LogZoneState("Failed to load loot state data for spawn2 [{}] [{}]", s.id, e.what());
@@ -343,12 +429,7 @@ inline std::string GetZoneVariablesSerialized(Zone *z)
 	}
 
 	try {
-		std::ostringstream os;
-		{
-			cereal::JSONOutputArchiveSingleLine archive(os);
-			archive(variables);
-		}
-		return os.str();
+		return SerializeZoneStateVariables(variables);
 	}
 	catch (const std::exception &e) {
 		LogZoneState("Failed to serialize variables for zone [{}]", e.what());
@@ -360,18 +441,9 @@ inline std::string GetZoneVariablesSerialized(Zone *z)
 
 inline void LoadZoneVariables(Zone *z, const std::string &variables)
 {
-	if (!Strings::IsValidJson(variables)) {
-		LogZoneState("Invalid JSON data for zone [{}]", variables);
-		return;
-	}
-
 	std::map<std::string, std::string> deserialized_map;
 	try {
-		std::istringstream is(variables);
-		{
-			cereal::JSONInputArchive archive(is);
-			archive(deserialized_map);
-		}
+		DeserializeZoneStateVariables(variables, deserialized_map);
 	}
 	catch (const std::exception &e) {
 		LogZoneState("Failed to load zone variables [{}]", e.what());
@@ -413,6 +485,8 @@ bool Zone::LoadZoneState(
 	std::vector<Spawn2DisabledRepository::Spawn2Disabled> disabled_spawns
 )
 {
+	const auto start = std::chrono::steady_clock::now();
+
 	auto spawn_states = ZoneStateSpawnsRepository::GetWhere(
 		database,
 		fmt::format(
@@ -628,6 +702,12 @@ bool Zone::LoadZoneState(
 		LoadNPCState(zone, npc, s);
 	}
 
+	LogInfo(
+		"Restored [{}] zone state spawns in [{}] ms",
+		Strings::Commify(spawn_states.size()),
+		std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count()
+	);
+
 	return !spawn_states.empty();
 }
 
@@ -642,12 +722,7 @@ inline void SaveNPCState(NPC *n, ZoneStateSpawnsRepository::ZoneStateSpawns &s)
 
 	if (!variables.empty()) {
 		try {
-			std::ostringstream os;
-			{
-				cereal::JSONOutputArchiveSingleLine archive(os);
-				archive(variables);
-			}
-			s.entity_variables = os.str();
+			s.entity_variables = SerializeZoneStateVariables(variables);
 		}
 		catch (const std::exception &e) {
 			LogZoneState("Failed to serialize entity variables for NPC [{}] [{}]", n->GetNPCTypeID(), e.what());
@@ -666,12 +741,7 @@ inline void SaveNPCState(NPC *n, ZoneStateSpawnsRepository::ZoneStateSpawns &s)
 
 		if (!valid_buffs.empty()) {
 			try {
-				std::ostringstream os = std::ostringstream();
-				{
-					cereal::JSONOutputArchiveSingleLine archive(os);
-					archive(cereal::make_nvp("buffs", valid_buffs));
-				}
-				s.buffs = os.str();
+				s.buffs = SerializeZoneStateBuffs(valid_buffs);
 			}
 			catch (const std::exception &e) {
 				LogZoneState("Failed to serialize buffs for NPC [{}] [{}]", n->GetNPCTypeID(), e.what());
@@ -696,6 +766,8 @@ inline void SaveNPCState(NPC *n, ZoneStateSpawnsRepository::ZoneStateSpawns &s)
 
 void Zone::SaveZoneState()
 {
+	const auto start = std::chrono::steady_clock::now();
+
 	// spawns
 	std::vector<ZoneStateSpawnsRepository::ZoneStateSpawns> spawns = {};
 	LinkedListIterator<Spawn2 *>                            iterator(spawn2_list);
@@ -792,6 +864,11 @@ void Zone::SaveZoneState()
 		spawns.emplace_back(z);
 	}
 
+	const bool has_state = !spawns.empty() && IsZoneStateValid(spawns);
+
+	// the old state is only replaced once the new one is fully written
+	database.TransactionBegin();
+
 	ZoneStateSpawnsRepository::DeleteWhere(
 		database,
 		fmt::format(
@@ -801,19 +878,36 @@ void Zone::SaveZoneState()
 		)
 	);
 
-	if (!IsZoneStateValid(spawns)) {
+	if (!has_state) {
+		database.TransactionCommit();
 		LogInfo("No valid zone state data to save");
 		return;
 	}
 
-	if (spawns.empty()) {
-		LogInfo("No zone state data to save");
-		return;
+	size_t state_bytes = 0;
+	for (const auto &s: spawns) {
+		state_bytes += s.loot_data.size() + s.entity_variables.size() + s.buffs.size();
+	}
+
+	for (size_t i = 0; i < spawns.size(); i += ZONE_STATE_INSERT_BATCH_SIZE) {
+		const auto last = std::min(spawns.size(), i + ZONE_STATE_INSERT_BATCH_SIZE);
+
+		std::vector<ZoneStateSpawnsRepository::ZoneStateSpawns> batch(spawns.begin() + i, spawns.begin() + last);
+		if (!ZoneStateSpawnsRepository::InsertMany(database, batch)) {
+			database.TransactionRollback();
+			LogError("Failed to save zone state, previous state was kept");
+			return;
+		}
 	}
 
-	ZoneStateSpawnsRepository::InsertMany(database, spawns);
+	database.TransactionCommit();
 
-	LogInfo("Saved [{}] zone state spawns", Strings::Commify(spawns.size()));
+	LogInfo(
+		"Saved [{}] zone state spawns ([{}] bytes of state) in [{}] ms",
+		Strings::Commify(spawns.size()),
+		Strings::Commify(state_bytes),
+		std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count()
+	);
 }
 
 void Zone::ClearZoneState(uint32 zone_id, uint32 instance_id)
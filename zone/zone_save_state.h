@@ -1,6 +1,8 @@
 #pragma once
 
 #include <string>
+#include <map>
+#include <vector>
 #include <cereal/archives/json.hpp>
 #include <cereal/types/map.hpp>
 #include "npc.h"
@@ -46,3 +48,21 @@ struct LootStateData {
 		);
 	}
 };
+
+/**
+ * Encoding of the loot_data, entity_variables and buffs columns of zone_state_spawns
+ *
+ * Saves write a versioned binary encoding (a tag followed by a base64 cereal portable binary archive, so it stays
+ * safe in the text columns) unless Zone:StateSaveAsJson is set, which writes the old JSON for inspecting the table.
+ * Loads accept either. The Deserialize functions throw on malformed data
+ */
+bool IsZoneStateBinary(const std::string &data);
+
+std::string SerializeZoneStateLoot(LootStateData &l);
+void DeserializeZoneStateLoot(const std::string &data, LootStateData &l);
+
+std::string SerializeZoneStateVariables(std::map<std::string, std::string> &variables);
+void DeserializeZoneStateVariables(const std::string &data, std::map<std::string, std::string> &variables);
+
+std::string SerializeZoneStateBuffs(std::vector<Buffs_Struct> &buffs);
+void DeserializeZoneStateBuffs(const std::string &data, std::vector<Buffs_Struct> &buffs);
@@ -11,6 +11,7 @@
 #include "zone.h"
 #include "zonedb.h"
 #include "aura.h"
+#include "character_save_queue.h"
 #include "../common/repositories/blocked_spells_repository.h"
 #include "../common/repositories/character_tribute_repository.h"
 #include "../common/repositories/character_data_repository.h"
@@ -958,12 +959,21 @@ bool ZoneDatabase::SaveCharacterDiscipline(uint32 character_id, uint32 slot_id,
 }
 
 void ZoneDatabase::SaveCharacterTribute(Client* c)
+{
+	if (!CharacterSaveQueue::Instance()->Flush(c->CharacterID())) {
+		return;
+	}
+
+	database.SaveCharacterTribute(c->CharacterID(), c->GetPP());
+}
+
+void ZoneDatabase::SaveCharacterTribute(uint32 character_id, const PlayerProfile_Struct& pp)
 {
 	std::vector<CharacterTributeRepository::CharacterTribute> tributes = {};
 	CharacterTributeRepository::CharacterTribute tribute = {};
 
 	uint32 tribute_count = 0;
-	for (auto& t : c->GetPP().tributes) {
+	for (auto& t : pp.tributes) {
 		if (t.tribute != TRIBUTE_NONE) {
 			tribute_count++;
 		}
@@ -971,9 +981,9 @@ void ZoneDatabase::SaveCharacterTribute(Client* c)
 
 	tributes.reserve(tribute_count);
 
-	for (auto& t : c->GetPP().tributes) {
+	for (auto& t : pp.tributes) {
 		if (t.tribute != TRIBUTE_NONE) {
-			tribute.character_id = c->CharacterID();
+			tribute.character_id = character_id;
 			tribute.tier         = t.tier;
 			tribute.tribute      = t.tribute;
 
@@ -981,10 +991,10 @@ void ZoneDatabase::SaveCharacterTribute(Client* c)
 		}
 	}
 
-	CharacterTributeRepository::DeleteWhere(database, fmt::format("character_id = {}", c->CharacterID()));
+	CharacterTributeRepository::DeleteWhere(*this, fmt::format("character_id = {}", character_id));
 
 	if (tribute_count > 0) {
-		CharacterTributeRepository::InsertMany(database, tributes);
+		CharacterTributeRepository::InsertMany(*this, tributes);
 	}
 }
 
@@ -1056,15 +1066,46 @@ bool ZoneDatabase::SaveCharacterData(
 		return false;
 	}
 
+	// a queued write-behind save would otherwise land on top of this one, one still in flight wins and this save
+	// waits for the next one
+	if (!CharacterSaveQueue::Instance()->Flush(c->CharacterID())) {
+		return false;
+	}
+
+	return database.SaveCharacterData(
+		c->CharacterID(),
+		c->AccountID(),
+		c->GetCleanName(),
+		*pp,
+		*m_epp,
+		c->IsEXPEnabled(),
+		c->GetMailKeyFull(),
+		c->GetIllusionBlock()
+	);
+}
+
+bool ZoneDatabase::SaveCharacterData(
+	uint32 character_id,
+	uint32 account_id,
+	const std::string& name,
+	const PlayerProfile_Struct& profile,
+	const ExtendedProfile_Struct& extended_profile,
+	bool exp_enabled,
+	const std::string& mail_key,
+	bool illusion_block
+) {
+	auto pp    = &profile;
+	auto m_epp = &extended_profile;
+
 	clock_t t = std::clock(); /* Function timer start */
 
-	auto e = CharacterDataRepository::FindOne(database, c->CharacterID());
+	auto e = CharacterDataRepository::FindOne(*this, character_id);
 	if (!e.id) {
 		return false;
 	}
 
-	e.id                      = c->CharacterID();
-	e.account_id              = c->AccountID();
+	e.id                      = character_id;
+	e.account_id              = account_id;
 	e.name                    = pp->name;
 	e.last_name               = pp->last_name;
 	e.gender                  = pp->gender;
@@ -1093,7 +1134,7 @@ bool ZoneDatabase::SaveCharacterData(
 	e.title                   = pp->title;
 	e.suffix                  = pp->suffix;
 	e.exp                     = pp->exp;
-	e.exp_enabled             = c->IsEXPEnabled();
+	e.exp_enabled             = exp_enabled;
 	e.points                  = pp->points;
 	e.mana                    = pp->mana;
 	e.cur_hp                  = pp->cur_hp;
@@ -1158,19 +1199,19 @@ bool ZoneDatabase::SaveCharacterData(
 	e.e_percent_to_aa         = m_epp->perAA;
 	e.e_expended_aa_spent     = m_epp->expended_aa;
 	e.e_last_invsnapshot      = m_epp->last_invsnapshot_time;
-	e.mailkey                 = c->GetMailKeyFull();
-	e.illusion_block          = c->GetIllusionBlock();
+	e.mailkey                 = mail_key;
+	e.illusion_block          = illusion_block;
 
-	const int replaced = CharacterDataRepository::ReplaceOne(database, e);
+	const int replaced = CharacterDataRepository::ReplaceOne(*this, e);
 
 	if (!replaced) {
-		LogError("Failed to save character data for [{}] ID [{}].", c->GetCleanName(), c->CharacterID());
+		LogError("Failed to save character data for [{}] ID [{}].", name, character_id);
 		return false;
 	}
 
 	LogDebug(
 		"ZoneDatabase::SaveCharacterData [{}], done Took [{}] seconds",
-		c->CharacterID(),
+		character_id,
 		((float)(std::clock() - t)) / CLOCKS_PER_SEC
 	);
 	return true;
@@ -1665,29 +1706,39 @@ const NPCType *ZoneDatabase::LoadNPCTypesData(uint32 npc_type_id, bool bulk_load
 		return itr->second;
 	}
 
-	std::string filter = fmt::format("id = {}", npc_type_id);
+	// both filters are bound rather than formatted so each is only prepared once per connection
+	std::string                               filter = "id = ?";
+	std::vector<mysql::PreparedStmt::param_t> params = { npc_type_id };
 
 	if (bulk_load) {
 		LogDebug("Performing bulk NPC Types load");
 
-		filter = fmt::format(
-			SQL(
-				id IN (
-					select npcID from spawnentry where spawngroupID IN (
-						select spawngroupID from spawn2 where `zone` = '{}' and (`version` = {} OR `version` = -1)
-					)
+		filter = SQL(
+			id IN (
+				select npcID from spawnentry where spawngroupID IN (
+					select spawngroupID from spawn2 where `zone` = ? and (`version` = ? OR `version` = -1)
 				)
-			),
-			zone->GetShortName(),
-			zone->GetInstanceVersion()
+			)
 		);
+
+		params = { std::string_view(zone->GetShortName()), static_cast<int32_t>(zone->GetInstanceVersion()) };
+	}
+
+	std::vector<NpcTypesRepository::NpcTypes> l;
+
+	try {
+		l = NpcTypesRepository::GetWherePrepared((Database &) content_db, filter, params);
+	}
+	catch (const std::exception &e) {
+		LogError("Failed to load NPC types for npc_type_id [{}] bulk_load [{}]: {}", npc_type_id, bulk_load, e.what());
+		return nullptr;
 	}
 
 	std::vector<uint32> npc_ids;
 	std::vector<uint32> npc_faction_ids;
 	std::vector<uint32> loottable_ids;
 
-	for (NpcTypesRepository::NpcTypes &n : NpcTypesRepository::GetWhere((Database &) content_db, filter)) {
+	for (NpcTypesRepository::NpcTypes &n : l) {
 		NPCType *t;
 		t = new NPCType;
 		memset(t, 0, sizeof *t);
@@ -2443,6 +2494,8 @@ void ZoneDatabase::LoadMercenaryBuffs(Merc* m)
 		}
 	}
 
+	m->RefreshActiveBuffEffects();
+
 	MercBuffsRepository::DeleteWhere(
 		*this,
 		fmt::format(
@@ -2509,6 +2562,32 @@ void ZoneDatabase::LoadMercenaryEquipment(Merc* m)
 	}
 }
 
+std::vector<MerchantlistRepository::Merchantlist> ZoneDatabase::LoadZoneMerchantLists(
+	const std::string &zone_name,
+	int16 version
+)
+{
+	return MerchantlistRepository::GetWhere(
+		*this,
+		fmt::format(
+			SQL(
+				`merchantid` IN (
+					SELECT `merchant_id` FROM `npc_types` WHERE `id` IN (
+						SELECT `npcID` FROM `spawnentry` WHERE `spawngroupID` IN (
+							SELECT `spawngroupID` FROM `spawn2` WHERE `zone` = '{}' AND (`version` = {} OR `version` = -1)
+						)
+					)
+				)
+				{}
+				ORDER BY `merchantlist`.`slot`
+			),
+			zone_name,
+			version,
+			ContentFilterCriteria::apply()
+		)
+	);
+}
+
 void ZoneDatabase::SaveMerchantTemp(
 	uint32 npc_id,
 	uint32 slot_id,
@@ -2878,18 +2957,24 @@ void ZoneDatabase::UpdateAltCurrencyValue(uint32 char_id, uint32 currency_id, ui
 }
 
 void ZoneDatabase::SaveBuffs(Client *client)
+{
+	if (!CharacterSaveQueue::Instance()->Flush(client->CharacterID())) {
+		return;
+	}
+
+	SaveBuffs(client->CharacterID(), client->GetBuffs(), client->GetMaxBuffSlots());
+}
+
+void ZoneDatabase::SaveBuffs(uint32 character_id, const Buffs_Struct *buffs, int max_buff_slots)
 {
 	CharacterBuffsRepository::DeleteWhere(
-		database,
+		*this,
 		fmt::format(
 			"`character_id` = {}",
-			client->CharacterID()
+			character_id
 		)
 	);
 
-	auto      buffs          = client->GetBuffs();
-	const int max_buff_slots = client->GetMaxBuffSlots();
-
 	std::vector<CharacterBuffsRepository::CharacterBuffs> v;
 
 	auto e = CharacterBuffsRepository::NewEntity();
@@ -2911,7 +2996,7 @@ void ZoneDatabase::SaveBuffs(Client *client)
 			continue;
 		}
 
-		e.character_id   = client->CharacterID();
+		e.character_id   = character_id;
 		e.slot_id        = slot_id;
 		e.spell_id       = buffs[slot_id].spellid;
 		e.caster_level   = buffs[slot_id].casterlevel;
@@ -2933,7 +3018,7 @@ void ZoneDatabase::SaveBuffs(Client *client)
 	}
 
 	if (!v.empty()) {
-		CharacterBuffsRepository::ReplaceMany(database, v);
+		CharacterBuffsRepository::ReplaceMany(*this, v);
 	}
 }
 
@@ -2955,6 +3040,7 @@ void ZoneDatabase::LoadBuffs(Client *client)
 	);
 
 	if (l.empty()) {
+		client->RefreshActiveBuffEffects();
 		return;
 	}
 
@@ -3023,6 +3109,8 @@ void ZoneDatabase::LoadBuffs(Client *client)
 			break;
 		}
 	}
+
+	client->RefreshActiveBuffEffects();
 }
 
 void ZoneDatabase::SaveAuras(Client *c)
@@ -3072,7 +3160,20 @@ void ZoneDatabase::LoadAuras(Client *c)
 
 void ZoneDatabase::SavePetInfo(Client *client)
 {
-	PetInfo* p = nullptr;
+	if (!CharacterSaveQueue::Instance()->Flush(client->CharacterID())) {
+		return;
+	}
+
+	SavePetInfo(
+		client->CharacterID(),
+		client->GetPetInfo(PetInfoType::Current),
+		client->GetPetInfo(PetInfoType::Suspended)
+	);
+}
+
+void ZoneDatabase::SavePetInfo(uint32 character_id, const PetInfo *current, const PetInfo *suspended)
+{
+	const PetInfo* p = nullptr;
 
 	std::vector<CharacterPetInfoRepository::CharacterPetInfo> pet_infos;
 	auto pet_info = CharacterPetInfoRepository::NewEntity();
@@ -3084,12 +3185,12 @@ void ZoneDatabase::SavePetInfo(Client *client)
 	auto item = CharacterPetInventoryRepository::NewEntity();
 
 	for (int pet_info_type = PetInfoType::Current; pet_info_type <= PetInfoType::Suspended; pet_info_type++) {
-		p = client->GetPetInfo(pet_info_type);
+		p = pet_info_type == PetInfoType::Suspended ? suspended : current;
 		if (!p) {
 			continue;
 		}
 
-		pet_info.char_id  = client->CharacterID();
+		pet_info.char_id  = character_id;
 		pet_info.pet      = pet_info_type;
 		pet_info.petname  = p->Name;
 		pet_info.petpower = p->petpower;
@@ -3124,7 +3225,7 @@ void ZoneDatabase::SavePetInfo(Client *client)
 				continue;
 			}
 
-			pet_buff.char_id        = client->CharacterID();
+			pet_buff.char_id        = character_id;
 			pet_buff.pet            = pet_info_type;
 			pet_buff.slot           = slot_id;
 			pet_buff.spell_id       = p->Buffs[slot_id].spellid;
@@ -3161,7 +3262,7 @@ void ZoneDatabase::SavePetInfo(Client *client)
 				continue;
 			}
 
-			item.char_id = client->CharacterID();
+			item.char_id = character_id;
 			item.pet     = pet_info_type;
 			item.slot    = slot_id;
 			item.item_id = p->Items[slot_id];
@@ -3171,39 +3272,39 @@ void ZoneDatabase::SavePetInfo(Client *client)
 	}
 
 	CharacterPetInfoRepository::DeleteWhere(
-		database,
+		*this,
 		fmt::format(
 			"`char_id` = {}",
-			client->CharacterID()
+			character_id
 		)
 	);
 
 	if (!pet_infos.empty()) {
-		CharacterPetInfoRepository::InsertMany(database, pet_infos);
+		CharacterPetInfoRepository::InsertMany(*this, pet_infos);
 	}
 
 	CharacterPetBuffsRepository::DeleteWhere(
-		database,
+		*this,
 		fmt::format(
 			"`char_id` = {}",
-			client->CharacterID()
+			character_id
 		)
 	);
 
 	if (!pet_buffs.empty()) {
-		CharacterPetBuffsRepository::InsertMany(database, pet_buffs);
+		CharacterPetBuffsRepository::InsertMany(*this, pet_buffs);
 	}
 
 	CharacterPetInventoryRepository::DeleteWhere(
-		database,
+		*this,
 		fmt::format(
 			"`char_id` = {}",
-			client->CharacterID()
+			character_id
 		)
 	);
 
 	if (!inventory.empty()) {
-		CharacterPetInventoryRepository::InsertMany(database, inventory);
+		CharacterPetInventoryRepository::InsertMany(*this, inventory);
 	}
 }
 
@@ -4078,13 +4179,22 @@ void ZoneDatabase::UpdateGMStatus(uint32 account_id, int new_status)
 }
 
 void ZoneDatabase::SaveCharacterBinds(Client *c)
+{
+	if (!CharacterSaveQueue::Instance()->Flush(c->CharacterID())) {
+		return;
+	}
+
+	database.SaveCharacterBinds(c->CharacterID(), c->GetPP());
+}
+
+void ZoneDatabase::SaveCharacterBinds(uint32 character_id, const PlayerProfile_Struct &pp)
 {
 	std::vector<CharacterBindRepository::CharacterBind> v;
 
 	auto e = CharacterBindRepository::NewEntity();
 
 	uint32 bind_count = 0;
-	for (const auto &b : c->GetPP().binds) {
+	for (const auto &b : pp.binds) {
 		if (b.zone_id) {
 			bind_count++;
 		}
@@ -4094,9 +4204,9 @@ void ZoneDatabase::SaveCharacterBinds(Client *c)
 
 	int slot_id = 0;
 
-	for (const auto &b : c->GetPP().binds) {
+	for (const auto &b : pp.binds) {
 		if (b.zone_id) {
-			e.id          = c->CharacterID();
+			e.id          = character_id;
 			e.zone_id     = b.zone_id;
 			e.instance_id = b.instance_id;
 			e.x           = b.x;
@@ -4112,7 +4222,7 @@ void ZoneDatabase::SaveCharacterBinds(Client *c)
 	}
 
 	if (bind_count > 0) {
-		CharacterBindRepository::ReplaceMany(database, v);
+		CharacterBindRepository::ReplaceMany(*this, v);
 	}
 }
 
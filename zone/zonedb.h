@@ -11,6 +11,8 @@
 #include "aa_ability.h"
 #include "event_codes.h"
 #include "../common/repositories/doors_repository.h"
+#include "../common/repositories/merchantlist_repository.h"
+#include "../common/repositories/spawn2_repository.h"
 #include "../common/races.h"
 #include "../common/repositories/npc_faction_entries_repository.h"
 
@@ -416,11 +418,13 @@ public:
 	uint32	GetServerFilters(char* name, ServerSideFilters_Struct *ssfs);
 
 	void SaveBuffs(Client *c);
+	void SaveBuffs(uint32 character_id, const Buffs_Struct *buffs, int max_buff_slots);
 	void LoadBuffs(Client *c);
 	void SaveAuras(Client *c);
 	void LoadAuras(Client *c);
 	void LoadPetInfo(Client *c);
 	void SavePetInfo(Client *c);
+	void SavePetInfo(uint32 character_id, const PetInfo *current, const PetInfo *suspended);
 	void RemoveTempFactions(Client *c);
 	void UpdateItemRecast(uint32 char_id, uint32 recast_type, uint32 timestamp);
 	void DeleteItemRecast(uint32 char_id, uint32 recast_type);
@@ -450,6 +454,16 @@ public:
 	bool SaveCharacterBandolier(uint32 character_id, uint8 bandolier_id, uint8 bandolier_slot, uint32 item_id, uint32 icon, const char* bandolier_name);
 	bool SaveCharacterCurrency(uint32 character_id, PlayerProfile_Struct* pp);
 	bool SaveCharacterData(Client* c, PlayerProfile_Struct* pp, ExtendedProfile_Struct* m_epp);
+	bool SaveCharacterData(
+		uint32 character_id,
+		uint32 account_id,
+		const std::string& name,
+		const PlayerProfile_Struct& profile,
+		const ExtendedProfile_Struct& extended_profile,
+		bool exp_enabled,
+		const std::string& mail_key,
+		bool illusion_block
+	);
 	bool SaveCharacterDiscipline(uint32 character_id, uint32 slot_id, uint32 disc_id);
 	bool SaveCharacterLanguage(uint32 character_id, uint32 lang_id, uint32 value);
 	bool SaveCharacterLeadershipAbilities(uint32 character_id, PlayerProfile_Struct* pp);
@@ -534,6 +548,8 @@ public:
 	bool		LoadSpawnGroups(const char* zone_name, uint16 version, SpawnGroupList* spawn_group_list);
 	bool		LoadSpawnGroupsByID(int spawn_group_id, SpawnGroupList* spawn_group_list);
 	bool		PopulateZoneSpawnList(uint32 zoneid, LinkedList<Spawn2*> &spawn2_list, int16 version);
+	bool		PopulateZoneSpawnList(uint32 zoneid, LinkedList<Spawn2*> &spawn2_list, int16 version, const std::vector<Spawn2Repository::Spawn2> &spawns);
+	std::vector<Spawn2Repository::Spawn2> LoadZoneSpawn2(const std::string& zone_name, int16 version);
 	bool		CreateSpawn2(Client* c, uint32 spawngroup_id, const std::string& zone_short_name, const glm::vec4& position, uint32 respawn, uint32 variance, uint16 condition, int16 condition_value);
 	void		UpdateRespawnTime(uint32 spawn2_id, uint16 instance_id,uint32 timeleft);
 	uint32		GetSpawnTimeLeft(uint32 spawn2_id, uint16 instance_id);
@@ -595,6 +611,7 @@ public:
 	void	RefreshPetitionsFromDB();
 
 	/* Merchants  */
+	std::vector<MerchantlistRepository::Merchantlist> LoadZoneMerchantLists(const std::string& zone_name, int16 version);
 	void	SaveMerchantTemp(uint32 npcid, uint32 slot, uint32 zone_id, uint32 instance_id, uint32 item, uint32 charges);
 	void	DeleteMerchantTemp(uint32 npcid, uint32 slot, uint32 zone_id, uint32 instance_id);
 
@@ -657,6 +674,8 @@ public:
 
 	static void SaveCharacterBinds(Client *c);
 	static void SaveCharacterTribute(Client* c);
+	void SaveCharacterBinds(uint32 character_id, const PlayerProfile_Struct& pp);
+	void SaveCharacterTribute(uint32 character_id, const PlayerProfile_Struct& pp);
 protected:
 	void ZDBInitVars();
 